@@ -0,0 +1,26 @@
+# Generated by configure.sh
+CONFIG_PREFIX="/usr/local"
+CONFIG_HOST_ARCH="x86_64"
+CONFIG_HOST="Linux"
+CONFIG_HOST_CC="cc"
+CONFIG_HVT="1"
+CONFIG_HVT_TENDER_ENABLE_CAPSICUM=""
+CONFIG_HVT_TENDER="1"
+CONFIG_SPT="1"
+CONFIG_SPT_TENDER="1"
+CONFIG_SPT_TENDER_NO_PIE=""
+CONFIG_SPT_TENDER_LIBSECCOMP_CFLAGS="-I/tmp/scstub/include "
+CONFIG_SPT_TENDER_LIBSECCOMP_LDLIBS="-L/tmp/scstub/lib -lseccomp "
+CONFIG_VIRTIO="1"
+CONFIG_MUEN="1"
+CONFIG_XEN="1"
+CONFIG_TARGET_ARCH="x86_64"
+CONFIG_TARGET_TRIPLE="x86_64-solo5-none-static"
+CONFIG_TARGET_CC="cc"
+CONFIG_TARGET_CC_CFLAGS="-nostdinc -mstack-protector-guard=global"
+CONFIG_TARGET_CC_LDFLAGS="-Wl,--build-id=none"
+CONFIG_TARGET_CC_IS_OPENBSD=""
+CONFIG_TARGET_LD="ld"
+CONFIG_TARGET_LD_LDFLAGS=""
+CONFIG_TARGET_LD_MAX_PAGE_SIZE="0x1000"
+CONFIG_TARGET_OBJCOPY="objcopy"
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+#include "../../tests/bench.h"
+
+/*
+ * Block device benchmark. Measures sequential write and read bandwidth, and
+ * random write and read IOPS of single blocks over "storage", which should be
+ * attached to a scratch file. Each measurement runs for DURATION ns.
+ */
+#define DURATION (500ULL * 1000 * 1000)
+#define BATCH 16
+
+static uint64_t rand_state = 1;
+
+static uint64_t rand_block(uint64_t nblocks)
+{
+    rand_state = rand_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (rand_state >> 33) % nblocks;
+}
+
+/*
+ * Run I/O for DURATION ns, sequentially or at random offsets. Returns the
+ * number of blocks transferred and their (*elapsed) time, or 0 on error.
+ */
+static uint64_t run(solo5_handle_t h, const struct solo5_block_info *bi,
+        bool write, bool random, solo5_time_t *elapsed)
+{
+    uint8_t buf[bi->block_size];
+    uint64_t nblocks = bi->capacity / bi->block_size;
+    uint64_t done = 0, block = 0;
+    solo5_time_t start = solo5_clock_monotonic();
+
+    memset(buf, 0x5a, sizeof buf);
+    do {
+        for (unsigned i = 0; i != BATCH; i++) {
+            solo5_result_t rc;
+
+            if (random)
+                block = rand_block(nblocks);
+            else
+                block = (block + 1) % nblocks;
+            if (write)
+                rc = solo5_block_write(h, block * bi->block_size, buf,
+                        bi->block_size);
+            else
+                rc = solo5_block_read(h, block * bi->block_size, buf,
+                        bi->block_size);
+            if (rc != SOLO5_R_OK)
+                return 0;
+        }
+        done += BATCH;
+        *elapsed = solo5_clock_monotonic() - start;
+    } while (*elapsed < DURATION);
+
+    return done;
+}
+
+int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
+{
+    puts("\n**** Solo5 standalone bench_blk ****\n\n");
+
+    solo5_handle_t h;
+    struct solo5_block_info bi;
+    if (solo5_block_acquire("storage", &h, &bi) != SOLO5_R_OK) {
+        puts("Could not acquire 'storage' block device\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+
+    solo5_time_t elapsed;
+    uint64_t n;
+    if ((n = run(h, &bi, true, false, &elapsed)) == 0)
+        goto out_error;
+    bench_report("blk_seq_write_mbps", n * bi.block_size * 1000 / elapsed,
+            "MB/s");
+    if ((n = run(h, &bi, false, false, &elapsed)) == 0)
+        goto out_error;
+    bench_report("blk_seq_read_mbps", n * bi.block_size * 1000 / elapsed,
+            "MB/s");
+    if ((n = run(h, &bi, true, true, &elapsed)) == 0)
+        goto out_error;
+    bench_report("blk_rand_write_iops", n * 1000000000ULL / elapsed, "IOPS");
+    if ((n = run(h, &bi, false, true, &elapsed)) == 0)
+        goto out_error;
+    bench_report("blk_rand_read_iops", n * 1000000000ULL / elapsed, "IOPS");
+
+    puts("SUCCESS\n");
+    return SOLO5_EXIT_SUCCESS;
+
+out_error:
+    puts("I/O error\n");
+    return SOLO5_EXIT_FAILURE;
+}
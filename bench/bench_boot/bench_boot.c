@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+#include "../../tests/bench.h"
+
+/*
+ * Boot benchmark guest, see run-bench.sh. Reports the wall clock time at
+ * which solo5_app_main() was reached, so that the time taken by the tender and
+ * bindings to start the unikernel can be measured from the host.
+ *
+ * The guest carries IMAGE_SIZE bytes of read-only data, so that the cost of
+ * loading it is representative of a real application rather than of a
+ * minimal test.
+ */
+#define IMAGE_SIZE (4UL << 20)
+
+static const uint8_t image[IMAGE_SIZE] = { 1 };
+
+int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
+{
+    solo5_time_t now = solo5_clock_wall();
+    const volatile uint8_t *p = image;
+
+    puts("\n**** Solo5 standalone bench_boot ****\n\n");
+    puts("app_main reached at: ");
+    put_u64(now);
+    puts("\n");
+
+    if (p[0] == 1)
+        puts("SUCCESS\n");
+
+    return SOLO5_EXIT_SUCCESS;
+}
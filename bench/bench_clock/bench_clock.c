@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+#include "../../tests/bench.h"
+
+/*
+ * Clock benchmark. Measures the cost of solo5_clock_monotonic() and
+ * solo5_clock_wall(), neither of which should trap to the tender.
+ */
+#define DURATION (500ULL * 1000 * 1000)
+#define BATCH 1024
+
+static volatile solo5_time_t sink;
+
+static void bench(const char *metric, solo5_time_t (*clock)(void))
+{
+    uint64_t calls = 0;
+    solo5_time_t start = solo5_clock_monotonic(), elapsed;
+
+    do {
+        for (unsigned i = 0; i != BATCH; i++)
+            sink = clock();
+        calls += BATCH;
+        elapsed = solo5_clock_monotonic() - start;
+    } while (elapsed < DURATION);
+
+    /*
+     * Report in picoseconds, as the cost of a call can be well below 1 ns.
+     */
+    bench_report(metric, elapsed * 1000 / calls, "ps");
+}
+
+int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
+{
+    puts("\n**** Solo5 standalone bench_clock ****\n\n");
+
+    bench("clock_monotonic_ps", solo5_clock_monotonic);
+    bench("clock_wall_ps", solo5_clock_wall);
+
+    puts("SUCCESS\n");
+
+    return SOLO5_EXIT_SUCCESS;
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+#include "../../tests/bench.h"
+
+/*
+ * Null hypercall benchmark. solo5_yield() with a deadline in the past is the
+ * cheapest call that always traps to the tender without doing any I/O:
+ * HVT_HYPERCALL_POLL with a zero timeout on hvt, epoll_pwait() on spt.
+ */
+#define DURATION (500ULL * 1000 * 1000)
+#define BATCH 64
+
+int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
+{
+    puts("\n**** Solo5 standalone bench_hypercall ****\n\n");
+
+    uint64_t calls = 0;
+    solo5_time_t start = solo5_clock_monotonic(), elapsed;
+    do {
+        /*
+         * Any deadline in the past will do, but not 0: spt passes the
+         * deadline to timerfd_settime() as is, where 0 disarms the timer.
+         */
+        for (unsigned i = 0; i != BATCH; i++)
+            solo5_yield(1, NULL);
+        calls += BATCH;
+        elapsed = solo5_clock_monotonic() - start;
+    } while (elapsed < DURATION);
+
+    bench_report("hypercall_ns", elapsed / calls, "ns");
+    bench_report("hypercall_rate", calls * 1000000000ULL / elapsed, "calls/s");
+
+    puts("SUCCESS\n");
+
+    return SOLO5_EXIT_SUCCESS;
+}
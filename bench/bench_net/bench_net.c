@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+#include "../../tests/bench.h"
+
+/*
+ * Network benchmark over "service0", which should be attached to a tap or
+ * veth interface on the host.
+ *
+ * "tx" transmits minimum and maximum sized broadcast frames for DURATION ns
+ * each, and reports packet rate and bandwidth. The host discards the frames,
+ * which carry a local experimental EtherType.
+ *
+ * "rx" counts frames sent by a packet generator on the host (see
+ * run-bench.sh). It waits up to START_TIMEOUT ns for the first frame, then
+ * receives until no frame has arrived for IDLE_TIMEOUT ns, and reports
+ * packet rate and bandwidth between the first and last frame received.
+ */
+#define DURATION (500ULL * 1000 * 1000)
+#define START_TIMEOUT (10ULL * 1000 * 1000 * 1000)
+#define IDLE_TIMEOUT (1000ULL * 1000 * 1000)
+#define BATCH 16
+
+#define ETHERTYPE_EXPERIMENTAL 0x88b5
+#define ETHER_MIN_LEN 60
+
+static solo5_handle_t h;
+static struct solo5_net_info ni;
+
+static bool bench_tx(size_t len, const char *pps_metric,
+        const char *mbps_metric)
+{
+    uint8_t frame[len];
+    uint64_t sent = 0;
+    solo5_time_t start = solo5_clock_monotonic(), elapsed;
+
+    memset(frame, 0, len);
+    memset(frame, 0xff, 6);
+    memcpy(frame + 6, ni.mac_address, 6);
+    frame[12] = ETHERTYPE_EXPERIMENTAL >> 8;
+    frame[13] = ETHERTYPE_EXPERIMENTAL & 0xff;
+    do {
+        for (unsigned i = 0; i != BATCH; i++) {
+            if (solo5_net_write(h, frame, len) != SOLO5_R_OK)
+                return false;
+        }
+        sent += BATCH;
+        elapsed = solo5_clock_monotonic() - start;
+    } while (elapsed < DURATION);
+
+    bench_report(pps_metric, sent * 1000000000ULL / elapsed, "packets/s");
+    bench_report(mbps_metric, sent * len * 1000 / elapsed, "MB/s");
+    return true;
+}
+
+static bool bench_rx(void)
+{
+    uint8_t buf[ni.mtu + SOLO5_NET_HLEN];
+    uint64_t received = 0, bytes = 0;
+    solo5_time_t first = 0, last = 0;
+    solo5_time_t deadline = solo5_clock_monotonic() + START_TIMEOUT;
+
+    for (;;) {
+        solo5_handle_set_t ready_set = 0;
+        size_t len;
+
+        solo5_yield(deadline, &ready_set);
+        if (!(ready_set & 1U << h)) {
+            if (solo5_clock_monotonic() >= deadline)
+                break;
+            continue;
+        }
+        /*
+         * Drain all pending frames before yielding again.
+         */
+        solo5_result_t rc;
+        while ((rc = solo5_net_read(h, buf, sizeof buf, &len)) == SOLO5_R_OK) {
+            last = solo5_clock_monotonic();
+            if (received == 0)
+                first = last;
+            received++;
+            bytes += len;
+        }
+        if (rc != SOLO5_R_AGAIN)
+            return false;
+        deadline = last + IDLE_TIMEOUT;
+    }
+
+    if (received < 2) {
+        puts("No frames received\n");
+        return false;
+    }
+    /*
+     * The rate is computed over the interval between the first and last
+     * frame, so the first frame is not counted.
+     */
+    solo5_time_t elapsed = last - first;
+    if (elapsed == 0)
+        elapsed = 1;
+    bench_report("net_rx_pps", (received - 1) * 1000000000ULL / elapsed,
+            "packets/s");
+    bench_report("net_rx_mbps", bytes * 1000 / elapsed, "MB/s");
+    bench_report("net_rx_packets", received, "packets");
+    return true;
+}
+
+int solo5_app_main(const struct solo5_start_info *si)
+{
+    puts("\n**** Solo5 standalone bench_net ****\n\n");
+
+    if (solo5_net_acquire("service0", &h, &ni) != SOLO5_R_OK) {
+        puts("Could not acquire 'service0' network\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+
+    bool ok;
+    if (strcmp(si->cmdline, "tx") == 0)
+        ok = bench_tx(ETHER_MIN_LEN, "net_tx_pps", "net_tx_small_mbps") &&
+            bench_tx(ni.mtu + SOLO5_NET_HLEN, "net_tx_large_pps",
+                    "net_tx_mbps");
+    else if (strcmp(si->cmdline, "rx") == 0)
+        ok = bench_rx();
+    else {
+        puts("Usage: bench_net tx | rx\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+
+    if (!ok) {
+        puts("FAILURE\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+    puts("SUCCESS\n");
+    return SOLO5_EXIT_SUCCESS;
+}
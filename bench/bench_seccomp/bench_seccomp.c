@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+#include "../../tests/bench.h"
+
+/*
+ * System call filter benchmark. Measures the cost of reading a single block,
+ * round robin over all of the block devices "storage0" .. "storageN" declared
+ * in the manifest. On spt, each read is checked by the seccomp filter
+ * installed by the tender, which has rules for each device. Variants of the
+ * guest are built with 1 to 63 devices, see GNUmakefile.
+ *
+ * The metric is reported as PREFIX_blk_read_N_ns, where PREFIX is the guest
+ * command line, so that run-bench.sh can distinguish runs with devices of
+ * identical and of distinct geometry.
+ */
+#define DURATION (200ULL * 1000 * 1000)
+#define BATCH 64
+
+#define MAX_DEVICES 63
+
+int solo5_app_main(const struct solo5_start_info *si)
+{
+    puts("\n**** Solo5 standalone bench_seccomp ****\n\n");
+
+    solo5_handle_t h[MAX_DEVICES];
+    struct solo5_block_info bi[MAX_DEVICES];
+    unsigned ndevices;
+    for (ndevices = 0; ndevices != MAX_DEVICES; ndevices++) {
+        char name[32] = "storage";
+        char buf[21];
+
+        strcpy(name + 7, fmt_u64(ndevices, buf));
+        if (solo5_block_acquire(name, &h[ndevices], &bi[ndevices])
+                != SOLO5_R_OK)
+            break;
+    }
+    if (ndevices == 0) {
+        puts("Could not acquire 'storage0' block device\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+
+    uint8_t block[bi[0].block_size];
+    uint64_t reads = 0;
+    unsigned next = 0;
+    solo5_time_t start = solo5_clock_monotonic(), elapsed;
+    do {
+        for (unsigned i = 0; i != BATCH; i++) {
+            if (solo5_block_read(h[next], 0, block, bi[next].block_size)
+                    != SOLO5_R_OK) {
+                puts("I/O error\n");
+                return SOLO5_EXIT_FAILURE;
+            }
+            next = (next + 1) % ndevices;
+        }
+        reads += BATCH;
+        elapsed = solo5_clock_monotonic() - start;
+    } while (elapsed < DURATION);
+
+    char metric[64], buf[21];
+    size_t len = strlen(si->cmdline);
+    if (len > sizeof metric - 32)
+        len = sizeof metric - 32;
+    memcpy(metric, si->cmdline, len);
+    if (len != 0)
+        metric[len++] = '_';
+    strcpy(metric + len, "blk_read_");
+    len += 9;
+    strcpy(metric + len, fmt_u64(ndevices, buf));
+    len += strlen(metric + len);
+    strcpy(metric + len, "_ns");
+    bench_report(metric, elapsed / reads, "ns");
+
+    puts("SUCCESS\n");
+    return SOLO5_EXIT_SUCCESS;
+}
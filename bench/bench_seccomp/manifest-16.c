@@ -0,0 +1,29 @@
+/* Generated by solo5-elftool version b86f65a-dirty, do not edit */
+
+#define MFT_ENTRIES 17
+#include "mft_abi.h"
+
+MFT1_NOTE_DECLARE_BEGIN
+{
+  .version = MFT_VERSION, .entries = 17,
+  .e = {
+    { .name = "", .type = MFT_RESERVED_FIRST },
+    { .name = "storage0", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage1", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage2", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage3", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage4", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage5", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage6", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage7", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage8", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage9", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage10", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage11", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage12", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage13", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage14", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage15", .type = MFT_DEV_BLOCK_BASIC },
+  }
+}
+MFT1_NOTE_DECLARE_END
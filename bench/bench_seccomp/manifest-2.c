@@ -0,0 +1,15 @@
+/* Generated by solo5-elftool version b86f65a-dirty, do not edit */
+
+#define MFT_ENTRIES 3
+#include "mft_abi.h"
+
+MFT1_NOTE_DECLARE_BEGIN
+{
+  .version = MFT_VERSION, .entries = 3,
+  .e = {
+    { .name = "", .type = MFT_RESERVED_FIRST },
+    { .name = "storage0", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage1", .type = MFT_DEV_BLOCK_BASIC },
+  }
+}
+MFT1_NOTE_DECLARE_END
@@ -0,0 +1,45 @@
+/* Generated by solo5-elftool version b86f65a-dirty, do not edit */
+
+#define MFT_ENTRIES 33
+#include "mft_abi.h"
+
+MFT1_NOTE_DECLARE_BEGIN
+{
+  .version = MFT_VERSION, .entries = 33,
+  .e = {
+    { .name = "", .type = MFT_RESERVED_FIRST },
+    { .name = "storage0", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage1", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage2", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage3", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage4", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage5", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage6", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage7", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage8", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage9", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage10", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage11", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage12", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage13", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage14", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage15", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage16", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage17", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage18", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage19", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage20", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage21", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage22", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage23", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage24", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage25", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage26", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage27", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage28", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage29", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage30", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage31", .type = MFT_DEV_BLOCK_BASIC },
+  }
+}
+MFT1_NOTE_DECLARE_END
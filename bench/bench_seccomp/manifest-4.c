@@ -0,0 +1,17 @@
+/* Generated by solo5-elftool version b86f65a-dirty, do not edit */
+
+#define MFT_ENTRIES 5
+#include "mft_abi.h"
+
+MFT1_NOTE_DECLARE_BEGIN
+{
+  .version = MFT_VERSION, .entries = 5,
+  .e = {
+    { .name = "", .type = MFT_RESERVED_FIRST },
+    { .name = "storage0", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage1", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage2", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage3", .type = MFT_DEV_BLOCK_BASIC },
+  }
+}
+MFT1_NOTE_DECLARE_END
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+#include "../../tests/bench.h"
+
+/*
+ * Yield / wakeup latency benchmark. Repeatedly yields until a deadline
+ * TIMEOUT ns in the future, and measures how late the guest is woken up.
+ */
+#define ITERATIONS 200
+#define TIMEOUT (100ULL * 1000)
+
+int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
+{
+    puts("\n**** Solo5 standalone bench_yield ****\n\n");
+
+    uint64_t total = 0, min = UINT64_MAX, max = 0;
+    for (unsigned i = 0; i != ITERATIONS; i++) {
+        solo5_time_t deadline = solo5_clock_monotonic() + TIMEOUT;
+        solo5_yield(deadline, NULL);
+        solo5_time_t now = solo5_clock_monotonic();
+        /*
+         * An early return (not expected with no devices attached) counts as
+         * no latency.
+         */
+        uint64_t late = now > deadline ? now - deadline : 0;
+
+        total += late;
+        if (late < min)
+            min = late;
+        if (late > max)
+            max = late;
+    }
+
+    bench_report("yield_latency_avg_ns", total / ITERATIONS, "ns");
+    bench_report("yield_latency_min_ns", min, "ns");
+    bench_report("yield_latency_max_ns", max, "ns");
+
+    puts("SUCCESS\n");
+
+    return SOLO5_EXIT_SUCCESS;
+}
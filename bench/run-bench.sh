@@ -0,0 +1,290 @@
+#!/bin/sh
+# Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+#
+# This file is part of Solo5, a sandboxed execution environment.
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose with or without fee is hereby granted, provided
+# that the above copyright notice and this permission notice appear
+# in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+# WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+# AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+# CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+# OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+# NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+# CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#
+# run-bench.sh: Run the Solo5 benchmark suite and report the results as JSON.
+#
+
+die()
+{
+    echo "$0: $@" 1>&2
+    exit 1
+}
+
+usage()
+{
+    cat 1>&2 <<USAGE
+usage: $0 [ OPTIONS ]
+
+Builds and runs the benchmark guests in bench/ on each target, writing the
+results as JSON to standard output.
+
+Options:
+    -t TARGETS
+        Comma-separated list of targets to run on (default: all of hvt and
+        spt which are enabled and usable on this host).
+    -b BENCHES
+        Comma-separated list of benchmarks to run, out of hypercall, clock,
+        yield, blk, seccomp, net and boot (default: all).
+    -B
+        Do not build the benchmark guests first.
+    -r RUNS
+        Number of runs of the boot benchmark (default: 10).
+    -n TAP
+        Also run the network benchmarks over the tap interface TAP, which
+        must be up with an IPv4 address (see tests/setup-tests.sh). The
+        receive benchmark uses ping(8) as the packet generator, and requires
+        root.
+    -o FILE
+        Write the results to FILE instead of standard output.
+USAGE
+    exit 1
+}
+
+TOPDIR=$(cd "$(dirname "$0")/.." && pwd)
+[ -f ${TOPDIR}/Makeconf.sh ] || die "Makeconf.sh not found, run configure.sh"
+. ${TOPDIR}/Makeconf.sh
+
+TARGETS=
+BENCHES=
+BUILD=1
+RUNS=10
+TAP=
+OUTPUT=
+while getopts "ht:b:Br:n:o:" OPT; do
+    case "${OPT}" in
+    t)
+        TARGETS=$(echo "${OPTARG}" | tr ',' ' ')
+        ;;
+    b)
+        BENCHES=" $(echo "${OPTARG}" | tr ',' ' ') "
+        ;;
+    B)
+        BUILD=
+        ;;
+    r)
+        RUNS="${OPTARG}"
+        ;;
+    n)
+        TAP="${OPTARG}"
+        ;;
+    o)
+        OUTPUT="${OPTARG}"
+        ;;
+    *)
+        usage
+        ;;
+    esac
+done
+shift $((OPTIND-1))
+[ $# -eq 0 ] || usage
+
+if [ -z "${TARGETS}" ]; then
+    if [ -n "${CONFIG_HVT_TENDER}" ] && \
+        { [ "${CONFIG_HOST}" != "Linux" ] || [ -w /dev/kvm ]; }; then
+        TARGETS="hvt"
+    fi
+    [ -n "${CONFIG_SPT_TENDER}" ] && TARGETS="${TARGETS} spt"
+fi
+[ -n "${TARGETS}" ] || die "no usable targets"
+for TARGET in ${TARGETS}; do
+    case "${TARGET}" in
+    hvt|spt)
+        [ -x ${TOPDIR}/tenders/${TARGET}/solo5-${TARGET} ] || \
+            die "${TARGET}: tender not found, build Solo5 first"
+        ;;
+    *)
+        die "${TARGET}: not supported, only hvt and spt can be run"
+        ;;
+    esac
+done
+for BENCH in ${BENCHES}; do
+    case "${BENCH}" in
+    hypercall|clock|yield|blk|seccomp|net|boot)
+        ;;
+    *)
+        die "${BENCH}: unknown benchmark"
+        ;;
+    esac
+done
+# The boot benchmark relies on date(1) reporting nanoseconds.
+case "$(date +%N)" in
+*N|"")
+    die "date +%N is not supported on this host"
+    ;;
+esac
+if [ -x "$(command -v timeout)" ]; then
+    TIMEOUT="timeout 120"
+elif [ -x "$(command -v gtimeout)" ]; then
+    TIMEOUT="gtimeout 120"
+else
+    TIMEOUT=
+fi
+
+if [ -n "${BUILD}" ]; then
+    ${MAKE:-make} -C ${TOPDIR}/bench TOPDIR=${TOPDIR} >&2 || die "build failed"
+fi
+
+TMPDIR=$(mktemp -d) || die "mktemp failed"
+trap 'rm -rf "${TMPDIR}"' EXIT
+RESULTS=${TMPDIR}/results
+: >${RESULTS}
+
+# Append a result to RESULTS.
+result()
+{
+    # target bench metric value unit
+    printf '    { "target": "%s", "bench": "%s", "metric": "%s", "value": %s, "unit": "%s" }\n' \
+        "$1" "$2" "$3" "$4" "$5" >>${RESULTS}
+}
+
+# Returns true if benchmark NAME was selected with -b.
+want()
+{
+    [ -z "${BENCHES}" ] || case "${BENCHES}" in *" $1 "*) true;; *) false;; esac
+}
+
+# Run bench_NAME on TARGET with tender options and guest arguments, and
+# record the "BENCH metric value unit" lines it reports.
+run_guest()
+{
+    NAME=$1
+    shift
+    IMAGE=${TOPDIR}/bench/bench_${NAME}/bench_${NAME}.${TARGET}
+    OUT=${TMPDIR}/${TARGET}-${NAME}.out
+
+    echo "${TARGET}: ${NAME}" >&2
+    if ! ${TIMEOUT} ${TENDER} --mem=32 "$@" >${OUT} 2>&1 ||
+            ! grep -q '^SUCCESS' ${OUT}; then
+        cat ${OUT} >&2
+        die "${TARGET}: bench_${NAME} failed"
+    fi
+    sed -n 's/^BENCH //p' ${OUT} | while read METRIC VALUE UNIT; do
+        result ${TARGET} ${NAME} ${METRIC} ${VALUE} "${UNIT}"
+    done
+}
+
+# Run IMAGE of bench_boot RUNS times, and record the average and minimum
+# time from exec of the tender to solo5_app_main() as METRIC.
+run_boot()
+{
+    METRIC=$1
+    IMAGE=$2
+    TOTAL=0
+    MIN=
+    i=0
+
+    echo "${TARGET}: boot (${METRIC})" >&2
+    while [ ${i} -lt ${RUNS} ]; do
+        START=$(date +%s%N)
+        RUN_OUTPUT=$(${TIMEOUT} ${TENDER} --mem=32 -- ${IMAGE} 2>&1) || \
+            die "${TARGET}: ${IMAGE}: run failed"
+        REACHED=$(echo "${RUN_OUTPUT}" | sed -n 's/^app_main reached at: //p')
+        [ -n "${REACHED}" ] || die "${TARGET}: ${IMAGE}: no timestamp in output"
+        DELTA=$(( (REACHED - START) / 1000 ))
+        TOTAL=$((TOTAL + DELTA))
+        if [ -z "${MIN}" ] || [ ${DELTA} -lt ${MIN} ]; then
+            MIN=${DELTA}
+        fi
+        i=$((i + 1))
+    done
+    result ${TARGET} boot ${METRIC}_us $((TOTAL / RUNS)) us
+    result ${TARGET} boot ${METRIC}_min_us ${MIN} us
+}
+
+for TARGET in ${TARGETS}; do
+    TENDER=${TOPDIR}/tenders/${TARGET}/solo5-${TARGET}
+
+    want hypercall && run_guest hypercall -- \
+        ${TOPDIR}/bench/bench_hypercall/bench_hypercall.${TARGET}
+    want clock && run_guest clock -- \
+        ${TOPDIR}/bench/bench_clock/bench_clock.${TARGET}
+    want yield && run_guest yield -- \
+        ${TOPDIR}/bench/bench_yield/bench_yield.${TARGET}
+
+    if want blk; then
+        BLOCK=${TMPDIR}/storage.img
+        dd if=/dev/zero of=${BLOCK} bs=1M count=16 status=none || \
+            die "could not create ${BLOCK}"
+        run_guest blk --block:storage=${BLOCK} -- \
+            ${TOPDIR}/bench/bench_blk/bench_blk.${TARGET}
+        rm -f ${BLOCK}
+    fi
+
+    # The cost of a block read as the number of devices grows, with devices
+    # of identical geometry (grouped) and of distinct geometry. Only spt
+    # filters system calls made by the guest.
+    if [ "${TARGET}" = "spt" ] && want seccomp; then
+        for N in 1 2 4 8 16 32 63; do
+            for MODE in grouped distinct; do
+                DEVS=
+                i=0
+                while [ ${i} -lt ${N} ]; do
+                    BLOCKS=8
+                    [ "${MODE}" = "distinct" ] && BLOCKS=$((8 + i))
+                    dd if=/dev/zero of=${TMPDIR}/storage${i}.img bs=512 \
+                        count=${BLOCKS} status=none || \
+                        die "could not create ${TMPDIR}/storage${i}.img"
+                    DEVS="${DEVS} --block:storage${i}=${TMPDIR}/storage${i}.img"
+                    i=$((i + 1))
+                done
+                run_guest seccomp ${DEVS} -- \
+                    ${TOPDIR}/bench/bench_seccomp/bench_seccomp-${N}.spt ${MODE}
+            done
+        done
+        rm -f ${TMPDIR}/storage*.img
+    fi
+
+    if [ -n "${TAP}" ] && want net; then
+        run_guest net --net:service0=${TAP} -- \
+            ${TOPDIR}/bench/bench_net/bench_net.${TARGET} tx
+        BRD=$(ip -4 -o addr show dev ${TAP} | \
+            sed -n 's/.* brd \([0-9.]*\).*/\1/p')
+        [ -n "${BRD}" ] || die "${TAP}: no IPv4 broadcast address"
+        # Start the generator once the guest is up and waiting.
+        ( sleep 2; ping -q -b -i 0 -c 100000 -s 1400 ${BRD} >/dev/null 2>&1 ) &
+        run_guest net --net:service0=${TAP} -- \
+            ${TOPDIR}/bench/bench_net/bench_net.${TARGET} rx
+        wait
+    fi
+
+    if want boot; then
+        ELF=${TOPDIR}/bench/bench_boot/bench_boot.${TARGET}
+        PRELINKED=${TMPDIR}/bench_boot.${TARGET}.pli
+        ${TOPDIR}/elftool/solo5-elftool prelink ${ELF} ${PRELINKED} || \
+            die "${TARGET}: prelink failed"
+        run_boot boot_elf ${ELF}
+        run_boot boot_prelinked ${PRELINKED}
+    fi
+done
+
+VERSION=$(sed -n 's/^#define SOLO5_VERSION "\(.*\)"$/\1/p' \
+    ${TOPDIR}/include/version.h)
+{
+    echo "{"
+    echo "  \"type\": \"solo5.bench\","
+    echo "  \"version\": 1,"
+    echo "  \"solo5_version\": \"${VERSION}\","
+    echo "  \"host\": \"$(uname -srm)\","
+    echo "  \"date\": \"$(date -u +%Y-%m-%dT%H:%M:%SZ)\","
+    echo "  \"results\": ["
+    sed '$!s/$/,/' ${RESULTS}
+    echo "  ]"
+    echo "}"
+} >${OUTPUT:-/dev/stdout}
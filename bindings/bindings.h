@@ -90,6 +90,16 @@ void mem_init(void);
 void *mem_ialloc_pages(size_t num);
 void mem_lock_heap(uintptr_t *start, size_t *size);
 
+/* net_offload.c: network offload metadata */
+bool net_offload_is_none(const struct solo5_net_offload *offload);
+/*
+ * Computes any checksum requested by (*offload) for the received packet
+ * (buf, len), for delivery without offload metadata. Returns false if the
+ * packet must be dropped instead.
+ */
+bool net_offload_resolve(const struct solo5_net_offload *offload,
+        uint8_t *buf, size_t len);
+
 /* lib.c: minimal bits of stdc we need */
 void *memset(void *dest, int c, size_t n);
 void *memcpy(void *restrict dest, const void *restrict src, size_t n);
@@ -111,6 +121,8 @@ uint64_t platform_mem_size(void);
 void platform_exit(int status, void *cookie) __attribute__((noreturn));
 int platform_puts(const char *buf, int n);
 int platform_set_tls_base(uint64_t base);
+int platform_mem_release(uintptr_t start, size_t size);
+int platform_mem_reuse(uintptr_t start, size_t size);
 
 /* platform_intr.c: platform-specific interrupt handling */
 void platform_intr_init(void);
@@ -158,11 +158,26 @@ static void tss_init(void)
     __asm__ __volatile__("ltr %0" :: "r" ((unsigned short)(GDT_DESC_TSS_LO * 8)));
 }
 
+bool cpu_fsgsbase;
+
+/*
+ * CR4.FSGSBASE is enabled by the tender (hvt) or bootstrap (virtio, xen) if
+ * the CPU supports it. Until cpu_init() has run, TLS is set using WRMSR.
+ */
+static void fsgsbase_init(void)
+{
+    uint64_t cr4;
+
+    __asm__ __volatile__("mov %%cr4, %0" : "=r" (cr4));
+    cpu_fsgsbase = (cr4 & X86_CR4_FSGSBASE) != 0;
+}
+
 void cpu_init(void)
 {
     gdt_init();
     tss_init();
     idt_init();
+    fsgsbase_init();
 }
 
 static char *traps[32] = {
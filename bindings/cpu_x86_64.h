@@ -61,6 +61,14 @@
 #define X86_CR4_OSXMMEXCPT      _BITUL(X86_CR4_OSXMMEXCPT_BIT)
 #define X86_CR4_VMXE_BIT        13 /* VMX enabled */
 #define X86_CR4_VMXE            _BITUL(X86_CR4_VMXE_BIT)
+#define X86_CR4_FSGSBASE_BIT    16 /* Enable {RD,WR}{FS,GS}BASE */
+#define X86_CR4_FSGSBASE        _BITUL(X86_CR4_FSGSBASE_BIT)
+
+/*
+ * CPUID leaf 7 (structured extended features), sub-leaf 0, EBX
+ */
+#define X86_CPUID7_EBX_FSGSBASE_BIT 0
+#define X86_CPUID7_EBX_FSGSBASE _BITUL(X86_CPUID7_EBX_FSGSBASE_BIT)
 
 /*
  * Intel CPU features in EFER
@@ -238,8 +246,18 @@ static inline uint64_t inq(uint16_t port_lo)
     return ((uint64_t)lo) | ((uint64_t)hi << 32);
 }
 
+/*
+ * True if CR4.FSGSBASE is set, and WRFSBASE can be used instead of the
+ * (serializing, and possibly trapping) WRMSR to set the TLS base.
+ */
+extern bool cpu_fsgsbase;
+
 static inline void cpu_set_tls_base(uint64_t base)
 {
+    if (cpu_fsgsbase) {
+        __asm__ __volatile__("wrfsbase %0" :: "r" (base));
+        return;
+    }
      __asm__ __volatile("wrmsr" ::
          "c" (0xc0000100), /* IA32_FS_BASE */
          "a" ((uint32_t)(base)),
@@ -88,6 +88,45 @@ solo5_result_t solo5_block_read(solo5_handle_t handle, solo5_off_t offset,
     return rd.ret;
 }
 
+solo5_result_t solo5_block_map(solo5_handle_t handle,
+        const uint8_t **addr __attribute__((unused)))
+{
+    const struct mft_entry *e =
+        mft_get_by_index(mft, handle, MFT_DEV_BLOCK_BASIC);
+    if (e == NULL)
+        return SOLO5_R_EINVAL;
+
+    /*
+     * Block devices are not mapped into guest memory on hvt.
+     */
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_block_submit(solo5_handle_t handle,
+        struct solo5_block_request *req __attribute__((unused)))
+{
+    const struct mft_entry *e =
+        mft_get_by_index(mft, handle, MFT_DEV_BLOCK_BASIC);
+    if (e == NULL)
+        return SOLO5_R_EINVAL;
+
+    /*
+     * Block I/O hypercalls are synchronous on hvt.
+     */
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_block_complete(solo5_handle_t handle,
+        struct solo5_block_request **req __attribute__((unused)))
+{
+    const struct mft_entry *e =
+        mft_get_by_index(mft, handle, MFT_DEV_BLOCK_BASIC);
+    if (e == NULL)
+        return SOLO5_R_EINVAL;
+
+    return SOLO5_R_EUNSPEC;
+}
+
 solo5_result_t solo5_block_acquire(const char *name, solo5_handle_t *handle,
         struct solo5_block_info *info)
 {
@@ -22,14 +22,70 @@
 
 static const struct mft *mft;
 
-solo5_result_t solo5_net_write(solo5_handle_t handle, const uint8_t *buf,
+/*
+ * TX rings registered with the tender, indexed by handle. NULL if the tender
+ * has not enabled asynchronous transmit for the device.
+ */
+static struct hvt_net_txring *txrings[MFT_MAX_ENTRIES];
+
+/*
+ * Queue the frame (buf, size) on the TX ring (ring) for network device
+ * (handle). Returns false if the frame does not fit.
+ */
+static bool txring_write(struct hvt_net_txring *ring, solo5_handle_t handle,
+        const uint8_t *buf, size_t size)
+{
+    uint32_t prod = ring->prod;
+
+    if (size > HVT_NET_TXRING_FRAME_SIZE ||
+            prod - __atomic_load_n(&ring->cons, __ATOMIC_ACQUIRE) ==
+            HVT_NET_TXRING_SLOTS)
+        return false;
+
+    unsigned slot = prod % HVT_NET_TXRING_SLOTS;
+    memcpy(ring->frame[slot], buf, size);
+    ring->len[slot] = size;
+    __atomic_store_n(&ring->prod, prod + 1, __ATOMIC_RELEASE);
+
+    /*
+     * Pairs with the tender setting (kick) and then re-checking (prod) before
+     * it goes to sleep.
+     */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&ring->kick, __ATOMIC_RELAXED))
+        hvt_do_hypercall(HVT_HYPERCALL_NET_NOTIFY,
+                (volatile void *)(uintptr_t)handle);
+    return true;
+}
+
+static bool offload_enabled(solo5_handle_t handle)
+{
+    const struct mft_entry *e =
+        mft_get_by_index(mft, handle, MFT_DEV_NET_BASIC);
+    return e != NULL && e->u.net_basic.offload;
+}
+
+solo5_result_t solo5_net_write_offload(solo5_handle_t handle,
+        const struct solo5_net_offload *offload, const uint8_t *buf,
         size_t size)
 {
+    bool none = net_offload_is_none(offload);
+
+    if (!none && !offload_enabled(handle))
+        return SOLO5_R_EINVAL;
+    /*
+     * The TX ring does not carry offload metadata.
+     */
+    if (none && handle < MFT_MAX_ENTRIES && txrings[handle] != NULL &&
+            txring_write(txrings[handle], handle, buf, size))
+        return SOLO5_R_OK;
+
     volatile struct hvt_hc_net_write wr;
 
     wr.handle = handle;
     wr.data = buf;
     wr.len = size;
+    wr.offload = none ? NULL : offload;
     wr.ret = 0;
 
     hvt_do_hypercall(HVT_HYPERCALL_NET_WRITE, &wr);
@@ -37,22 +93,47 @@ solo5_result_t solo5_net_write(solo5_handle_t handle, const uint8_t *buf,
     return wr.ret;
 }
 
-solo5_result_t solo5_net_read(solo5_handle_t handle, uint8_t *buf, size_t size,
+solo5_result_t solo5_net_write(solo5_handle_t handle, const uint8_t *buf,
+        size_t size)
+{
+    static const struct solo5_net_offload none = { 0 };
+
+    return solo5_net_write_offload(handle, &none, buf, size);
+}
+
+solo5_result_t solo5_net_read_offload(solo5_handle_t handle,
+        struct solo5_net_offload *offload, uint8_t *buf, size_t size,
         size_t *read_size)
 {
     volatile struct hvt_hc_net_read rd;
+    bool enabled = offload_enabled(handle);
 
     rd.handle = handle;
     rd.data = buf;
+    rd.offload = enabled ? offload : NULL;
     rd.len = size;
     rd.ret = 0;
 
     hvt_do_hypercall(HVT_HYPERCALL_NET_READ, &rd);
 
+    if (!enabled)
+        memset(offload, 0, sizeof *offload);
     *read_size = rd.len;
     return rd.ret;
 }
 
+solo5_result_t solo5_net_read(solo5_handle_t handle, uint8_t *buf, size_t size,
+        size_t *read_size)
+{
+    struct solo5_net_offload offload;
+    solo5_result_t rc;
+
+    rc = solo5_net_read_offload(handle, &offload, buf, size, read_size);
+    if (rc == SOLO5_R_OK && !net_offload_resolve(&offload, buf, *read_size))
+        return SOLO5_R_AGAIN;
+    return rc;
+}
+
 solo5_result_t solo5_net_acquire(const char *name, solo5_handle_t *handle,
         struct solo5_net_info *info)
 {
@@ -65,12 +146,43 @@ solo5_result_t solo5_net_acquire(const char *name, solo5_handle_t *handle,
 
     *handle = index;
     info->mtu = e->u.net_basic.mtu;
+    info->offload = e->u.net_basic.offload;
     memcpy(info->mac_address, e->u.net_basic.mac,
             sizeof info->mac_address);
     return SOLO5_R_OK;
 }
 
+/*
+ * Register a TX ring for the network device at manifest index (index), if the
+ * tender supports asynchronous transmit for it.
+ */
+static void txring_init(unsigned index)
+{
+    volatile struct hvt_hc_net_txring tr;
+
+    tr.handle = index;
+    tr.ring = NULL;
+    tr.ret = 0;
+    hvt_do_hypercall(HVT_HYPERCALL_NET_TXRING, &tr);
+    if (tr.ret != SOLO5_R_OK)
+        return;
+
+    size_t pgs = ((sizeof (struct hvt_net_txring) - 1) >> PAGE_SHIFT) + 1;
+    struct hvt_net_txring *ring = mem_ialloc_pages(pgs);
+
+    tr.ring = ring;
+    tr.ret = 0;
+    hvt_do_hypercall(HVT_HYPERCALL_NET_TXRING, &tr);
+    assert(tr.ret == SOLO5_R_OK);
+    txrings[index] = ring;
+}
+
 void net_init(const struct hvt_boot_info *bi)
 {
     mft = bi->mft;
+
+    for (unsigned i = 0; i != mft->entries; i++) {
+        if (mft->e[i].type == MFT_DEV_NET_BASIC && mft->e[i].attached)
+            txring_init(i);
+    }
 }
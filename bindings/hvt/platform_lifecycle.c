@@ -35,3 +35,26 @@ void platform_exit(int status, void *cookie)
     hvt_do_hypercall(HVT_HYPERCALL_HALT, &h);
     for(;;);
 }
+
+static int mem_advise(uintptr_t start, size_t size, int advice)
+{
+    volatile struct hvt_hc_mem_advise a;
+
+    a.addr = (void *)start;
+    a.len = size;
+    a.advice = advice;
+    a.ret = 0;
+
+    hvt_do_hypercall(HVT_HYPERCALL_MEM_ADVISE, &a);
+    return a.ret;
+}
+
+int platform_mem_release(uintptr_t start, size_t size)
+{
+    return mem_advise(start, size, HVT_MEM_ADVISE_RELEASE);
+}
+
+int platform_mem_reuse(uintptr_t start, size_t size)
+{
+    return mem_advise(start, size, HVT_MEM_ADVISE_REUSE);
+}
@@ -20,7 +20,11 @@
 
 #include "bindings.h"
 
-#define MAX_IRQ_HANDLER_ENTRIES 8
+/*
+ * PCI devices share a small number of legacy interrupt lines, so a single
+ * IRQ may need a handler for each device in the manifest.
+ */
+#define MAX_IRQ_HANDLER_ENTRIES MFT_MAX_ENTRIES
 
 struct irq_handler {
     int (*handler)(void *);
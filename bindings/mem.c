@@ -81,3 +81,48 @@ void *mem_ialloc_pages(size_t num)
 
     return (void *)prev;
 }
+
+/*
+ * Validates that (start, size) lies within the application heap, and trims
+ * it to the whole pages it covers. Returns 0 and the trimmed range in
+ * (*pstart, *psize), or -1 if the range is invalid.
+ */
+static int mem_heap_range(uintptr_t start, size_t size, uintptr_t *pstart,
+        size_t *psize)
+{
+    uint64_t mem_size = platform_mem_size();
+    uintptr_t end;
+
+    if (!mem_locked)
+        return -1;
+    if (start < heap_start || start > mem_size || size > mem_size - start)
+        return -1;
+
+    end = (start + size) & PAGE_MASK;
+    start = (start + PAGE_SIZE - 1) & PAGE_MASK;
+    *pstart = start;
+    *psize = (end > start) ? end - start : 0;
+    return 0;
+}
+
+solo5_result_t solo5_mem_release(uintptr_t start, size_t size)
+{
+    if (mem_heap_range(start, size, &start, &size) != 0)
+        return SOLO5_R_EINVAL;
+    if (size == 0)
+        return SOLO5_R_OK;
+
+    int rc = platform_mem_release(start, size);
+    return (rc == 0) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_mem_reuse(uintptr_t start, size_t size)
+{
+    if (mem_heap_range(start, size, &start, &size) != 0)
+        return SOLO5_R_EINVAL;
+    if (size == 0)
+        return SOLO5_R_OK;
+
+    int rc = platform_mem_reuse(start, size);
+    return (rc == 0) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
+}
@@ -43,6 +43,25 @@ solo5_result_t solo5_block_read(solo5_handle_t handle __attribute__((unused)),
     return SOLO5_R_EUNSPEC;
 }
 
+solo5_result_t solo5_block_map(solo5_handle_t handle __attribute__((unused)),
+        const uint8_t **addr __attribute__((unused)))
+{
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_block_submit(solo5_handle_t handle __attribute__((unused)),
+        struct solo5_block_request *req __attribute__((unused)))
+{
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_block_complete(
+        solo5_handle_t handle __attribute__((unused)),
+        struct solo5_block_request **req __attribute__((unused)))
+{
+    return SOLO5_R_EUNSPEC;
+}
+
 void block_init(const struct hvt_boot_info *bi __attribute__((unused)))
 {
 }
@@ -92,6 +92,23 @@ solo5_result_t solo5_net_read(solo5_handle_t handle,
     }
 }
 
+solo5_result_t solo5_net_write_offload(solo5_handle_t handle,
+        const struct solo5_net_offload *offload, const uint8_t *buf,
+        size_t size)
+{
+    if (!net_offload_is_none(offload))
+        return SOLO5_R_EINVAL;
+    return solo5_net_write(handle, buf, size);
+}
+
+solo5_result_t solo5_net_read_offload(solo5_handle_t handle,
+        struct solo5_net_offload *offload, uint8_t *buf, size_t size,
+        size_t *read_size)
+{
+    memset(offload, 0, sizeof *offload);
+    return solo5_net_read(handle, buf, size, read_size);
+}
+
 solo5_result_t solo5_net_acquire(const char *name, solo5_handle_t *h,
         struct solo5_net_info *info)
 {
@@ -217,6 +234,7 @@ static bool muen_net_dev_init(const char *name, struct muen_net_device *device,
              device->mac_addr[3], device->mac_addr[4], device->mac_addr[5]);
     memcpy(info->mac_address, device->mac_addr, sizeof info->mac_address);
     info->mtu = 1500;
+    info->offload = false;
     log(INFO, "Solo5: Net: '%s': Using MAC address %s\n", name, mac_str);
     return true;
 }
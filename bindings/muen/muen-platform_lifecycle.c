@@ -50,3 +50,19 @@ void platform_exit(int status __attribute__((unused)),
     __asm__ __volatile__("cli; hlt");
     for (;;);
 }
+
+/*
+ * Returning memory to the host is not supported on this target. As
+ * solo5_mem_release() is advisory, succeed without doing anything.
+ */
+int platform_mem_release(uintptr_t start __attribute__((unused)),
+        size_t size __attribute__((unused)))
+{
+    return 0;
+}
+
+int platform_mem_reuse(uintptr_t start __attribute__((unused)),
+        size_t size __attribute__((unused)))
+{
+    return 0;
+}
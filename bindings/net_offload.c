@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * net_offload.c: Common network offload metadata handling.
+ */
+
+#include "bindings.h"
+
+_Static_assert(sizeof (struct solo5_net_offload) == 10,
+        "struct solo5_net_offload must match struct virtio_net_hdr");
+
+bool net_offload_is_none(const struct solo5_net_offload *offload)
+{
+    return offload->flags == 0 && offload->gso_type == SOLO5_NET_GSO_NONE;
+}
+
+bool net_offload_resolve(const struct solo5_net_offload *offload,
+        uint8_t *buf, size_t len)
+{
+    if (offload->gso_type != SOLO5_NET_GSO_NONE)
+        return false;
+    if (!(offload->flags & SOLO5_NET_OFFLOAD_F_NEEDS_CSUM))
+        return true;
+
+    size_t start = offload->csum_start;
+    size_t pos = start + offload->csum_offset;
+    if (pos + 2 > len)
+        return false;
+
+    /*
+     * The checksum field already holds the pseudo-header checksum, so this is
+     * the usual Internet checksum over (start, len).
+     */
+    uint32_t sum = 0;
+    size_t i;
+    for (i = start; i + 1 < len; i += 2)
+        sum += (buf[i] << 8) | buf[i + 1];
+    if (i < len)
+        sum += buf[i] << 8;
+    while (sum >> 16)
+        sum = (sum & 0xffff) + (sum >> 16);
+    uint16_t csum = ~sum & 0xffff;
+    if (csum == 0)
+        csum = 0xffff;
+    buf[pos] = csum >> 8;
+    buf[pos + 1] = csum & 0xff;
+    return true;
+}
@@ -48,3 +48,65 @@ solo5_time_t solo5_clock_wall(void)
 }
 
 /* solo5_set_tls_base is in tls.c */
+
+bool rate_take(struct rate_limit *rates, solo5_handle_t handle, size_t len)
+{
+    if (rates == NULL || !rate_limit_enabled(&rates[handle]))
+        return true;
+    return rate_limit_take(&rates[handle], solo5_clock_monotonic(), len);
+}
+
+void rate_report(const struct mft *mft, struct rate_limit *rates)
+{
+    if (rates == NULL)
+        return;
+
+    for (unsigned i = 0; i != mft->entries; i++) {
+        struct rate_limit *rl = &rates[i];
+        if (!rate_limit_enabled(rl))
+            continue;
+        if (rl->throttled_since != 0) {
+            rl->throttled_ns += solo5_clock_monotonic() - rl->throttled_since;
+            rl->throttled_since = 0;
+        }
+        log(INFO, "Solo5: %s: throttled %llu times for %llu.%03llu s\n",
+                mft->e[i].name, (unsigned long long)rl->throttled,
+                (unsigned long long)(rl->throttled_ns / NSEC_PER_SEC),
+                (unsigned long long)(rl->throttled_ns % NSEC_PER_SEC) /
+                1000000ULL);
+    }
+}
+
+void capture_put(struct capture_ring **rings, solo5_handle_t handle,
+        uint32_t dir, const uint8_t *buf, size_t len)
+{
+    if (rings == NULL || rings[handle] == NULL)
+        return;
+    capture_ring_put(rings[handle], dir, solo5_clock_wall(), buf, len);
+}
+
+void capture_stop(const struct mft *mft, struct capture_ring **rings)
+{
+    if (rings == NULL)
+        return;
+
+    for (unsigned i = 0; i != mft->entries; i++) {
+        struct capture_ring *r = rings[i];
+        if (r == NULL)
+            continue;
+        /*
+         * The tender's capture helper polls the ring, give it up to a second
+         * to write out the remaining frames.
+         */
+        __atomic_store_n(&r->stop, 1, __ATOMIC_RELEASE);
+        solo5_time_t deadline = solo5_clock_monotonic() + NSEC_PER_SEC;
+        while (!__atomic_load_n(&r->stopped, __ATOMIC_ACQUIRE) &&
+                solo5_clock_monotonic() < deadline)
+            solo5_yield(solo5_clock_monotonic() + 10000000ULL, NULL);
+        uint64_t tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+        uint64_t dropped = __atomic_load_n(&r->dropped, __ATOMIC_RELAXED);
+        log(INFO, "Solo5: %s: Captured %llu frames, %llu dropped\n",
+                mft->e[i].name, (unsigned long long)tail,
+                (unsigned long long)dropped);
+    }
+}
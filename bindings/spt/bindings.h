@@ -38,6 +38,23 @@ long sys_write(long fd, const void *buf, long size);
 long sys_pread64(long fd, void *buf, long size, long pos);
 long sys_pwrite64(long fd, const void *buf, long size, long pos);
 
+struct sys_iovec {
+    void *base;
+    long len;
+};
+
+long sys_readv(long fd, const struct sys_iovec *iov, long iovcnt);
+long sys_writev(long fd, const struct sys_iovec *iov, long iovcnt);
+
+#define SYS_MADV_DONTNEED 4
+
+long sys_madvise(void *addr, long len, long advice);
+
+#define SYS_MSG_DONTWAIT 0x40
+
+long sys_sendto(long fd, const void *buf, long len, long flags,
+        const void *addr, long addrlen);
+
 void sys_exit_group(long status) __attribute__((noreturn));
 
 struct sys_timespec {
@@ -86,4 +103,28 @@ long sys_arch_prctl(long code, long addr);
 void block_init(struct spt_boot_info *arg);
 void net_init(struct spt_boot_info *arg);
 
+/*
+ * Returns true if an operation of (len) bytes on the device (handle) may
+ * proceed under the rate limits (rates) set by the tender, or NULL if none.
+ */
+bool rate_take(struct rate_limit *rates, solo5_handle_t handle, size_t len);
+
+/*
+ * Log statistics on the time devices limited by (rates) have been throttled.
+ */
+void rate_report(const struct mft *mft, struct rate_limit *rates);
+
+/*
+ * Capture the frame (buf, len) travelling in direction (dir) on the device
+ * (handle) if capture rings (rings) have been set up by the tender.
+ */
+void capture_put(struct capture_ring **rings, solo5_handle_t handle,
+        uint32_t dir, const uint8_t *buf, size_t len);
+
+/*
+ * Wait for the tender to write out all frames captured into (rings), and log
+ * statistics.
+ */
+void capture_stop(const struct mft *mft, struct capture_ring **rings);
+
 #endif /* __SPT_BINDINGS_H__ */
@@ -21,10 +21,23 @@
 #include "bindings.h"
 
 static const struct mft *mft;
+static struct rate_limit *block_rate;
+static struct overlay_dev **block_overlay;
+static const uint8_t **block_map;
+static struct compress_dev **block_compressed;
 
 void block_init(struct spt_boot_info *bi)
 {
     mft = bi->mft;
+    block_rate = bi->block_rate;
+    block_overlay = bi->block_overlay;
+    block_map = bi->block_map;
+    block_compressed = bi->block_compressed;
+}
+
+static long compressed_pread(int fd, void *buf, size_t len, uint64_t off)
+{
+    return sys_pread64(fd, buf, len, off);
 }
 
 solo5_result_t solo5_block_acquire(const char *name, solo5_handle_t *handle,
@@ -61,8 +74,29 @@ solo5_result_t solo5_block_read(solo5_handle_t handle, solo5_off_t offset,
         return SOLO5_R_EINVAL;
     if(offset > (e->u.block_basic.capacity - e->u.block_basic.block_size))
         return SOLO5_R_EINVAL;
+    if (!rate_take(block_rate, handle, size))
+        return SOLO5_R_AGAIN;
+
+    if (block_map != NULL && block_map[handle] != NULL) {
+        memcpy(buf, block_map[handle] + offset, size);
+        return SOLO5_R_OK;
+    }
+    if (block_compressed != NULL && block_compressed[handle] != NULL)
+        return (compress_read(block_compressed[handle], buf, size, offset,
+                    compressed_pread) == 0) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
+
+    long nbytes;
+    if (block_overlay != NULL && block_overlay[handle] != NULL) {
+        struct overlay_dev *o = block_overlay[handle];
 
-    long nbytes = sys_pread64(e->b.hostfd, (char *)buf, size, offset);
+        if (overlay_is_allocated(o->bitmap, offset / o->block_size))
+            nbytes = sys_pread64(o->delta_fd, (char *)buf, size,
+                    o->data_offset + offset);
+        else
+            nbytes = sys_pread64(o->base_fd, (char *)buf, size, offset);
+    }
+    else
+        nbytes = sys_pread64(e->b.hostfd, (char *)buf, size, offset);
 
     return (nbytes == (int)size) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
 }
@@ -85,8 +119,59 @@ solo5_result_t solo5_block_write(solo5_handle_t handle, solo5_off_t offset,
         return SOLO5_R_EINVAL;
     if(offset > (e->u.block_basic.capacity - e->u.block_basic.block_size))
         return SOLO5_R_EINVAL;
+    if (block_map != NULL && block_map[handle] != NULL)
+        return SOLO5_R_EINVAL;
+    if (block_compressed != NULL && block_compressed[handle] != NULL)
+        return SOLO5_R_EINVAL;
+    if (!rate_take(block_rate, handle, size))
+        return SOLO5_R_AGAIN;
 
-    long nbytes = sys_pwrite64(e->b.hostfd, (const char *)buf, size, offset);
+    long nbytes;
+    if (block_overlay != NULL && block_overlay[handle] != NULL) {
+        struct overlay_dev *o = block_overlay[handle];
+
+        nbytes = sys_pwrite64(o->delta_fd, (const char *)buf, size,
+                o->data_offset + offset);
+        if (nbytes == (int)size)
+            overlay_set_allocated(o->bitmap, offset / o->block_size);
+    }
+    else
+        nbytes = sys_pwrite64(e->b.hostfd, (const char *)buf, size, offset);
 
     return (nbytes == (int)size) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
 }
+
+solo5_result_t solo5_block_map(solo5_handle_t handle, const uint8_t **addr)
+{
+    const struct mft_entry *e =
+        mft_get_by_index(mft, handle, MFT_DEV_BLOCK_BASIC);
+    if (e == NULL)
+        return SOLO5_R_EINVAL;
+    if (block_map == NULL || block_map[handle] == NULL)
+        return SOLO5_R_EUNSPEC;
+
+    *addr = block_map[handle];
+    return SOLO5_R_OK;
+}
+
+solo5_result_t solo5_block_submit(solo5_handle_t handle,
+        struct solo5_block_request *req __attribute__((unused)))
+{
+    const struct mft_entry *e =
+        mft_get_by_index(mft, handle, MFT_DEV_BLOCK_BASIC);
+    if (e == NULL)
+        return SOLO5_R_EINVAL;
+
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_block_complete(solo5_handle_t handle,
+        struct solo5_block_request **req __attribute__((unused)))
+{
+    const struct mft_entry *e =
+        mft_get_by_index(mft, handle, MFT_DEV_BLOCK_BASIC);
+    if (e == NULL)
+        return SOLO5_R_EINVAL;
+
+    return SOLO5_R_EUNSPEC;
+}
@@ -24,12 +24,20 @@ static const struct mft *mft;
 static int epollfd;
 static int npollfds;
 static int timerfd;
+static struct xdp_port **net_xdp;
+static struct shm_net_port **net_shm;
+static struct rate_limit *net_rate;
+static struct capture_ring **net_capture;
 
 void net_init(struct spt_boot_info *bi)
 {
     mft = bi->mft;
     epollfd = bi->epollfd;
     timerfd = bi->timerfd;
+    net_xdp = bi->net_xdp;
+    net_shm = bi->net_shm;
+    net_rate = bi->net_rate;
+    net_capture = bi->net_capture;
 
     npollfds = 0;
     for (unsigned i = 0; i != mft->entries; i++) {
@@ -50,12 +58,14 @@ solo5_result_t solo5_net_acquire(const char *name, solo5_handle_t *handle,
 
     *handle = index;
     info->mtu = e->u.net_basic.mtu;
+    info->offload = e->u.net_basic.offload;
     memcpy(info->mac_address, e->u.net_basic.mac,
             sizeof info->mac_address);
     return SOLO5_R_OK;
 }
 
-solo5_result_t solo5_net_read(solo5_handle_t handle, uint8_t *buf, size_t size,
+static solo5_result_t net_read_offload(solo5_handle_t handle,
+        struct solo5_net_offload *offload, uint8_t *buf, size_t size,
         size_t *read_size)
 {
     const struct mft_entry *e =
@@ -63,6 +73,60 @@ solo5_result_t solo5_net_read(solo5_handle_t handle, uint8_t *buf, size_t size,
     if (e == NULL)
         return SOLO5_R_EINVAL;
 
+    if (e->u.net_basic.offload) {
+        struct sys_iovec iov[2] = {
+            { .base = offload, .len = sizeof *offload },
+            { .base = buf, .len = size }
+        };
+        long nbytes = sys_readv(e->b.hostfd, iov, 2);
+        if (nbytes < 0) {
+            if (nbytes == SYS_EAGAIN)
+                return SOLO5_R_AGAIN;
+            else
+                return SOLO5_R_EUNSPEC;
+        }
+        /*
+         * The host returns the full length of a packet which has been
+         * truncated to fit, drop such packets.
+         */
+        if ((size_t)nbytes < sizeof *offload ||
+                (size_t)nbytes - sizeof *offload > size)
+            return SOLO5_R_AGAIN;
+
+        *read_size = (size_t)nbytes - sizeof *offload;
+        return SOLO5_R_OK;
+    }
+    memset(offload, 0, sizeof *offload);
+
+    if (net_xdp != NULL && net_xdp[handle] != NULL) {
+        /*
+         * AF_XDP: receive directly from the RX ring, no system call needed.
+         */
+        size_t nbytes = xdp_port_read(net_xdp[handle], buf, size);
+        if (nbytes == 0)
+            return SOLO5_R_AGAIN;
+        *read_size = nbytes;
+        return SOLO5_R_OK;
+    }
+    if (net_shm != NULL && net_shm[handle] != NULL) {
+        struct shm_net_port *port = net_shm[handle];
+
+        /*
+         * Shared memory: receive directly from the ring, only clearing the
+         * doorbell once it is empty.
+         */
+        size_t nbytes = shm_net_read(port, buf, size);
+        if (nbytes == 0) {
+            uint64_t count;
+            (void)sys_read(port->rx_fd, &count, sizeof count);
+            nbytes = shm_net_read(port, buf, size);
+        }
+        if (nbytes == 0)
+            return SOLO5_R_AGAIN;
+        *read_size = nbytes;
+        return SOLO5_R_OK;
+    }
+
     long nbytes = sys_read(e->b.hostfd, (char *)buf, size);
     if (nbytes < 0) {
         if (nbytes == SYS_EAGAIN)
@@ -75,19 +139,110 @@ solo5_result_t solo5_net_read(solo5_handle_t handle, uint8_t *buf, size_t size,
     return SOLO5_R_OK;
 }
 
-solo5_result_t solo5_net_write(solo5_handle_t handle, const uint8_t *buf,
+solo5_result_t solo5_net_read_offload(solo5_handle_t handle,
+        struct solo5_net_offload *offload, uint8_t *buf, size_t size,
+        size_t *read_size)
+{
+    solo5_result_t rc;
+
+    rc = net_read_offload(handle, offload, buf, size, read_size);
+    if (rc == SOLO5_R_OK)
+        capture_put(net_capture, handle, CAPTURE_DIR_IN, buf, *read_size);
+    return rc;
+}
+
+solo5_result_t solo5_net_read(solo5_handle_t handle, uint8_t *buf, size_t size,
+        size_t *read_size)
+{
+    struct solo5_net_offload offload;
+    solo5_result_t rc;
+
+    rc = solo5_net_read_offload(handle, &offload, buf, size, read_size);
+    if (rc == SOLO5_R_OK && !net_offload_resolve(&offload, buf, *read_size))
+        return SOLO5_R_AGAIN;
+    return rc;
+}
+
+static solo5_result_t net_write_offload(solo5_handle_t handle,
+        const struct solo5_net_offload *offload, const uint8_t *buf,
         size_t size)
 {
     const struct mft_entry *e =
         mft_get_by_index(mft, handle, MFT_DEV_NET_BASIC);
     if (e == NULL)
         return SOLO5_R_EINVAL;
+    if (!rate_take(net_rate, handle, size))
+        return SOLO5_R_AGAIN;
+
+    if (e->u.net_basic.offload) {
+        struct sys_iovec iov[2] = {
+            { .base = (void *)offload, .len = sizeof *offload },
+            { .base = (void *)buf, .len = size }
+        };
+        /*
+         * The host rejects invalid offload metadata.
+         */
+        long nbytes = sys_writev(e->b.hostfd, iov, 2);
+
+        return (nbytes == (long)(sizeof *offload + size)) ?
+            SOLO5_R_OK : SOLO5_R_EINVAL;
+    }
+    if (!net_offload_is_none(offload))
+        return SOLO5_R_EINVAL;
+
+    if (net_xdp != NULL && net_xdp[handle] != NULL) {
+        struct xdp_port *port = net_xdp[handle];
+
+        if (size > XDP_PORT_FRAME_SIZE)
+            return SOLO5_R_EINVAL;
+        /*
+         * If no TX frames are available the packet is dropped.
+         */
+        if (xdp_port_write(port, buf, size) == 0 &&
+                xdp_port_tx_need_wakeup(port))
+            (void)sys_sendto(port->fd, NULL, 0, SYS_MSG_DONTWAIT, NULL, 0);
+        return SOLO5_R_OK;
+    }
+    if (net_shm != NULL && net_shm[handle] != NULL) {
+        struct shm_net_port *port = net_shm[handle];
+
+        if (size > SHM_NET_MAX_PACKET)
+            return SOLO5_R_EINVAL;
+        /*
+         * If the ring is full the packet is dropped.
+         */
+        if (shm_net_write(port, buf, size) == 1) {
+            uint64_t one = 1;
+            (void)sys_write(port->tx_fd, &one, sizeof one);
+        }
+        return SOLO5_R_OK;
+    }
 
     long nbytes = sys_write(e->b.hostfd, (const char *)buf, size);
 
     return (nbytes == (int)size) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
 }
 
+solo5_result_t solo5_net_write_offload(solo5_handle_t handle,
+        const struct solo5_net_offload *offload, const uint8_t *buf,
+        size_t size)
+{
+    solo5_result_t rc;
+
+    rc = net_write_offload(handle, offload, buf, size);
+    if (rc == SOLO5_R_OK)
+        capture_put(net_capture, handle, CAPTURE_DIR_OUT, buf, size);
+    return rc;
+}
+
+solo5_result_t solo5_net_write(solo5_handle_t handle, const uint8_t *buf,
+        size_t size)
+{
+    static const struct solo5_net_offload none = { 0 };
+
+    return solo5_net_write_offload(handle, &none, buf, size);
+}
+
 void solo5_yield(solo5_time_t deadline, solo5_handle_set_t *ready_set)
 {
     int nrevents;
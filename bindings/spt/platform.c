@@ -22,6 +22,10 @@
 
 static const char *cmdline;
 static uint64_t mem_size;
+static const struct mft *mft;
+static struct rate_limit *net_rate;
+static struct rate_limit *block_rate;
+static struct capture_ring **net_capture;
 
 void platform_init(const void *arg)
 {
@@ -29,6 +33,10 @@ void platform_init(const void *arg)
 
     cmdline = bi->cmdline;
     mem_size = bi->mem_size;
+    mft = bi->mft;
+    net_rate = bi->net_rate;
+    block_rate = bi->block_rate;
+    net_capture = bi->net_capture;
 }
 
 const char *platform_cmdline(void)
@@ -43,6 +51,9 @@ uint64_t platform_mem_size(void)
 
 void platform_exit(int status, void *cookie __attribute__((unused)))
 {
+    rate_report(mft, net_rate);
+    rate_report(mft, block_rate);
+    capture_stop(mft, net_capture);
     sys_exit_group(status);
 }
 
@@ -67,3 +78,33 @@ int platform_set_tls_base(uint64_t base)
 #error Unsupported architecture
 #endif
 }
+
+int platform_mem_release(uintptr_t start, size_t size)
+{
+    /*
+     * The seccomp filter installed by the tender only allows MADV_DONTNEED
+     * on naturally aligned power-of-two chunks of guest memory, so split the
+     * (page-aligned) range into the largest such chunks.
+     */
+    while (size > 0) {
+        size_t chunk = start & -start;
+        while (chunk > size)
+            chunk >>= 1;
+        long rc = sys_madvise((void *)start, chunk, SYS_MADV_DONTNEED);
+        if (rc != 0)
+            return -1;
+        start += chunk;
+        size -= chunk;
+    }
+    return 0;
+}
+
+int platform_mem_reuse(uintptr_t start __attribute__((unused)),
+        size_t size __attribute__((unused)))
+{
+    /*
+     * Pages released with MADV_DONTNEED are transparently re-populated with
+     * zeroes by the host kernel on first access, there is nothing to do here.
+     */
+    return 0;
+}
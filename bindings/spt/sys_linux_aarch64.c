@@ -34,6 +34,10 @@
 #define SYS_write 64
 #define SYS_pread64 67
 #define SYS_pwrite64 68
+#define SYS_readv 65
+#define SYS_writev 66
+#define SYS_madvise 233
+#define SYS_sendto 206
 #define SYS_clock_gettime 113
 #define SYS_exit_group 94
 #define SYS_epoll_pwait 22
@@ -109,6 +113,79 @@ long sys_pwrite64(long fd, const void *buf, long size, long pos)
     return x0;
 }
 
+long sys_readv(long fd, const struct sys_iovec *iov, long iovcnt)
+{
+    register long x8 __asm__("x8") = SYS_readv;
+    register long x0 __asm__("x0") = fd;
+    register long x1 __asm__("x1") = (long)iov;
+    register long x2 __asm__("x2") = iovcnt;
+
+    __asm__ __volatile__ (
+            "svc 0"
+            : "=r" (x0)
+            : "r" (x8), "r" (x0), "r" (x1), "r" (x2)
+            : "memory", "cc"
+    );
+
+    return x0;
+}
+
+long sys_writev(long fd, const struct sys_iovec *iov, long iovcnt)
+{
+    register long x8 __asm__("x8") = SYS_writev;
+    register long x0 __asm__("x0") = fd;
+    register long x1 __asm__("x1") = (long)iov;
+    register long x2 __asm__("x2") = iovcnt;
+
+    __asm__ __volatile__ (
+            "svc 0"
+            : "=r" (x0)
+            : "r" (x8), "r" (x0), "r" (x1), "r" (x2)
+            : "memory", "cc"
+    );
+
+    return x0;
+}
+
+long sys_madvise(void *addr, long len, long advice)
+{
+    register long x8 __asm__("x8") = SYS_madvise;
+    register long x0 __asm__("x0") = (long)addr;
+    register long x1 __asm__("x1") = len;
+    register long x2 __asm__("x2") = advice;
+
+    __asm__ __volatile__ (
+            "svc 0"
+            : "=r" (x0)
+            : "r" (x8), "r" (x0), "r" (x1), "r" (x2)
+            : "memory", "cc"
+    );
+
+    return x0;
+}
+
+long sys_sendto(long fd, const void *buf, long len, long flags,
+        const void *addr, long addrlen)
+{
+    register long x8 __asm__("x8") = SYS_sendto;
+    register long x0 __asm__("x0") = fd;
+    register long x1 __asm__("x1") = (long)buf;
+    register long x2 __asm__("x2") = len;
+    register long x3 __asm__("x3") = flags;
+    register long x4 __asm__("x4") = (long)addr;
+    register long x5 __asm__("x5") = addrlen;
+
+    __asm__ __volatile__ (
+            "svc 0"
+            : "=r" (x0)
+            : "r" (x8), "r" (x0), "r" (x1), "r" (x2), "r" (x3), "r" (x4),
+              "r" (x5)
+            : "memory", "cc"
+    );
+
+    return x0;
+}
+
 void sys_exit_group(long status)
 {
     register long x8 __asm__("x8") = SYS_exit_group;
@@ -31,6 +31,10 @@
 #define SYS_write 4
 #define SYS_pread64 179
 #define SYS_pwrite64 180
+#define SYS_readv 145
+#define SYS_writev 146
+#define SYS_madvise 205
+#define SYS_sendto 335
 #define SYS_clock_gettime 246
 #define SYS_exit_group 234
 #define SYS_epoll_pwait 303
@@ -122,6 +126,94 @@ long sys_pwrite64(long fd, const void *buf, long size, long pos)
     return r3;
 }
 
+long sys_readv(long fd, const struct sys_iovec *iov, long iovcnt)
+{
+    register long r0 __asm__("r0") = SYS_readv;
+    register long r3 __asm__("r3") = fd;
+    register long r4 __asm__("r4") = (long)iov;
+    register long r5 __asm__("r5") = iovcnt;
+    long cr;
+
+    __asm__ __volatile__ (
+            "sc\n\t"
+            "mfcr %1"
+            : "=r" (r3), "=&r" (cr)
+            : "r" (r0), "r" (r3), "r" (r4), "r" (r5)
+            : "memory", "cc"
+    );
+    if (cr & CR0_SO)
+        r3 = -r3;
+
+    return r3;
+}
+
+long sys_writev(long fd, const struct sys_iovec *iov, long iovcnt)
+{
+    register long r0 __asm__("r0") = SYS_writev;
+    register long r3 __asm__("r3") = fd;
+    register long r4 __asm__("r4") = (long)iov;
+    register long r5 __asm__("r5") = iovcnt;
+    long cr;
+
+    __asm__ __volatile__ (
+            "sc\n\t"
+            "mfcr %1"
+            : "=r" (r3), "=&r" (cr)
+            : "r" (r0), "r" (r3), "r" (r4), "r" (r5)
+            : "memory", "cc"
+    );
+    if (cr & CR0_SO)
+        r3 = -r3;
+
+    return r3;
+}
+
+long sys_madvise(void *addr, long len, long advice)
+{
+    register long r0 __asm__("r0") = SYS_madvise;
+    register long r3 __asm__("r3") = (long)addr;
+    register long r4 __asm__("r4") = len;
+    register long r5 __asm__("r5") = advice;
+    long cr;
+
+    __asm__ __volatile__ (
+            "sc\n\t"
+            "mfcr %1"
+            : "=r" (r3), "=&r" (cr)
+            : "r" (r0), "r" (r3), "r" (r4), "r" (r5)
+            : "memory", "cc"
+    );
+    if (cr & CR0_SO)
+        r3 = -r3;
+
+    return r3;
+}
+
+long sys_sendto(long fd, const void *buf, long len, long flags,
+        const void *addr, long addrlen)
+{
+    register long r0 __asm__("r0") = SYS_sendto;
+    register long r3 __asm__("r3") = fd;
+    register long r4 __asm__("r4") = (long)buf;
+    register long r5 __asm__("r5") = len;
+    register long r6 __asm__("r6") = flags;
+    register long r7 __asm__("r7") = (long)addr;
+    register long r8 __asm__("r8") = addrlen;
+    long cr;
+
+    __asm__ __volatile__ (
+            "sc\n\t"
+            "mfcr %1"
+            : "=r" (r3), "=&r" (cr)
+            : "r" (r0), "r" (r3), "r" (r4), "r" (r5), "r" (r6), "r" (r7), "r" (r8)
+            : "memory", "cc"
+    );
+    if (cr & CR0_SO)
+        r3 = -r3;
+
+    return r3;
+}
+
 void sys_exit_group(long status)
 {
     register long r0 __asm__("r0") = SYS_exit_group;
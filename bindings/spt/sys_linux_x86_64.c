@@ -34,6 +34,10 @@
 #define SYS_write 1
 #define SYS_pread64 17
 #define SYS_pwrite64 18
+#define SYS_readv 19
+#define SYS_writev 20
+#define SYS_madvise 28
+#define SYS_sendto 44
 #define SYS_arch_prctl 158
 #define SYS_clock_gettime 228
 #define SYS_exit_group 231
@@ -98,6 +102,67 @@ long sys_pwrite64(long fd, const void *buf, long size, long pos)
     return ret;
 }
 
+long sys_readv(long fd, const struct sys_iovec *iov, long iovcnt)
+{
+    long ret;
+
+    __asm__ __volatile__ (
+            "syscall"
+            : "=a" (ret)
+            : "a" (SYS_readv), "D" (fd), "S" (iov), "d" (iovcnt)
+            : "rcx", "r11", "memory"
+    );
+
+    return ret;
+}
+
+long sys_writev(long fd, const struct sys_iovec *iov, long iovcnt)
+{
+    long ret;
+
+    __asm__ __volatile__ (
+            "syscall"
+            : "=a" (ret)
+            : "a" (SYS_writev), "D" (fd), "S" (iov), "d" (iovcnt)
+            : "rcx", "r11", "memory"
+    );
+
+    return ret;
+}
+
+long sys_madvise(void *addr, long len, long advice)
+{
+    long ret;
+
+    __asm__ __volatile__ (
+            "syscall"
+            : "=a" (ret)
+            : "a" (SYS_madvise), "D" (addr), "S" (len), "d" (advice)
+            : "rcx", "r11", "memory"
+    );
+
+    return ret;
+}
+
+long sys_sendto(long fd, const void *buf, long len, long flags,
+        const void *addr, long addrlen)
+{
+    long ret;
+    register long r10 __asm__("r10") = flags;
+    register long r8 __asm__("r8") = (long)addr;
+    register long r9 __asm__("r9") = addrlen;
+
+    __asm__ __volatile__ (
+            "syscall"
+            : "=a" (ret)
+            : "a" (SYS_sendto), "D" (fd), "S" (buf), "d" (len),
+              "r" (r10), "r" (r8), "r" (r9)
+            : "rcx", "r11", "memory"
+    );
+
+    return ret;
+}
+
 void sys_exit_group(long status)
 {
     __asm__ __volatile__ (
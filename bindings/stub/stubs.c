@@ -87,6 +87,20 @@ solo5_result_t solo5_net_read(solo5_handle_t handle U, uint8_t *buf U,
     return SOLO5_R_EUNSPEC;
 }
 
+solo5_result_t solo5_net_write_offload(solo5_handle_t handle U,
+        const struct solo5_net_offload *offload U, const uint8_t *buf U,
+        size_t size U)
+{
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_net_read_offload(solo5_handle_t handle U,
+        struct solo5_net_offload *offload U, uint8_t *buf U, size_t size U,
+        size_t *read_size U)
+{
+    return SOLO5_R_EUNSPEC;
+}
+
 solo5_result_t solo5_block_acquire(const char *name U, solo5_handle_t *handle U,
         struct solo5_block_info *info U)
 {
@@ -105,7 +119,34 @@ solo5_result_t solo5_block_read(solo5_handle_t handle U, solo5_off_t offset U,
     return SOLO5_R_EUNSPEC;
 }
 
+solo5_result_t solo5_block_map(solo5_handle_t handle U, const uint8_t **addr U)
+{
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_block_submit(solo5_handle_t handle U,
+        struct solo5_block_request *req U)
+{
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_block_complete(solo5_handle_t handle U,
+        struct solo5_block_request **req U)
+{
+    return SOLO5_R_EUNSPEC;
+}
+
 solo5_result_t solo5_set_tls_base(uintptr_t base U)
 {
     return SOLO5_R_EUNSPEC;
 }
+
+solo5_result_t solo5_mem_release(uintptr_t start U, size_t size U)
+{
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_mem_reuse(uintptr_t start U, size_t size U)
+{
+    return SOLO5_R_EUNSPEC;
+}
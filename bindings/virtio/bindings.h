@@ -54,20 +54,31 @@ struct pci_config_info {
     uint8_t bus;
     uint8_t dev;
     uint16_t vendor_id;
+    uint16_t device_id;
     uint16_t subsys_id;
     uint16_t base;
     uint8_t irq;
 };
 
 void pci_enumerate(void);
+uint32_t pci_config_read32(const struct pci_config_info *pci, uint8_t off);
+uint16_t pci_config_read16(const struct pci_config_info *pci, uint8_t off);
+uint8_t pci_config_read8(const struct pci_config_info *pci, uint8_t off);
+void pci_config_write16(const struct pci_config_info *pci, uint8_t off,
+        uint16_t v);
+/* Returns the address of memory BAR (bar), or 0 if it is an I/O BAR */
+uint64_t pci_bar_address(const struct pci_config_info *pci, unsigned bar);
 
 /* virtio.c: mostly net for now */
 void virtio_config_network(struct pci_config_info *);
 void virtio_config_block(struct pci_config_info *);
 
-uint8_t *virtio_net_pkt_get(size_t *size);  /* get a pointer to recv'd data */
-void virtio_net_pkt_put(void);      /* we're done with recv'd data */
-int virtio_net_xmit_packet(const void *data, size_t len);
-int virtio_net_pkt_poll(void);      /* test if packet(s) are available */
+int virtio_net_pkt_poll(solo5_handle_set_t *ready_set);
+void virtio_net_flush(void);        /* notify device of pending buffers */
+int virtio_blk_completion_poll(solo5_handle_set_t *ready_set);
+
+/* Log notification and interrupt counts (at DEBUG level) */
+void virtio_net_log_stats(void);
+void virtio_blk_log_stats(void);
 
 #endif /* __VIRTIO_BINDINGS_H__ */
@@ -19,6 +19,7 @@
  */
 
 #include "bindings.h"
+#include "virtio_pci.h"
 
 #define PCI_CONFIG_ADDR 0xCF8
 #define PCI_CONFIG_DATA 0xCFC
@@ -43,6 +44,17 @@
 #define PCI_CONF_IOBAR_SHFT 0x0
 #define PCI_CONF_IOBAR_MASK ~0x3
 
+#define PCI_CONF_DEVICE_ID      0x0
+#define PCI_CONF_DEVICE_ID_SHFT 16
+#define PCI_CONF_DEVICE_ID_MASK 0xffff
+
+#define PCI_CONF_BAR0          0x10
+#define PCI_BAR_IO             0x1
+#define PCI_BAR_TYPE_SHFT      1
+#define PCI_BAR_TYPE_MASK      0x3
+#define PCI_BAR_TYPE_64        0x2
+#define PCI_BAR_MEM_MASK       ~0xfULL
+
 
 #define PCI_CONF_READ(type, ret, a, s) do {                          \
     uint32_t _conf_data;                                             \
@@ -53,37 +65,81 @@
 } while (0)
 
 
-static uint32_t net_devices_found;
-static uint32_t blk_devices_found;
+static uint32_t pci_config_addr(const struct pci_config_info *pci,
+        uint8_t off)
+{
+    return PCI_ENABLE_BIT | (pci->bus << PCI_BUS_SHIFT)
+        | (pci->dev << PCI_DEVICE_SHIFT) | (off & ~0x3);
+}
+
+uint32_t pci_config_read32(const struct pci_config_info *pci, uint8_t off)
+{
+    outl(PCI_CONFIG_ADDR, pci_config_addr(pci, off));
+    return inl(PCI_CONFIG_DATA);
+}
+
+uint16_t pci_config_read16(const struct pci_config_info *pci, uint8_t off)
+{
+    return pci_config_read32(pci, off) >> ((off & 0x2) * 8);
+}
+
+uint8_t pci_config_read8(const struct pci_config_info *pci, uint8_t off)
+{
+    return pci_config_read32(pci, off) >> ((off & 0x3) * 8);
+}
+
+void pci_config_write16(const struct pci_config_info *pci, uint8_t off,
+        uint16_t v)
+{
+    outl(PCI_CONFIG_ADDR, pci_config_addr(pci, off));
+    outw(PCI_CONFIG_DATA + (off & 0x2), v);
+}
+
+uint64_t pci_bar_address(const struct pci_config_info *pci, unsigned bar)
+{
+    uint32_t lo, type;
+    uint64_t addr;
+
+    assert(bar < 6);
+    lo = pci_config_read32(pci, PCI_CONF_BAR0 + (bar * 4));
+    if (lo & PCI_BAR_IO)
+        return 0;
+    addr = lo & PCI_BAR_MEM_MASK;
+    type = (lo >> PCI_BAR_TYPE_SHFT) & PCI_BAR_TYPE_MASK;
+    if (type == PCI_BAR_TYPE_64 && bar < 5)
+        addr |= (uint64_t)pci_config_read32(pci,
+                PCI_CONF_BAR0 + ((bar + 1) * 4)) << 32;
+    return addr;
+}
 
 #define PCI_CONF_SUBSYS_NET 1
 #define PCI_CONF_SUBSYS_BLK 2
 
 static void virtio_config(struct pci_config_info *pci)
 {
+    /*
+     * Transitional devices identify their type using the subsystem ID,
+     * modern-only devices using the device ID.
+     */
+    uint16_t type = pci->subsys_id;
+    if (pci->device_id >= PCI_DEVICE_ID_VIRTIO_MODERN)
+        type = pci->device_id - PCI_DEVICE_ID_VIRTIO_MODERN;
+
     /* we only support one net device and one blk device */
-    switch (pci->subsys_id) {
+    switch (type) {
     case PCI_CONF_SUBSYS_NET:
         log(INFO, "Solo5: PCI:%02x:%02x: virtio-net device, base=0x%x, irq=%u\n",
             pci->bus, pci->dev, pci->base, pci->irq);
-        if (!net_devices_found++)
-            virtio_config_network(pci);
-        else
-            log(WARN, "Solo5: PCI:%02x:%02x: not configured\n", pci->bus,
-                pci->dev);
+        virtio_config_network(pci);
         break;
     case PCI_CONF_SUBSYS_BLK:
         log(INFO, "Solo5: PCI:%02x:%02x: virtio-block device, base=0x%x, irq=%u\n",
             pci->bus, pci->dev, pci->base, pci->irq);
-        if (!blk_devices_found++)
-            virtio_config_block(pci);
-        else
-            log(WARN, "Solo5: PCI:%02x:%02x: not configured\n", pci->bus,
-                pci->dev);
+        virtio_config_block(pci);
         break;
     default:
         log(WARN, "Solo5: PCI:%02x:%02x: unknown virtio device (0x%x)\n",
-            pci->bus, pci->dev, pci->subsys_id);
+            pci->bus, pci->dev, type);
         return;
     }
 }
@@ -112,6 +168,7 @@ void pci_enumerate(void)
             pci.vendor_id = config_data & 0xffff;
 
             if (pci.vendor_id == VENDOR_QUMRANET_VIRTIO) {
+                PCI_CONF_READ(uint16_t, &pci.device_id, config_addr, DEVICE_ID);
                 PCI_CONF_READ(uint16_t, &pci.subsys_id, config_addr, SUBSYS_ID);
                 PCI_CONF_READ(uint16_t, &pci.base, config_addr, IOBAR);
                 PCI_CONF_READ(uint8_t, &pci.irq, config_addr, IRQ);
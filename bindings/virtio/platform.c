@@ -100,6 +100,10 @@ uint64_t platform_mem_size(void)
 void platform_exit(int status __attribute__((unused)),
     void *cookie __attribute__((unused)))
 {
+    virtio_net_flush();
+    virtio_net_log_stats();
+    virtio_blk_log_stats();
+
     /*
      * Poke the QEMU "isa-debug-exit" device to "shutdown". Should be harmless
      * if it is not present. This is used to enable automated tests on virtio.
@@ -135,3 +139,19 @@ int platform_set_tls_base(uint64_t base)
     cpu_set_tls_base(base);
     return 0;
 }
+
+/*
+ * Returning memory to the host is not supported on this target. As
+ * solo5_mem_release() is advisory, succeed without doing anything.
+ */
+int platform_mem_release(uintptr_t start __attribute__((unused)),
+        size_t size __attribute__((unused)))
+{
+    return 0;
+}
+
+int platform_mem_reuse(uintptr_t start __attribute__((unused)),
+        size_t size __attribute__((unused)))
+{
+    return 0;
+}
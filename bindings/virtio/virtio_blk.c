@@ -36,186 +36,406 @@
 #define VIRTIO_BLK_S_IOERR  1
 #define VIRTIO_BLK_S_UNSUPP 2
 
-static uint64_t virtio_blk_sectors;
+/* The feature bitmap for virtio blk */
+#define VIRTIO_BLK_F_SIZE_MAX 1 /* Host has given maximum segment size. */
+#define VIRTIO_BLK_F_SEG_MAX  2 /* Host has given maximum segments. */
+
+/*
+ * Offsets of fields in the device configuration space.
+ */
+#define VIRTIO_BLK_CONFIG_CAPACITY 0
+#define VIRTIO_BLK_CONFIG_SIZE_MAX 8
+#define VIRTIO_BLK_CONFIG_SEG_MAX  12
 
 #define VIRTIO_BLK_SECTOR_SIZE    512
 
+/*
+ * Maximum number of data segments in a single request. Requests with more
+ * than one data segment are only possible with indirect descriptors.
+ */
+#define VIRTIO_BLK_MAX_SEGS       64
+
+/*
+ * Segment size used if the device does not advertise a maximum.
+ */
+#define VIRTIO_BLK_DEFAULT_SEG_SIZE (1024 * 1024)
+
+/*
+ * Upper bound on the time spent in cpu_block() while waiting for a
+ * synchronous request; completion interrupts will normally wake us earlier.
+ */
+#define VIRTIO_BLK_SYNC_WAIT_NSEC 1000000000ULL
+
 struct virtio_blk_hdr {
     uint32_t type;
     uint32_t ioprio;
     uint64_t sector;
 };
 
-static struct virtq blkq;
-#define VIRTQ_BLK  0
+#define VIRTIO_BLK_REQ_NONE 0xffff
 
-static uint16_t virtio_blk_pci_base; /* base in PCI config space */
-
-static bool blk_configured;
-static bool blk_acquired;
-static solo5_handle_t blk_handle;
-extern struct mft *virtio_manifest;
-
-/* Returns the index to the head of the buffers chain. */
-static uint16_t virtio_blk_op(uint32_t type,
-                              uint64_t sector,
-                              void *data, size_t len)
-{
-    uint16_t mask = blkq.num - 1;
+/*
+ * Per-request state. Request (i) is submitted as virtqueue buffer ID (i).
+ * With indirect descriptors, a request uses a single descriptor in the ring,
+ * pointing to (table). Otherwise, it uses three descriptors in the ring and
+ * is limited to a single data segment.
+ */
+struct virtio_blk_req {
+    /* Indirect descriptor table, in split or packed format */
+    struct virtq_desc table[VIRTIO_BLK_MAX_SEGS + 2];
     struct virtio_blk_hdr hdr;
-    struct io_buffer *head_buf, *data_buf, *status_buf;
-    uint16_t head = blkq.next_avail & mask;
+    volatile uint8_t status;
+    bool done;
+    bool sync;
+    struct solo5_block_request *req;
+    uint16_t next;              /* Next request on free or done list */
+} __attribute__((aligned(16)));
 
-    assert(len <= VIRTIO_BLK_SECTOR_SIZE);
+#define VIRTQ_BLK  0
+
+struct virtio_blk {
+    struct virtio_dev dev;
+    struct virtq blkq;
+    uint64_t sectors;
+
+    bool indirect;
+    struct virtio_blk_req *reqs;
+    uint16_t nreqs;
+    uint16_t free;
+    uint16_t done_first, done_last;
+    unsigned max_segs;
+    size_t seg_size;
+    uint64_t requests, interrupts;
+
+    bool acquired;
+    solo5_handle_t handle;
+};
 
-    head_buf = &blkq.bufs[head];
-    data_buf = &blkq.bufs[(head + 1) & mask];
-    status_buf = &blkq.bufs[(head + 2) & mask];
+/*
+ * Block devices in PCI enumeration order. The n-th block device declared in
+ * the application manifest is backed by blks[n].
+ */
+static struct virtio_blk blks[MFT_MAX_ENTRIES];
+static unsigned nblks;
+static struct virtio_blk *blk_by_handle[MFT_MAX_ENTRIES];
+extern struct mft *virtio_manifest;
 
-    hdr.type = type;
-    hdr.ioprio = 0;
-    hdr.sector = sector;
+static int handle_virtio_blk_interrupt(void *);
 
-    /* The header buf */
-    memcpy(head_buf->data, &hdr, sizeof(struct virtio_blk_hdr));
-    head_buf->len = sizeof(struct virtio_blk_hdr);
-    head_buf->extra_flags = 0;
+/* WARNING: called in interrupt context */
+int handle_virtio_blk_interrupt(void *arg)
+{
+    struct virtio_blk *d = arg;
+    uint8_t isr_status;
+
+    isr_status = virtio_dev_isr(&d->dev);
+    if (isr_status & VIRTIO_PCI_ISR_HAS_INTR) {
+        d->interrupts++;
+        /* Completions are collected by virtio_blk_reap(); this interrupt
+         * just wakes the application from cpu_block(). */
+        return 1;
+    }
+    return 0;
+}
 
-    /* The data buf */
-    if (type == VIRTIO_BLK_T_OUT) /* write */ {
-        memcpy(data_buf->data, data, len);
-        data_buf->extra_flags = 0;
-    } else
-        data_buf->extra_flags = VIRTQ_DESC_F_WRITE;
-    data_buf->len = len;
+/*
+ * Submits (req) to device (d), without waiting for it to complete. The index
+ * of the request slot used is stored in (*slot).
+ */
+static solo5_result_t virtio_blk_submit(struct virtio_blk *d,
+        struct solo5_block_request *req, bool sync, uint16_t *slot)
+{
+    uint64_t sectors = req->size / VIRTIO_BLK_SECTOR_SIZE;
+    uint64_t sector = req->offset / VIRTIO_BLK_SECTOR_SIZE;
+
+    if ((req->offset % VIRTIO_BLK_SECTOR_SIZE != 0) ||
+        (req->size % VIRTIO_BLK_SECTOR_SIZE != 0) ||
+        (req->size == 0) ||
+        (req->size > d->max_segs * d->seg_size) ||
+        (sector >= d->sectors) ||
+        (sectors > d->sectors - sector))
+        return SOLO5_R_EINVAL;
 
-    /* The status buf */
-    status_buf->len = sizeof(uint8_t);
-    status_buf->extra_flags = VIRTQ_DESC_F_WRITE;
+    if (d->free == VIRTIO_BLK_REQ_NONE)
+        return SOLO5_R_AGAIN;
+
+    uint16_t i = d->free;
+    struct virtio_blk_req *r = &d->reqs[i];
+    d->free = r->next;
+
+    r->hdr.type = req->write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+    r->hdr.ioprio = 0;
+    r->hdr.sector = sector;
+    r->status = VIRTIO_BLK_S_IOERR;
+    r->done = false;
+    r->sync = sync;
+    r->req = req;
+
+    struct virtq_buf b[VIRTIO_BLK_MAX_SEGS + 2];
+    unsigned n = 0;
+
+    /* The header */
+    b[n].addr = (uint64_t)&r->hdr;
+    b[n].len = sizeof(struct virtio_blk_hdr);
+    b[n].write = false;
+    n++;
+
+    /* The data, directly from or to the application's buffer */
+    for (size_t off = 0; off < req->size; off += d->seg_size) {
+        size_t len = req->size - off;
+        if (len > d->seg_size)
+            len = d->seg_size;
+        b[n].addr = (uint64_t)(req->buf + off);
+        b[n].len = len;
+        b[n].write = !req->write;
+        n++;
+    }
 
-    assert(virtq_add_descriptor_chain(&blkq, head, 3) == 0);
+    /* The status */
+    b[n].addr = (uint64_t)&r->status;
+    b[n].len = sizeof(uint8_t);
+    b[n].write = true;
+    n++;
 
-    outw(virtio_blk_pci_base + VIRTIO_PCI_QUEUE_NOTIFY, VIRTQ_BLK);
+    /*
+     * There are always enough descriptors, as the number of requests is
+     * limited by the queue size.
+     */
+    assert(virtq_add(&d->blkq, i, b, n, r->table) == 0);
+    virtq_kick(&d->blkq);
+    d->requests++;
 
-    return head;
+    *slot = i;
+    return SOLO5_R_OK;
 }
 
 /*
- * Returns the status (0 is OK, -1 is not)
- *
- * This function assumes that no other pending IO is submitted at the same
- * time.  That is true as long as we use only synchronous IO calls, and if
- * there is just a sync call at a time (which is true for solo5).
+ * Collects all requests device (d) has completed since the last call.
+ * Completed asynchronous requests are appended to the done list, to be
+ * returned by solo5_block_complete().
  */
-static int virtio_blk_op_sync(uint32_t type,
-                              uint64_t sector,
-                              void *data, size_t len)
+static void virtio_blk_reap(struct virtio_blk *d)
 {
-    uint16_t mask = blkq.num - 1;
-    uint16_t head;
-    struct io_buffer *data_buf, *status_buf;
-    uint8_t status;
-
-    head = virtio_blk_op(type, sector, data, len);
-    data_buf = &blkq.bufs[(head + 1) & mask];
-    status_buf = &blkq.bufs[(head + 2) & mask];
-
-    /* Loop until the device used all of our descriptors. */
-    while (blkq.used->idx != blkq.avail->idx)
-        ;
-
-    /* Consume all the recently used descriptors. */
-    for (; blkq.used->idx != blkq.last_used; blkq.last_used++) {
-        struct virtq_used_elem *e;
+    uint16_t i;
+    uint32_t len;
+
+    do {
+        while (virtq_get(&d->blkq, &i, &len)) {
+            assert(i < d->nreqs);
+
+            struct virtio_blk_req *r = &d->reqs[i];
+            assert(!r->done);
+            r->done = true;
+            if (r->sync)
+                continue;
+
+            r->next = VIRTIO_BLK_REQ_NONE;
+            if (d->done_last == VIRTIO_BLK_REQ_NONE)
+                d->done_first = i;
+            else
+                d->reqs[d->done_last].next = i;
+            d->done_last = i;
+        }
+        /*
+         * Re-arm the completion interrupt, and check for requests which
+         * completed before it was.
+         */
+    } while (virtq_intr_enable(&d->blkq));
+}
 
-        /* Assert that the used descriptor matches the descriptor of the
-         * IO we started at the start of this function. */
-        e = &(blkq.used->ring[blkq.last_used & mask]);
-        assert(head == e->id);
+/*
+ * Stores the result of the completed request in slot (i), and returns the
+ * slot to the free list.
+ */
+static struct solo5_block_request *virtio_blk_finish(struct virtio_blk *d,
+        uint16_t i)
+{
+    struct virtio_blk_req *r = &d->reqs[i];
+    struct solo5_block_request *req = r->req;
+
+    req->result = (r->status == VIRTIO_BLK_S_OK) ? SOLO5_R_OK :
+        SOLO5_R_EUNSPEC;
+    r->req = NULL;
+    r->next = d->free;
+    d->free = i;
+    return req;
+}
 
-        blkq.num_avail += 3; /* 3 descriptors per chain */
+/*
+ * Submits (req) and sleeps until it completes. Requests submitted
+ * asynchronously by the application may complete in the meantime; they are
+ * left on the done list.
+ */
+static solo5_result_t virtio_blk_op_sync(struct virtio_blk *d,
+        struct solo5_block_request *req)
+{
+    solo5_result_t rv;
+    uint16_t i;
+
+    cpu_intr_disable();
+    rv = virtio_blk_submit(d, req, true, &i);
+    if (rv == SOLO5_R_OK) {
+        for (;;) {
+            virtio_blk_reap(d);
+            if (d->reqs[i].done)
+                break;
+            cpu_block(solo5_clock_monotonic() + VIRTIO_BLK_SYNC_WAIT_NSEC);
+        }
+        rv = virtio_blk_finish(d, i)->result;
     }
+    cpu_intr_enable();
 
-    status = (*(uint8_t *)status_buf);
-    if (status != VIRTIO_BLK_S_OK)
-        return -1;
+    return rv;
+}
 
-    if (type == VIRTIO_BLK_T_IN) /* read */
-        memcpy(data, data_buf->data, len);
+/*
+ * Adds the handles of all acquired block devices with completed asynchronous
+ * requests to (*ready_set). Returns 1 if there are any.
+ */
+int virtio_blk_completion_poll(solo5_handle_set_t *ready_set)
+{
+    int ready = 0;
+
+    for (unsigned n = 0; n < nblks; n++) {
+        struct virtio_blk *d = &blks[n];
+
+        if (!d->acquired)
+            continue;
+        virtio_blk_reap(d);
+        if (d->done_first != VIRTIO_BLK_REQ_NONE) {
+            *ready_set |= 1ULL << d->handle;
+            ready = 1;
+        }
+    }
+    return ready;
+}
 
-    return 0;
+void virtio_blk_log_stats(void)
+{
+    for (unsigned n = 0; n < nblks; n++) {
+        struct virtio_blk *d = &blks[n];
+
+        log(DEBUG, "Solo5: virtio-blk %u: %llu requests, %llu notifications, "
+            "%llu interrupts\n", n,
+            (unsigned long long)d->requests,
+            (unsigned long long)d->blkq.kicks,
+            (unsigned long long)d->interrupts);
+    }
 }
 
 void virtio_config_block(struct pci_config_info *pci)
 {
-    uint8_t ready_for_init = VIRTIO_PCI_STATUS_ACK | VIRTIO_PCI_STATUS_DRIVER;
-    uint32_t host_features, guest_features;
-    size_t pgs;
-
-    outb(pci->base + VIRTIO_PCI_STATUS, 0);
-    outb(pci->base + VIRTIO_PCI_STATUS, ready_for_init);
-
-    host_features = inl(pci->base + VIRTIO_PCI_HOST_FEATURES);
+    uint64_t guest_features;
 
-    /* don't negotiate anything for now */
-    guest_features = 0;
-    outl(pci->base + VIRTIO_PCI_GUEST_FEATURES, guest_features);
-
-    virtio_blk_sectors = inq(pci->base + VIRTIO_PCI_CONFIG_OFF);
-    log(INFO, "Solo5: PCI:%02x:%02x: configured, capacity=%llu sectors, "
-        "features=0x%x\n",
-        pci->bus, pci->dev, (unsigned long long)virtio_blk_sectors,
-        host_features);
+    if (nblks == MFT_MAX_ENTRIES) {
+        log(WARN, "Solo5: PCI:%02x:%02x: too many block devices, "
+            "not configured\n", pci->bus, pci->dev);
+        return;
+    }
+    struct virtio_blk *d = &blks[nblks];
 
-    virtq_init_rings(pci->base, &blkq, 0);
+    if (virtio_dev_init(&d->dev, pci) != 0)
+        return;
 
-    pgs = (((blkq.num * sizeof (struct io_buffer)) - 1) >> PAGE_SHIFT) + 1;
-    blkq.bufs = mem_ialloc_pages(pgs);
-    assert(blkq.bufs);
-    memset(blkq.bufs, 0, pgs << PAGE_SHIFT);
+    /*
+     * Negotiate indirect descriptors if available, so that every descriptor
+     * in the ring can be used for a separate request, and requests may
+     * consist of multiple data segments.
+     */
+    guest_features = virtio_dev_negotiate(&d->dev,
+            (1ULL << VIRTIO_F_INDIRECT_DESC) | (1ULL << VIRTIO_F_EVENT_IDX) |
+            (1ULL << VIRTIO_BLK_F_SIZE_MAX) | (1ULL << VIRTIO_BLK_F_SEG_MAX));
+
+    d->sectors = virtio_dev_config64(&d->dev, VIRTIO_BLK_CONFIG_CAPACITY);
+    d->indirect = virtio_dev_has(&d->dev, VIRTIO_F_INDIRECT_DESC);
+
+    d->seg_size = VIRTIO_BLK_DEFAULT_SEG_SIZE;
+    if (virtio_dev_has(&d->dev, VIRTIO_BLK_F_SIZE_MAX)) {
+        uint32_t size_max = virtio_dev_config32(&d->dev,
+                VIRTIO_BLK_CONFIG_SIZE_MAX);
+        if (size_max < d->seg_size)
+            d->seg_size = size_max;
+    }
+    d->seg_size &= ~(size_t)(VIRTIO_BLK_SECTOR_SIZE - 1);
+    assert(d->seg_size > 0);
+
+    d->max_segs = d->indirect ? VIRTIO_BLK_MAX_SEGS : 1;
+    if (virtio_dev_has(&d->dev, VIRTIO_BLK_F_SEG_MAX)) {
+        uint32_t seg_max = virtio_dev_config32(&d->dev,
+                VIRTIO_BLK_CONFIG_SEG_MAX);
+        if (seg_max > 0 && seg_max < d->max_segs)
+            d->max_segs = seg_max;
+    }
 
-    virtio_blk_pci_base = pci->base;
-    blk_configured = 1;
+    virtio_dev_setup_queue(&d->dev, &d->blkq, VIRTQ_BLK);
 
     /*
-     * We don't need to get interrupts every time the device uses our
-     * descriptors.
+     * Allocate per-request state, enough to keep the whole queue busy.
      */
+    d->nreqs = d->indirect ? d->blkq.num : d->blkq.num / 3;
+    assert(d->nreqs > 0);
+    size_t pgs = (((d->nreqs * sizeof(struct virtio_blk_req)) - 1) >>
+            PAGE_SHIFT) + 1;
+    d->reqs = mem_ialloc_pages(pgs);
+    assert(d->reqs);
+    memset(d->reqs, 0, pgs << PAGE_SHIFT);
+    d->free = VIRTIO_BLK_REQ_NONE;
+    for (uint16_t i = d->nreqs; i > 0; i--) {
+        d->reqs[i - 1].next = d->free;
+        d->free = i - 1;
+    }
+    d->done_first = d->done_last = VIRTIO_BLK_REQ_NONE;
+
+    log(INFO, "Solo5: PCI:%02x:%02x: configured, capacity=%llu sectors, "
+        "queue depth=%u, transport=%s, features=0x%llx\n",
+        pci->bus, pci->dev, (unsigned long long)d->sectors,
+        d->nreqs, d->dev.modern ? "modern" : "legacy",
+        (unsigned long long)guest_features);
+
+    nblks++;
+    intr_register_irq(pci->irq, handle_virtio_blk_interrupt, d);
 
-    blkq.avail->flags |= VIRTQ_AVAIL_F_NO_INTERRUPT;
+    virtio_dev_ready(&d->dev);
+}
 
-    outb(pci->base + VIRTIO_PCI_STATUS, VIRTIO_PCI_STATUS_DRIVER_OK);
+static struct virtio_blk *blk_get(solo5_handle_t h)
+{
+    if (h >= MFT_MAX_ENTRIES)
+        return NULL;
+    return blk_by_handle[h];
 }
 
 /*
- * FIXME: This is a single-device implementation of the new manifest-based
- * APIs. On virtio, this call has the following semantics:
- *
- * 1. The first call to solo5_block_acquire() asking for a handle to a valid
- *    block device (one specified in the application manifest) will succeed,
- *    and return a handle for the sole virtio block device.
- * 2. All subsequent calls will return an error.
- *
- * Note that the presence of a virtio block device is registered during boot
- * in (blk_configured), and the initial acquisition by solo5_block_acquire() is
- * registered in (blk_acquired).
+ * On virtio, block devices declared in the application manifest are backed
+ * by the virtio block devices on the PCI bus, in order: the n-th block device
+ * in the manifest is the n-th virtio block device found during PCI
+ * enumeration. If there is no such device, returns SOLO5_R_EUNSPEC.
  */
 solo5_result_t solo5_block_acquire(const char *name, solo5_handle_t *h,
         struct solo5_block_info *info)
 {
-    if (!blk_configured || blk_acquired)
-        return SOLO5_R_EUNSPEC;
-
     unsigned mft_index;
     struct mft_entry *mft_e = mft_get_by_name(virtio_manifest, name,
         MFT_DEV_BLOCK_BASIC, &mft_index);
     if (mft_e == NULL)
         return SOLO5_R_EINVAL;
-    blk_handle = mft_index;
-    blk_acquired = true;
+
+    unsigned ordinal = 0;
+    for (unsigned i = 0; i < mft_index; i++)
+        if (virtio_manifest->e[i].type == MFT_DEV_BLOCK_BASIC)
+            ordinal++;
+    if (ordinal >= nblks)
+        return SOLO5_R_EUNSPEC;
+
+    struct virtio_blk *d = &blks[ordinal];
+    if (d->acquired)
+        return SOLO5_R_EINVAL;
+    d->acquired = true;
+    d->handle = mft_index;
+    blk_by_handle[mft_index] = d;
 
     info->block_size = VIRTIO_BLK_SECTOR_SIZE;
-    info->capacity = virtio_blk_sectors * VIRTIO_BLK_SECTOR_SIZE;
+    info->capacity = d->sectors * VIRTIO_BLK_SECTOR_SIZE;
     *h = mft_index;
     log(INFO, "Solo5: Application acquired '%s' as block device\n", name);
     return SOLO5_R_OK;
@@ -224,46 +444,85 @@ solo5_result_t solo5_block_acquire(const char *name, solo5_handle_t *h,
 solo5_result_t solo5_block_write(solo5_handle_t h, solo5_off_t offset,
         const uint8_t *buf, size_t size)
 {
-    if (!blk_acquired || h != blk_handle)
+    struct virtio_blk *d = blk_get(h);
+    if (d == NULL)
         return SOLO5_R_EINVAL;
 
     /*
-     * XXX: This does not check for writes ending past the end of the device,
-     * virtio_blk_op_sync() will return -1 (translated to SOLO5_R_EUNSPEC)
-     * below.
+     * Device bounds are checked by virtio_blk_submit().
      */
-    uint64_t sector = offset / VIRTIO_BLK_SECTOR_SIZE;
-    if ((offset % VIRTIO_BLK_SECTOR_SIZE != 0) ||
-        (sector >= virtio_blk_sectors) ||
-        (size != VIRTIO_BLK_SECTOR_SIZE))
+    if (size != VIRTIO_BLK_SECTOR_SIZE)
         return SOLO5_R_EINVAL;
 
-    /*
-     * XXX: removing the const qualifier from buf here is fine with the current
-     * implementation which does a memcpy() on VIRTIO_BLK_T_OUT, however the
-     * internal interfaces should be refactored to reflect this.
-     */
-    int rv = virtio_blk_op_sync(VIRTIO_BLK_T_OUT, sector, (uint8_t *)buf, size);
-    return (rv == 0) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
+    struct solo5_block_request req = {
+        .offset = offset,
+        /*
+         * The device only reads from (buf) for a VIRTIO_BLK_T_OUT request.
+         */
+        .buf = (uint8_t *)buf,
+        .size = size,
+        .write = true
+    };
+    return virtio_blk_op_sync(d, &req);
 }
 
 solo5_result_t solo5_block_read(solo5_handle_t h, solo5_off_t offset,
         uint8_t *buf, size_t size)
 {
-    if (!blk_acquired || h != blk_handle)
+    struct virtio_blk *d = blk_get(h);
+    if (d == NULL)
         return SOLO5_R_EINVAL;
 
     /*
-     * XXX: This does not check for reads ending past the end of the device,
-     * virtio_blk_op_sync() will return -1 (translated to SOLO5_R_EUNSPEC)
-     * below.
+     * Device bounds are checked by virtio_blk_submit().
      */
-    uint64_t sector = offset / VIRTIO_BLK_SECTOR_SIZE;
-    if ((offset % VIRTIO_BLK_SECTOR_SIZE != 0) ||
-        (sector >= virtio_blk_sectors) ||
-        (size != VIRTIO_BLK_SECTOR_SIZE))
+    if (size != VIRTIO_BLK_SECTOR_SIZE)
+        return SOLO5_R_EINVAL;
+
+    struct solo5_block_request req = {
+        .offset = offset,
+        .buf = buf,
+        .size = size,
+        .write = false
+    };
+    return virtio_blk_op_sync(d, &req);
+}
+
+solo5_result_t solo5_block_map(solo5_handle_t h,
+        const uint8_t **addr __attribute__((unused)))
+{
+    if (blk_get(h) == NULL)
         return SOLO5_R_EINVAL;
 
-    int rv = virtio_blk_op_sync(VIRTIO_BLK_T_IN, sector, buf, size);
-    return (rv == 0) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_block_submit(solo5_handle_t h,
+        struct solo5_block_request *req)
+{
+    struct virtio_blk *d = blk_get(h);
+    if (d == NULL)
+        return SOLO5_R_EINVAL;
+
+    uint16_t i;
+    return virtio_blk_submit(d, req, false, &i);
+}
+
+solo5_result_t solo5_block_complete(solo5_handle_t h,
+        struct solo5_block_request **req)
+{
+    struct virtio_blk *d = blk_get(h);
+    if (d == NULL)
+        return SOLO5_R_EINVAL;
+
+    virtio_blk_reap(d);
+    uint16_t i = d->done_first;
+    if (i == VIRTIO_BLK_REQ_NONE)
+        return SOLO5_R_AGAIN;
+
+    d->done_first = d->reqs[i].next;
+    if (d->done_first == VIRTIO_BLK_REQ_NONE)
+        d->done_last = VIRTIO_BLK_REQ_NONE;
+    *req = virtio_blk_finish(d, i);
+    return SOLO5_R_OK;
 }
@@ -25,12 +25,15 @@
 /* The feature bitmap for virtio net */
 #define VIRTIO_NET_F_CSUM       0 /* Host handles pkts w/ partial csum */
 #define VIRTIO_NET_F_GUEST_CSUM        1 /* Guest handles pkts w/ partial csum */
-#define VIRTIO_NET_F_MAC (1 << 5) /* Host has given MAC address. */
+#define VIRTIO_NET_F_MTU        3 /* Host has given maximum MTU. */
+#define VIRTIO_NET_F_MAC        5 /* Host has given MAC address. */
 
-#define PKT_BUFFER_LEN 1526
+/*
+ * Offset of the (mtu) field in the device configuration space.
+ */
+#define VIRTIO_NET_CONFIG_MTU   10
 
-static struct virtq recvq;
-static struct virtq xmitq;
+#define VIRTIO_NET_DEFAULT_MTU  1500
 
 #define VIRTQ_RECV 0
 #define VIRTQ_XMIT 1
@@ -54,135 +57,247 @@ struct __attribute__((__packed__)) virtio_net_hdr {
     uint16_t gso_size;                /* Bytes to append to hdr_len per frame */
     uint16_t csum_start;        /* Position to start checksumming from */
     uint16_t csum_offset;        /* Offset after that to place checksum */
+    /* Only present with VIRTIO_F_VERSION_1 or VIRTIO_NET_F_MRG_RXBUF: */
+    uint16_t num_buffers;
 };
 
-static uint16_t virtio_net_pci_base; /* base in PCI config space */
+/*
+ * To reduce the number of notifications (and thus VM exits), the device is
+ * notified of transmitted packets only once (xmit_batch) packets are pending
+ * or the application yields, and receive buffers are returned to the device
+ * in batches of (recv_batch).
+ */
+#define VIRTIO_NET_BATCH 32
 
-static uint8_t virtio_net_mac[6];
-static char virtio_net_mac_str[18];
+struct virtio_net {
+    struct virtio_dev dev;
+    struct virtq recvq;
+    struct virtq xmitq;
 
-static bool net_configured;
-static bool net_acquired;
-static solo5_handle_t net_handle;
+    /*
+     * Size of the virtio_net_hdr as used by the device, which depends on the
+     * negotiated features.
+     */
+    size_t hdr_len;
+    uint8_t mac[6];
+    char mac_str[18];
+    uint16_t mtu;
+    /*
+     * Size of receive buffers, large enough for a virtio_net_hdr and a frame
+     * of (mtu) bytes.
+     */
+    size_t pkt_buffer_len;
+
+    /*
+     * Transmit buffers not currently in use by the device, by buffer ID.
+     */
+    uint16_t *xmit_free;
+    uint16_t xmit_nfree;
+    uint16_t xmit_batch, xmit_pending;
+    /*
+     * Receive buffers consumed by the application, to be returned to the
+     * device.
+     */
+    uint16_t *recv_refill;
+    uint16_t recv_batch, recv_nrefill;
+
+    uint64_t rx_packets, tx_packets, interrupts;
+
+    bool acquired;
+    solo5_handle_t handle;
+};
+
+/*
+ * Network devices in PCI enumeration order. The n-th network device declared
+ * in the application manifest is backed by nets[n].
+ */
+static struct virtio_net nets[MFT_MAX_ENTRIES];
+static unsigned nnets;
+static struct virtio_net *net_by_handle[MFT_MAX_ENTRIES];
 extern struct mft *virtio_manifest;
 
 static int handle_virtio_net_interrupt(void *);
 
 /* WARNING: called in interrupt context */
-int handle_virtio_net_interrupt(void *arg __attribute__((unused)))
+int handle_virtio_net_interrupt(void *arg)
 {
+    struct virtio_net *n = arg;
     uint8_t isr_status;
 
-    if (net_configured) {
-        isr_status = inb(virtio_net_pci_base + VIRTIO_PCI_ISR);
-        if (isr_status & VIRTIO_PCI_ISR_HAS_INTR) {
-            /* This interrupt is just to kick the application out of any
-             * solo5_poll() that may be running. */
-            return 1;
-        }
+    isr_status = virtio_dev_isr(&n->dev);
+    if (isr_status & VIRTIO_PCI_ISR_HAS_INTR) {
+        n->interrupts++;
+        /* This interrupt is just to kick the application out of any
+         * solo5_poll() that may be running. */
+        return 1;
     }
     return 0;
 }
 
-static void recv_setup(void)
+/*
+ * Makes receive buffer (id) available to the device.
+ */
+static void recv_buffer_add(struct virtio_net *n, uint16_t id)
 {
-    uint16_t mask = recvq.num - 1;
-    do {
-        struct io_buffer *buf; /* header and data in a single descriptor */
-        buf = &recvq.bufs[recvq.next_avail & mask];
-        memset(buf->data, 0, PKT_BUFFER_LEN);
-        buf->len = PKT_BUFFER_LEN;
-        buf->extra_flags = VIRTQ_DESC_F_WRITE;
-        assert(virtq_add_descriptor_chain(&recvq,
-                                          recvq.next_avail & mask, 1) == 0);
-    } while ((recvq.next_avail & mask) != 0);
-
-    outw(virtio_net_pci_base + VIRTIO_PCI_QUEUE_NOTIFY, VIRTQ_RECV);
+    struct virtq_buf b = {
+        .addr = (uint64_t)n->recvq.bufs[id].data,
+        .len = n->pkt_buffer_len,
+        .write = true
+    };
+
+    assert(virtq_add(&n->recvq, id, &b, 1, NULL) == 0);
 }
 
-/* performance note: we perform a copy into the xmit buffer */
-int virtio_net_xmit_packet(const void *data, size_t len)
+static void recv_setup(struct virtio_net *n)
+{
+    /*
+     * The device fills in the header and frame, so there is no need to zero
+     * the buffers.
+     */
+    for (uint16_t id = 0; id < n->recvq.num; id++)
+        recv_buffer_add(n, id);
+
+    virtq_kick(&n->recvq);
+}
+
+/*
+ * Returns all consumed receive buffers to the device.
+ */
+static void recv_refill_flush(struct virtio_net *n)
+{
+    for (uint16_t i = 0; i < n->recv_nrefill; i++)
+        recv_buffer_add(n, n->recv_refill[i]);
+    n->recv_nrefill = 0;
+    virtq_kick(&n->recvq);
+}
+
+/*
+ * Notifies the device of all pending transmit and receive buffers.
+ */
+static void net_flush(struct virtio_net *n)
 {
-    uint16_t mask = xmitq.num - 1;
-    uint16_t head;
-    struct io_buffer *head_buf, *data_buf;
-    int r;
+    if (n->recv_nrefill > 0)
+        recv_refill_flush(n);
+    virtq_kick(&n->xmitq);
+    n->xmit_pending = 0;
+}
 
-    /* Consume used descriptors from all the previous tx'es. */
-    for (; xmitq.last_used != xmitq.used->idx; xmitq.last_used++)
-        xmitq.num_avail += 2; /* 2 descriptors per chain */
+void virtio_net_flush(void)
+{
+    for (unsigned i = 0; i < nnets; i++)
+        net_flush(&nets[i]);
+}
 
-    /* next_avail is incremented by virtq_add_descriptor_chain below. */
-    head = xmitq.next_avail & mask;
-    head_buf = &xmitq.bufs[head];
-    data_buf = &xmitq.bufs[(head + 1) & mask];
+/* performance note: we perform a copy into the xmit buffer */
+static int virtio_net_xmit_packet(struct virtio_net *n, const void *data,
+        size_t len)
+{
+    uint16_t id;
+    uint32_t used_len;
+    uint8_t *buf;
+
+    /* Reclaim the buffers of all the previous tx'es. */
+    while (virtq_get(&n->xmitq, &id, &used_len))
+        n->xmit_free[n->xmit_nfree++] = id;
+    if (n->xmit_nfree == 0) {
+        /* Make sure the device knows about the packets it has yet to send. */
+        net_flush(n);
+        return -1;
+    }
 
-    /* The header buf */
-    memset(head_buf->data, 0, sizeof(struct virtio_net_hdr));
-    head_buf->len = sizeof(struct virtio_net_hdr);
-    head_buf->extra_flags = 0;
+    id = n->xmit_free[--n->xmit_nfree];
+    buf = n->xmitq.bufs[id].data;
 
-    /* The data buf */
-    assert(len <= PKT_BUFFER_LEN);
-    memcpy(data_buf->data, data, len);
-    data_buf->len = len;
-    data_buf->extra_flags = 0;
+    /*
+     * The header was zeroed by virtq_init_bufs(), we do not use any of its
+     * fields, and the device does not write to transmit buffers.
+     */
 
-    r = virtq_add_descriptor_chain(&xmitq, head, 2);
+    /* The data */
+    assert(len <= (size_t)n->mtu + SOLO5_NET_HLEN);
+    memcpy(buf + n->hdr_len, data, len);
+
+    struct virtq_buf b[2] = {
+        { .addr = (uint64_t)buf, .len = n->hdr_len, .write = false },
+        { .addr = (uint64_t)buf + n->hdr_len, .len = len, .write = false }
+    };
+    if (virtq_add(&n->xmitq, id, b, 2, NULL) != 0) {
+        log(WARN, "Solo5: virtq full!\n");
+        n->xmit_free[n->xmit_nfree++] = id;
+        net_flush(n);
+        return -1;
+    }
+    n->tx_packets++;
 
-    outw(virtio_net_pci_base + VIRTIO_PCI_QUEUE_NOTIFY, VIRTQ_XMIT);
+    if (++n->xmit_pending >= n->xmit_batch) {
+        virtq_kick(&n->xmitq);
+        n->xmit_pending = 0;
+    }
 
-    return r;
+    return 0;
 }
 
 void virtio_config_network(struct pci_config_info *pci)
 {
-    uint32_t host_features, guest_features;
-    size_t pgs;
+    uint64_t guest_features;
+
+    if (nnets == MFT_MAX_ENTRIES) {
+        log(WARN, "Solo5: PCI:%02x:%02x: too many network devices, "
+            "not configured\n", pci->bus, pci->dev);
+        return;
+    }
+    struct virtio_net *n = &nets[nnets];
 
     /*
      * 3.1.1 Driver Requirements: Device Initialization
      *
      * 1. Reset the device.
-     */
-    outb(pci->base + VIRTIO_PCI_STATUS, 0);
-
-    /*
      * 2. Set the ACKNOWLEDGE status bit: the guest OS has notice the device.
      * 3. Set the DRIVER status bit: the guest OS knows how to drive the device.
      */
-
-    outb(pci->base + VIRTIO_PCI_STATUS, VIRTIO_PCI_STATUS_ACK);
-    outb(pci->base + VIRTIO_PCI_STATUS, VIRTIO_PCI_STATUS_DRIVER);
+    if (virtio_dev_init(&n->dev, pci) != 0)
+        return;
 
     /*
      * 4. Read device feature bits, and write the subset of feature bits
      * understood by the OS and driver to the device. During this step the
      * driver MAY read (but MUST NOT write) the device-specific configuration
      * fields to check that it can support the device before accepting it.
+     *
+     * Negotiate that the mac and mtu were set, and event index notification
+     * suppression.
      */
+    guest_features = virtio_dev_negotiate(&n->dev,
+            (1ULL << VIRTIO_NET_F_MAC) | (1ULL << VIRTIO_NET_F_MTU) |
+            (1ULL << VIRTIO_F_EVENT_IDX));
+    assert(guest_features & (1ULL << VIRTIO_NET_F_MAC));
 
-    host_features = inl(pci->base + VIRTIO_PCI_HOST_FEATURES);
-    assert(host_features & VIRTIO_NET_F_MAC);
-
-    /* only negotiate that the mac was set for now */
-    guest_features = VIRTIO_NET_F_MAC;
-    outl(pci->base + VIRTIO_PCI_GUEST_FEATURES, guest_features);
+    if (guest_features & (1ULL << VIRTIO_NET_F_MTU))
+        n->mtu = virtio_dev_config16(&n->dev, VIRTIO_NET_CONFIG_MTU);
+    else
+        n->mtu = VIRTIO_NET_DEFAULT_MTU;
+    n->hdr_len = sizeof(struct virtio_net_hdr);
+    if (!virtio_dev_has(&n->dev, VIRTIO_F_VERSION_1))
+        n->hdr_len -= sizeof(uint16_t); /* no num_buffers */
+    n->pkt_buffer_len = n->hdr_len + SOLO5_NET_HLEN + n->mtu;
 
     for (int i = 0; i < 6; i++) {
-        virtio_net_mac[i] = inb(pci->base + VIRTIO_PCI_CONFIG_OFF + i);
+        n->mac[i] = virtio_dev_config8(&n->dev, i);
     }
-    snprintf(virtio_net_mac_str,
-             sizeof(virtio_net_mac_str),
+    snprintf(n->mac_str,
+             sizeof(n->mac_str),
              "%02x:%02x:%02x:%02x:%02x:%02x",
-             virtio_net_mac[0],
-             virtio_net_mac[1],
-             virtio_net_mac[2],
-             virtio_net_mac[3],
-             virtio_net_mac[4],
-             virtio_net_mac[5]);
-    log(INFO, "Solo5: PCI:%02x:%02x: configured, mac=%s, features=0x%x\n",
-        pci->bus, pci->dev, virtio_net_mac_str, host_features);
+             n->mac[0],
+             n->mac[1],
+             n->mac[2],
+             n->mac[3],
+             n->mac[4],
+             n->mac[5]);
+    log(INFO, "Solo5: PCI:%02x:%02x: configured, mac=%s, mtu=%u, "
+        "transport=%s, features=0x%llx\n",
+        pci->bus, pci->dev, n->mac_str, n->mtu,
+        n->dev.modern ? "modern" : "legacy",
+        (unsigned long long)guest_features);
 
     /*
      * 7. Perform device-specific setup, including discovery of virtqueues for
@@ -190,23 +305,39 @@ void virtio_config_network(struct pci_config_info *pci)
      * device's virtio configuration space, and population of virtqueues.
      */
 
-    virtq_init_rings(pci->base, &recvq, VIRTQ_RECV);
-    virtq_init_rings(pci->base, &xmitq, VIRTQ_XMIT);
+    virtio_dev_setup_queue(&n->dev, &n->recvq, VIRTQ_RECV);
+    virtio_dev_setup_queue(&n->dev, &n->xmitq, VIRTQ_XMIT);
+    virtq_init_bufs(&n->recvq, n->pkt_buffer_len);
+    virtq_init_bufs(&n->xmitq, n->hdr_len + SOLO5_NET_HLEN + n->mtu);
 
-    pgs = (((recvq.num * sizeof (struct io_buffer)) - 1) >> PAGE_SHIFT) + 1;
-    recvq.bufs = mem_ialloc_pages(pgs);
-    assert(recvq.bufs);
-    memset(recvq.bufs, 0, pgs << PAGE_SHIFT);
+    size_t pgs = (((n->xmitq.num * sizeof(uint16_t)) - 1) >> PAGE_SHIFT) + 1;
+    n->xmit_free = mem_ialloc_pages(pgs);
+    assert(n->xmit_free);
+    for (n->xmit_nfree = 0; n->xmit_nfree < n->xmitq.num; n->xmit_nfree++)
+        n->xmit_free[n->xmit_nfree] = n->xmitq.num - n->xmit_nfree - 1;
 
-    pgs = (((recvq.num * sizeof (struct io_buffer)) - 1) >> PAGE_SHIFT) + 1;
-    xmitq.bufs = mem_ialloc_pages(pgs);
-    assert(xmitq.bufs);
-    memset(xmitq.bufs, 0, pgs << PAGE_SHIFT);
+    pgs = (((n->recvq.num * sizeof(uint16_t)) - 1) >> PAGE_SHIFT) + 1;
+    n->recv_refill = mem_ialloc_pages(pgs);
+    assert(n->recv_refill);
 
-    virtio_net_pci_base = pci->base;
-    net_configured = 1;
-    intr_register_irq(pci->irq, handle_virtio_net_interrupt, NULL);
-    recv_setup();
+    /*
+     * Each packet takes two descriptors on the transmit queue, keep the
+     * batches well below the queue size.
+     */
+    n->xmit_batch = n->xmitq.num / 8;
+    if (n->xmit_batch > VIRTIO_NET_BATCH)
+        n->xmit_batch = VIRTIO_NET_BATCH;
+    if (n->xmit_batch == 0)
+        n->xmit_batch = 1;
+    n->recv_batch = n->recvq.num / 4;
+    if (n->recv_batch > VIRTIO_NET_BATCH)
+        n->recv_batch = VIRTIO_NET_BATCH;
+    if (n->recv_batch == 0)
+        n->recv_batch = 1;
+
+    nnets++;
+    intr_register_irq(pci->irq, handle_virtio_net_interrupt, n);
+    recv_setup(n);
 
     /*
      * We don't need to get interrupts every time the device uses our
@@ -215,99 +346,89 @@ void virtio_config_network(struct pci_config_info *pci)
      * Interrupt").
      */
 
-    xmitq.avail->flags |= VIRTQ_AVAIL_F_NO_INTERRUPT;
+    virtq_intr_disable(&n->xmitq);
 
     /*
      * 8. Set the DRIVER_OK status bit. At this point the device is "live".
      */
 
-    outb(pci->base + VIRTIO_PCI_STATUS, VIRTIO_PCI_STATUS_DRIVER_OK);
+    virtio_dev_ready(&n->dev);
 }
 
-/* Returns 1 if there is a pending used descriptor for us to read. */
-int virtio_net_pkt_poll(void)
+/*
+ * Adds the handles of all acquired network devices with pending received
+ * packets to (*ready_set). Returns 1 if there are any.
+ */
+int virtio_net_pkt_poll(solo5_handle_set_t *ready_set)
 {
-    if (!net_configured)
-        return 0;
-
-    /* The device increments used->idx whenever it uses a packet (i.e. it put
-     * a packet on our receive queue) and if it's ahead of last_used it means
-     * that we have a pending packet. */
-    if (recvq.last_used == recvq.used->idx)
-        return 0;
-    else
-        return 1;
+    int ready = 0;
+
+    for (unsigned i = 0; i < nnets; i++) {
+        if (nets[i].acquired && virtq_more_used(&nets[i].recvq)) {
+            *ready_set |= 1ULL << nets[i].handle;
+            ready = 1;
+        }
+    }
+    return ready;
 }
 
-/* Get the data from the next_avail (top-most) receive buffer/descriptpr in
- * the available ring. */
-uint8_t *virtio_net_recv_pkt_get(size_t *size)
+void virtio_net_log_stats(void)
 {
-    uint16_t mask = recvq.num - 1;
-    struct virtq_used_elem *e;
-    struct io_buffer *buf;
-    uint16_t desc_idx;
-
-    /* The device increments used->idx whenever it uses a packet (i.e. it put
-     * a packet on our receive queue) and if it's ahead of last_used it means
-     * that we have a pending packet. */
-    if (recvq.last_used == recvq.used->idx)
-        return NULL;
-
-    e = &(recvq.used->ring[recvq.last_used & mask]);
-    desc_idx = e->id;
-
-    buf = (struct io_buffer *) recvq.desc[desc_idx].addr;
-    buf->len = e->len;
-
-    /* Remove the virtio_net_hdr */
-    *size = buf->len - sizeof(struct virtio_net_hdr);
-    return buf->data + sizeof(struct virtio_net_hdr);
+    for (unsigned i = 0; i < nnets; i++) {
+        struct virtio_net *n = &nets[i];
+
+        log(DEBUG, "Solo5: virtio-net %s: rx %llu packets, "
+            "%llu notifications, %llu interrupts; "
+            "tx %llu packets, %llu notifications\n",
+            n->mac_str,
+            (unsigned long long)n->rx_packets,
+            (unsigned long long)n->recvq.kicks,
+            (unsigned long long)n->interrupts,
+            (unsigned long long)n->tx_packets,
+            (unsigned long long)n->xmitq.kicks);
+    }
 }
 
-/* Return the next_avail (top-most) receive buffer/descriptor to the available
- * ring. */
-void virtio_net_recv_pkt_put(void)
+static struct virtio_net *net_get(solo5_handle_t h)
 {
-    uint16_t mask = recvq.num - 1;
-    recvq.bufs[recvq.next_avail & mask].len = PKT_BUFFER_LEN;
-    recvq.bufs[recvq.next_avail & mask].extra_flags = VIRTQ_DESC_F_WRITE;
-
-    /* This sets the returned descriptor to be ready for incoming packets, and
-     * advances the next_avail index. */
-    assert(virtq_add_descriptor_chain(&recvq, recvq.next_avail & mask, 1) == 0);
-    outw(virtio_net_pci_base + VIRTIO_PCI_QUEUE_NOTIFY, VIRTQ_RECV);
+    if (h >= MFT_MAX_ENTRIES)
+        return NULL;
+    return net_by_handle[h];
 }
 
 /*
- * FIXME: This is a single-device implementation of the new manifest-based
- * APIs. On virtio, this call has the following semantics:
- *
- * 1. The first call to solo5_net_acquire() asking for a handle to a valid
- *    network device (one specified in the application manifest) will succeed,
- *    and return a handle for the sole virtio network device.
- * 2. All subsequent calls will return an error.
- *
- * Note that the presence of a virtio network device is registered during boot
- * in (net_configured), and the initial acquisition by solo5_net_acquire() is
- * registered in (net_acquired).
+ * On virtio, network devices declared in the application manifest are
+ * backed by the virtio network devices on the PCI bus, in order: the n-th
+ * network device in the manifest is the n-th virtio network device found
+ * during PCI enumeration. If there is no such device, returns
+ * SOLO5_R_EUNSPEC.
  */
 solo5_result_t solo5_net_acquire(const char *name, solo5_handle_t *h,
         struct solo5_net_info *info)
 {
-    if (!net_configured || net_acquired)
-        return SOLO5_R_EUNSPEC;
-
     unsigned mft_index;
     struct mft_entry *mft_e = mft_get_by_name(virtio_manifest, name,
             MFT_DEV_NET_BASIC, &mft_index);
     if (mft_e == NULL)
         return SOLO5_R_EINVAL;
-    net_handle = mft_index;
-    net_acquired = true;
 
-    memcpy(info->mac_address, virtio_net_mac, sizeof info->mac_address);
-    info->mtu = 1500;
+    unsigned ordinal = 0;
+    for (unsigned i = 0; i < mft_index; i++)
+        if (virtio_manifest->e[i].type == MFT_DEV_NET_BASIC)
+            ordinal++;
+    if (ordinal >= nnets)
+        return SOLO5_R_EUNSPEC;
+
+    struct virtio_net *n = &nets[ordinal];
+    if (n->acquired)
+        return SOLO5_R_EINVAL;
+    n->acquired = true;
+    n->handle = mft_index;
+    net_by_handle[mft_index] = n;
+
+    memcpy(info->mac_address, n->mac, sizeof info->mac_address);
+    info->mtu = n->mtu;
+    info->offload = false;
     *h = mft_index;
     log(INFO, "Solo5: Application acquired '%s' as network device\n", name);
     return SOLO5_R_OK;
@@ -317,6 +438,8 @@ void solo5_yield(solo5_time_t deadline, solo5_handle_set_t *ready_set)
 {
     solo5_handle_set_t tmp_ready_set = 0;
 
+    virtio_net_flush();
+
     /*
      * cpu_block() as currently implemented will only poll for the maximum time
      * the PIT can be run in "one shot" mode. Loop until either I/O is possible
@@ -324,15 +447,17 @@ void solo5_yield(solo5_time_t deadline, solo5_handle_set_t *ready_set)
      */
     cpu_intr_disable();
     do {
-        if (net_acquired && virtio_net_pkt_poll()) {
-            tmp_ready_set |= 1UL << net_handle;
+        virtio_net_pkt_poll(&tmp_ready_set);
+        virtio_blk_completion_poll(&tmp_ready_set);
+        if (tmp_ready_set)
             break;
-        }
 
         cpu_block(deadline);
     } while (solo5_clock_monotonic() < deadline);
-    if (!tmp_ready_set && net_acquired && virtio_net_pkt_poll())
-        tmp_ready_set |= 1UL << net_handle;
+    if (!tmp_ready_set) {
+        virtio_net_pkt_poll(&tmp_ready_set);
+        virtio_blk_completion_poll(&tmp_ready_set);
+    }
     cpu_intr_enable();
 
     if (ready_set)
@@ -342,47 +467,70 @@ void solo5_yield(solo5_time_t deadline, solo5_handle_set_t *ready_set)
 solo5_result_t solo5_net_write(solo5_handle_t h, const uint8_t *buf,
         size_t size)
 {
-    if (!net_acquired || h != net_handle)
+    struct virtio_net *n = net_get(h);
+    if (n == NULL)
         return SOLO5_R_EINVAL;
 
-    int rv = virtio_net_xmit_packet(buf, size);
+    int rv = virtio_net_xmit_packet(n, buf, size);
     return (rv == 0) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
 }
 
 solo5_result_t solo5_net_read(solo5_handle_t h, uint8_t *buf, size_t size,
         size_t *read_size)
 {
-    uint8_t *pkt;
-    size_t len = size;
+    uint16_t id;
+    uint32_t len;
 
-    if (!net_acquired || h != net_handle)
+    struct virtio_net *n = net_get(h);
+    if (n == NULL)
         return SOLO5_R_EINVAL;
 
     /* We only need interrupts to wake up the application when it's sleeping
      * and waiting for incoming packets. The app is definitely not doing that
      * now (as we are here), so disable them. */
-    recvq.avail->flags |= VIRTQ_AVAIL_F_NO_INTERRUPT;
+    virtq_intr_disable(&n->recvq);
 
-    pkt = virtio_net_recv_pkt_get(&len);
-    if (!pkt) {
-        recvq.avail->flags &= ~VIRTQ_AVAIL_F_NO_INTERRUPT;
+    if (!virtq_get(&n->recvq, &id, &len)) {
+        if (n->recv_nrefill > 0)
+            recv_refill_flush(n);
+        virtq_intr_enable(&n->recvq);
         return SOLO5_R_AGAIN;
     }
 
+    /* Remove the virtio_net_hdr */
+    assert(len >= n->hdr_len);
+    len -= n->hdr_len;
     assert(len <= size);
-    assert(len <= PKT_BUFFER_LEN);
+    assert(len <= (size_t)n->mtu + SOLO5_NET_HLEN);
     *read_size = len;
 
     /* also, it's clearly not zero copy */
-    memcpy(buf, pkt, len);
-
-    /* Consume the recently used descriptor. */
-    recvq.last_used++;
-    recvq.num_avail++;
+    memcpy(buf, n->recvq.bufs[id].data + n->hdr_len, len);
 
-    virtio_net_recv_pkt_put();
+    /* Return the buffer to the device, once a batch has accumulated. */
+    n->recv_refill[n->recv_nrefill++] = id;
+    if (n->recv_nrefill >= n->recv_batch)
+        recv_refill_flush(n);
+    n->rx_packets++;
 
-    recvq.avail->flags &= ~VIRTQ_AVAIL_F_NO_INTERRUPT;
+    virtq_intr_enable(&n->recvq);
 
     return SOLO5_R_OK;
 }
+
+solo5_result_t solo5_net_write_offload(solo5_handle_t handle,
+        const struct solo5_net_offload *offload, const uint8_t *buf,
+        size_t size)
+{
+    if (!net_offload_is_none(offload))
+        return SOLO5_R_EINVAL;
+    return solo5_net_write(handle, buf, size);
+}
+
+solo5_result_t solo5_net_read_offload(solo5_handle_t handle,
+        struct solo5_net_offload *offload, uint8_t *buf, size_t size,
+        size_t *read_size)
+{
+    memset(offload, 0, sizeof *offload);
+    return solo5_net_read(handle, buf, size, read_size);
+}
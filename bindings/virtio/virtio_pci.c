@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "bindings.h"
+#include "virtio_ring.h"
+#include "virtio_pci.h"
+
+#define PCI_CONF_COMMAND        0x04
+#define PCI_COMMAND_MEMORY      0x2
+#define PCI_COMMAND_MASTER      0x4
+#define PCI_CONF_STATUS         0x06
+#define PCI_STATUS_CAP_LIST     0x10
+#define PCI_CONF_CAP_PTR        0x34
+#define PCI_CAP_ID_VNDR         0x09
+
+/*
+ * Page table entry bits for mapping device memory: present, writable, 2MB
+ * page, caching disabled.
+ */
+#define PTE_P                   0x1
+#define PTE_RW                  0x2
+#define PTE_PWT                 0x8
+#define PTE_PCD                 0x10
+#define PTE_PS                  0x80
+#define PTE_ADDR_MASK           0x000ffffffffff000ULL
+#define MMIO_PAGE_SIZE          (1ULL << 21)
+
+extern uint64_t cpu_pml4[];
+
+/*
+ * The modern transport, packed virtqueues and VIRTIO_F_EVENT_IDX are only
+ * used if enabled with "configure.sh --enable-virtio-modern". Otherwise all
+ * devices are driven using the legacy transport and split virtqueues.
+ */
+#ifdef VIRTIO_ENABLE_MODERN
+static const bool virtio_modern_enabled = true;
+#else
+static const bool virtio_modern_enabled = false;
+#endif
+
+static inline uint8_t mmio_read8(volatile uint8_t *base, unsigned off)
+{
+    return *(volatile uint8_t *)(base + off);
+}
+
+static inline uint16_t mmio_read16(volatile uint8_t *base, unsigned off)
+{
+    return *(volatile uint16_t *)(base + off);
+}
+
+static inline uint32_t mmio_read32(volatile uint8_t *base, unsigned off)
+{
+    return *(volatile uint32_t *)(base + off);
+}
+
+static inline void mmio_write8(volatile uint8_t *base, unsigned off,
+        uint8_t v)
+{
+    *(volatile uint8_t *)(base + off) = v;
+}
+
+static inline void mmio_write16(volatile uint8_t *base, unsigned off,
+        uint16_t v)
+{
+    *(volatile uint16_t *)(base + off) = v;
+}
+
+static inline void mmio_write32(volatile uint8_t *base, unsigned off,
+        uint32_t v)
+{
+    *(volatile uint32_t *)(base + off) = v;
+}
+
+static inline void mmio_write64(volatile uint8_t *base, unsigned off,
+        uint64_t v)
+{
+    mmio_write32(base, off, (uint32_t)v);
+    mmio_write32(base, off + 4, (uint32_t)(v >> 32));
+}
+
+/*
+ * Returns the next level page table referenced by entry (idx) of (table),
+ * allocating it if not present.
+ */
+static uint64_t *pt_next(uint64_t *table, unsigned idx)
+{
+    if (!(table[idx] & PTE_P)) {
+        uint64_t *pt = mem_ialloc_pages(1);
+        assert(pt);
+        memset(pt, 0, PAGE_SIZE);
+        table[idx] = (uint64_t)pt | PTE_P | PTE_RW;
+    }
+    assert(!(table[idx] & PTE_PS));
+    return (uint64_t *)(table[idx] & PTE_ADDR_MASK);
+}
+
+/*
+ * boot.S only maps the first 1GB of memory, which PCI memory BARs are
+ * usually outside of. Identity map (len) bytes of device memory at (addr),
+ * uncached.
+ */
+static volatile uint8_t *mmio_map(uint64_t addr, uint64_t len)
+{
+    uint64_t start = addr & ~(MMIO_PAGE_SIZE - 1);
+
+    for (uint64_t a = start; a < addr + len; a += MMIO_PAGE_SIZE) {
+        uint64_t *pdpt = pt_next(cpu_pml4, (a >> 39) & 0x1ff);
+        uint64_t *pd = pt_next(pdpt, (a >> 30) & 0x1ff);
+        pd[(a >> 21) & 0x1ff] = a | PTE_P | PTE_RW | PTE_PS | PTE_PWT |
+            PTE_PCD;
+    }
+    /* Flush the TLB */
+    __asm__ __volatile__("mov %%cr3, %%rax; mov %%rax, %%cr3"
+            : : : "rax", "memory");
+
+    return (volatile uint8_t *)addr;
+}
+
+/*
+ * Looks for the virtio 1.0 vendor-specific capabilities of (pci) and maps
+ * the structures they describe. Returns true if all required structures are
+ * present.
+ */
+static bool virtio_pci_modern_probe(struct virtio_dev *dev,
+        struct pci_config_info *pci)
+{
+    if (!(pci_config_read16(pci, PCI_CONF_STATUS) & PCI_STATUS_CAP_LIST))
+        return false;
+
+    uint8_t pos = pci_config_read8(pci, PCI_CONF_CAP_PTR) & ~0x3;
+    while (pos) {
+        uint8_t id = pci_config_read8(pci, pos);
+        uint8_t next = pci_config_read8(pci, pos + 1);
+
+        if (id == PCI_CAP_ID_VNDR) {
+            uint8_t type = pci_config_read8(pci, pos + VIRTIO_PCI_CAP_CFG_TYPE);
+            uint8_t bar = pci_config_read8(pci, pos + VIRTIO_PCI_CAP_BAR);
+            uint32_t off = pci_config_read32(pci, pos + VIRTIO_PCI_CAP_OFFSET);
+            uint32_t len = pci_config_read32(pci, pos + VIRTIO_PCI_CAP_LENGTH);
+            uint64_t base = (bar < 6) ? pci_bar_address(pci, bar) : 0;
+
+            /*
+             * Use the first capability of each type, as recommended by the
+             * specification.
+             */
+            if (base != 0 && len != 0) {
+                switch (type) {
+                case VIRTIO_PCI_CAP_COMMON_CFG:
+                    if (!dev->common_cfg)
+                        dev->common_cfg = mmio_map(base + off, len);
+                    break;
+                case VIRTIO_PCI_CAP_NOTIFY_CFG:
+                    if (!dev->notify_base) {
+                        dev->notify_base = mmio_map(base + off, len);
+                        dev->notify_off_multiplier = pci_config_read32(pci,
+                                pos + VIRTIO_PCI_NOTIFY_CAP_MULT);
+                    }
+                    break;
+                case VIRTIO_PCI_CAP_ISR_CFG:
+                    if (!dev->isr_cfg)
+                        dev->isr_cfg = mmio_map(base + off, len);
+                    break;
+                case VIRTIO_PCI_CAP_DEVICE_CFG:
+                    if (!dev->device_cfg)
+                        dev->device_cfg = mmio_map(base + off, len);
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+        pos = next & ~0x3;
+    }
+
+    if (!dev->common_cfg || !dev->notify_base || !dev->isr_cfg ||
+            !dev->device_cfg)
+        return false;
+
+    uint16_t cmd = pci_config_read16(pci, PCI_CONF_COMMAND);
+    pci_config_write16(pci, PCI_CONF_COMMAND,
+            cmd | PCI_COMMAND_MEMORY | PCI_COMMAND_MASTER);
+    return true;
+}
+
+static uint8_t virtio_dev_get_status(struct virtio_dev *dev)
+{
+    if (dev->modern)
+        return mmio_read8(dev->common_cfg, VIRTIO_PCI_COMMON_STATUS);
+    else
+        return inb(dev->io_base + VIRTIO_PCI_STATUS);
+}
+
+static void virtio_dev_set_status(struct virtio_dev *dev, uint8_t status)
+{
+    if (dev->modern)
+        mmio_write8(dev->common_cfg, VIRTIO_PCI_COMMON_STATUS, status);
+    else
+        outb(dev->io_base + VIRTIO_PCI_STATUS, status);
+}
+
+int virtio_dev_init(struct virtio_dev *dev, struct pci_config_info *pci)
+{
+    memset(dev, 0, sizeof *dev);
+    dev->io_base = pci->base;
+    dev->modern = virtio_modern_enabled && virtio_pci_modern_probe(dev, pci);
+    if (!dev->modern && pci->device_id >= PCI_DEVICE_ID_VIRTIO_MODERN) {
+        if (virtio_modern_enabled)
+            log(WARN, "Solo5: PCI:%02x:%02x: modern-only device without "
+                    "virtio capabilities\n", pci->bus, pci->dev);
+        else
+            log(WARN, "Solo5: PCI:%02x:%02x: modern-only device not "
+                    "supported\n", pci->bus, pci->dev);
+        return -1;
+    }
+
+    /*
+     * 3.1.1 Driver Requirements: Device Initialization
+     *
+     * 1. Reset the device.
+     */
+    virtio_dev_set_status(dev, 0);
+    if (dev->modern) {
+        while (virtio_dev_get_status(dev) != 0)
+            ;
+    }
+
+    /*
+     * 2. Set the ACKNOWLEDGE status bit: the guest OS has notice the device.
+     * 3. Set the DRIVER status bit: the guest OS knows how to drive the device.
+     */
+    virtio_dev_set_status(dev, VIRTIO_PCI_STATUS_ACK);
+    virtio_dev_set_status(dev, VIRTIO_PCI_STATUS_ACK |
+            VIRTIO_PCI_STATUS_DRIVER);
+    return 0;
+}
+
+uint64_t virtio_dev_negotiate(struct virtio_dev *dev, uint64_t wanted)
+{
+    uint64_t host_features;
+
+    if (!virtio_modern_enabled)
+        wanted &= ~(1ULL << VIRTIO_F_EVENT_IDX);
+    if (dev->modern) {
+        mmio_write32(dev->common_cfg, VIRTIO_PCI_COMMON_DFSELECT, 0);
+        host_features = mmio_read32(dev->common_cfg, VIRTIO_PCI_COMMON_DF);
+        mmio_write32(dev->common_cfg, VIRTIO_PCI_COMMON_DFSELECT, 1);
+        host_features |= (uint64_t)mmio_read32(dev->common_cfg,
+                VIRTIO_PCI_COMMON_DF) << 32;
+        wanted |= (1ULL << VIRTIO_F_VERSION_1) |
+            (1ULL << VIRTIO_F_RING_PACKED);
+    }
+    else {
+        host_features = inl(dev->io_base + VIRTIO_PCI_HOST_FEATURES);
+    }
+
+    dev->features = host_features & wanted;
+
+    if (dev->modern) {
+        assert(virtio_dev_has(dev, VIRTIO_F_VERSION_1));
+        mmio_write32(dev->common_cfg, VIRTIO_PCI_COMMON_GFSELECT, 0);
+        mmio_write32(dev->common_cfg, VIRTIO_PCI_COMMON_GF,
+                (uint32_t)dev->features);
+        mmio_write32(dev->common_cfg, VIRTIO_PCI_COMMON_GFSELECT, 1);
+        mmio_write32(dev->common_cfg, VIRTIO_PCI_COMMON_GF,
+                (uint32_t)(dev->features >> 32));
+
+        /*
+         * 5. Set the FEATURES_OK status bit.
+         * 6. Re-read device status to ensure the FEATURES_OK bit is still
+         * set: otherwise, the device does not support our subset of features.
+         */
+        virtio_dev_set_status(dev, virtio_dev_get_status(dev) |
+                VIRTIO_PCI_STATUS_FEATURES_OK);
+        if (!(virtio_dev_get_status(dev) & VIRTIO_PCI_STATUS_FEATURES_OK))
+            PANIC("virtio: device rejected features", NULL);
+    }
+    else {
+        outl(dev->io_base + VIRTIO_PCI_GUEST_FEATURES,
+                (uint32_t)dev->features);
+    }
+
+    return dev->features;
+}
+
+uint8_t virtio_dev_config8(struct virtio_dev *dev, unsigned off)
+{
+    if (dev->modern)
+        return mmio_read8(dev->device_cfg, off);
+    else
+        return inb(dev->io_base + VIRTIO_PCI_CONFIG_OFF + off);
+}
+
+uint16_t virtio_dev_config16(struct virtio_dev *dev, unsigned off)
+{
+    if (dev->modern)
+        return mmio_read16(dev->device_cfg, off);
+    else
+        return inw(dev->io_base + VIRTIO_PCI_CONFIG_OFF + off);
+}
+
+uint32_t virtio_dev_config32(struct virtio_dev *dev, unsigned off)
+{
+    if (dev->modern)
+        return mmio_read32(dev->device_cfg, off);
+    else
+        return inl(dev->io_base + VIRTIO_PCI_CONFIG_OFF + off);
+}
+
+uint64_t virtio_dev_config64(struct virtio_dev *dev, unsigned off)
+{
+    uint32_t lo, hi;
+    uint8_t gen;
+
+    if (!dev->modern)
+        return inq(dev->io_base + VIRTIO_PCI_CONFIG_OFF + off);
+
+    /*
+     * The device may change its configuration between the two reads; retry
+     * until the configuration generation is stable.
+     */
+    do {
+        gen = mmio_read8(dev->common_cfg, VIRTIO_PCI_COMMON_CFGGENERATION);
+        lo = mmio_read32(dev->device_cfg, off);
+        hi = mmio_read32(dev->device_cfg, off + 4);
+    } while (gen !=
+            mmio_read8(dev->common_cfg, VIRTIO_PCI_COMMON_CFGGENERATION));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+uint8_t virtio_dev_isr(struct virtio_dev *dev)
+{
+    if (dev->modern)
+        return mmio_read8(dev->isr_cfg, 0);
+    else
+        return inb(dev->io_base + VIRTIO_PCI_ISR);
+}
+
+void virtio_dev_setup_queue(struct virtio_dev *dev, struct virtq *vq,
+        uint16_t index)
+{
+    vq->packed = virtio_dev_has(dev, VIRTIO_F_RING_PACKED);
+    vq->event_idx = virtio_dev_has(dev, VIRTIO_F_EVENT_IDX);
+    vq->indirect = virtio_dev_has(dev, VIRTIO_F_INDIRECT_DESC);
+    vq->index = index;
+
+    if (!dev->modern) {
+        outw(dev->io_base + VIRTIO_PCI_QUEUE_SEL, index);
+        vq->num = inw(dev->io_base + VIRTIO_PCI_QUEUE_SIZE);
+        virtq_init_rings(vq);
+        outl(dev->io_base + VIRTIO_PCI_QUEUE_PFN, (uint64_t)vq->desc
+                >> VIRTIO_PCI_QUEUE_ADDR_SHIFT);
+        vq->io_base = dev->io_base;
+        return;
+    }
+
+    volatile uint8_t *cfg = dev->common_cfg;
+    mmio_write16(cfg, VIRTIO_PCI_COMMON_Q_SELECT, index);
+    vq->num = mmio_read16(cfg, VIRTIO_PCI_COMMON_Q_SIZE);
+    virtq_init_rings(vq);
+
+    if (vq->packed) {
+        mmio_write64(cfg, VIRTIO_PCI_COMMON_Q_DESCLO, (uint64_t)vq->pdesc);
+        mmio_write64(cfg, VIRTIO_PCI_COMMON_Q_AVAILLO,
+                (uint64_t)vq->driver_event);
+        mmio_write64(cfg, VIRTIO_PCI_COMMON_Q_USEDLO,
+                (uint64_t)vq->device_event);
+    }
+    else {
+        mmio_write64(cfg, VIRTIO_PCI_COMMON_Q_DESCLO, (uint64_t)vq->desc);
+        mmio_write64(cfg, VIRTIO_PCI_COMMON_Q_AVAILLO, (uint64_t)vq->avail);
+        mmio_write64(cfg, VIRTIO_PCI_COMMON_Q_USEDLO, (uint64_t)vq->used);
+    }
+    mmio_write16(cfg, VIRTIO_PCI_COMMON_Q_MSIX, VIRTIO_MSI_NO_VECTOR);
+
+    uint16_t notify_off = mmio_read16(cfg, VIRTIO_PCI_COMMON_Q_NOFF);
+    vq->notify = (volatile le16 *)(dev->notify_base +
+            notify_off * dev->notify_off_multiplier);
+
+    mmio_write16(cfg, VIRTIO_PCI_COMMON_Q_ENABLE, 1);
+}
+
+void virtio_dev_ready(struct virtio_dev *dev)
+{
+    virtio_dev_set_status(dev, virtio_dev_get_status(dev) |
+            VIRTIO_PCI_STATUS_DRIVER_OK);
+}
@@ -55,4 +55,115 @@
 /* xxx assuming msi is not configured */
 #define VIRTIO_PCI_CONFIG_OFF           20
 
+/* Additional status bits, virtio 1.0 and later */
+#define VIRTIO_PCI_STATUS_FEATURES_OK   0x8  /* feature negotiation complete */
+
+/* Device IDs of modern-only devices are 0x1040 + device type */
+#define PCI_DEVICE_ID_VIRTIO_MODERN     0x1040
+
+/* Transport feature bits */
+#define VIRTIO_F_VERSION_1              32   /* virtio 1.0 compliant device */
+#define VIRTIO_F_RING_PACKED            34   /* packed virtqueue layout */
+
+/*
+ * Virtio 1.0 ("modern") PCI transport: the device describes the location of
+ * its configuration structures using vendor-specific PCI capabilities.
+ */
+#define VIRTIO_PCI_CAP_COMMON_CFG       1
+#define VIRTIO_PCI_CAP_NOTIFY_CFG       2
+#define VIRTIO_PCI_CAP_ISR_CFG          3
+#define VIRTIO_PCI_CAP_DEVICE_CFG       4
+
+/* Offsets in struct virtio_pci_cap */
+#define VIRTIO_PCI_CAP_CFG_TYPE         3
+#define VIRTIO_PCI_CAP_BAR              4
+#define VIRTIO_PCI_CAP_OFFSET           8
+#define VIRTIO_PCI_CAP_LENGTH           12
+#define VIRTIO_PCI_NOTIFY_CAP_MULT      16
+
+/* Offsets in struct virtio_pci_common_cfg */
+#define VIRTIO_PCI_COMMON_DFSELECT      0    /* 32-bit r/w */
+#define VIRTIO_PCI_COMMON_DF            4    /* 32-bit r/o */
+#define VIRTIO_PCI_COMMON_GFSELECT      8    /* 32-bit r/w */
+#define VIRTIO_PCI_COMMON_GF            12   /* 32-bit r/w */
+#define VIRTIO_PCI_COMMON_MSIX          16   /* 16-bit r/w */
+#define VIRTIO_PCI_COMMON_NUMQ          18   /* 16-bit r/o */
+#define VIRTIO_PCI_COMMON_STATUS        20   /* 8-bit r/w */
+#define VIRTIO_PCI_COMMON_CFGGENERATION 21   /* 8-bit r/o */
+#define VIRTIO_PCI_COMMON_Q_SELECT      22   /* 16-bit r/w */
+#define VIRTIO_PCI_COMMON_Q_SIZE        24   /* 16-bit r/w */
+#define VIRTIO_PCI_COMMON_Q_MSIX        26   /* 16-bit r/w */
+#define VIRTIO_PCI_COMMON_Q_ENABLE      28   /* 16-bit r/w */
+#define VIRTIO_PCI_COMMON_Q_NOFF        30   /* 16-bit r/o */
+#define VIRTIO_PCI_COMMON_Q_DESCLO      32   /* 32-bit r/w */
+#define VIRTIO_PCI_COMMON_Q_DESCHI      36   /* 32-bit r/w */
+#define VIRTIO_PCI_COMMON_Q_AVAILLO     40   /* 32-bit r/w */
+#define VIRTIO_PCI_COMMON_Q_AVAILHI     44   /* 32-bit r/w */
+#define VIRTIO_PCI_COMMON_Q_USEDLO      48   /* 32-bit r/w */
+#define VIRTIO_PCI_COMMON_Q_USEDHI      52   /* 32-bit r/w */
+
+#define VIRTIO_MSI_NO_VECTOR            0xffff
+
+struct virtq;
+
+/*
+ * A virtio PCI device, driven using either the legacy I/O port transport or
+ * the modern (virtio 1.0) transport with MMIO configuration structures.
+ */
+struct virtio_dev {
+    bool modern;
+    uint16_t io_base;                   /* legacy: base in PCI config space */
+    volatile uint8_t *common_cfg;       /* modern: common configuration */
+    volatile uint8_t *isr_cfg;          /* modern: ISR status */
+    volatile uint8_t *device_cfg;       /* modern: device configuration */
+    volatile uint8_t *notify_base;      /* modern: queue notifications */
+    uint32_t notify_off_multiplier;
+    uint64_t features;                  /* negotiated features */
+};
+
+/*
+ * Resets the device described by (pci) and sets the ACKNOWLEDGE and DRIVER
+ * status bits. Uses the modern transport if it is enabled and the device
+ * supports it. Returns -1 if the device cannot be driven.
+ */
+int virtio_dev_init(struct virtio_dev *dev, struct pci_config_info *pci);
+
+/*
+ * Negotiates the subset of (wanted) which the device also offers, and returns
+ * it. Transport features (VIRTIO_F_VERSION_1 and the ring layout) are added
+ * as appropriate, and VIRTIO_F_EVENT_IDX is removed unless the modern
+ * transport is enabled. Returns with dev->features set.
+ */
+uint64_t virtio_dev_negotiate(struct virtio_dev *dev, uint64_t wanted);
+
+static inline bool virtio_dev_has(const struct virtio_dev *dev, unsigned bit)
+{
+    return (dev->features & (1ULL << bit)) != 0;
+}
+
+/*
+ * Reads from the device-specific configuration space.
+ */
+uint8_t virtio_dev_config8(struct virtio_dev *dev, unsigned off);
+uint16_t virtio_dev_config16(struct virtio_dev *dev, unsigned off);
+uint32_t virtio_dev_config32(struct virtio_dev *dev, unsigned off);
+uint64_t virtio_dev_config64(struct virtio_dev *dev, unsigned off);
+
+/*
+ * Reads (and thereby acknowledges) the ISR status register.
+ */
+uint8_t virtio_dev_isr(struct virtio_dev *dev);
+
+/*
+ * Sets up virtqueue number (index) of the device, using the ring layout
+ * negotiated by virtio_dev_negotiate().
+ */
+void virtio_dev_setup_queue(struct virtio_dev *dev, struct virtq *vq,
+        uint16_t index);
+
+/*
+ * Sets the DRIVER_OK status bit. At this point the device is "live".
+ */
+void virtio_dev_ready(struct virtio_dev *dev);
+
 #endif
@@ -30,81 +30,350 @@
 
 
 /*
- * Create a descriptor chain starting at index head, using vq->bufs also
- * starting at index head.
- * Make sure the vq-bufs are cleaned before using them again.
+ * Full memory barrier. Needed where the driver publishes a change to the
+ * rings and then reads state written by the device (which runs
+ * concurrently on another host CPU): x86 may reorder a load before an
+ * earlier store.
  */
-int virtq_add_descriptor_chain(struct virtq *vq,
-                               uint16_t head,
-                               uint16_t num)
+static inline void virtq_mb(void)
+{
+    __asm__ __volatile__("mfence" : : : "memory");
+}
+
+void virtq_init_rings(struct virtq *vq)
+{
+    uint8_t *data;
+    size_t size, pgs;
+
+    assert(vq->num > 0);
+    assert(vq->num <= VIRTQ_MAX_QUEUE_SIZE);
+    /* Split virtqueue sizes are always a power of 2 */
+    assert(vq->packed || (vq->num & (vq->num - 1)) == 0);
+
+    vq->last_used = vq->next_avail = vq->num_added = 0;
+    vq->num_avail = vq->num;
+
+    size = vq->packed ? VIRTQ_PACKED_SIZE(vq->num) : VIRTQ_SIZE(vq->num);
+    pgs = ((size - 1) >> PAGE_SHIFT) + 1;
+    data = mem_ialloc_pages(pgs);
+    assert(data);
+    memset(data, 0, pgs << PAGE_SHIFT);
+
+    if (vq->packed) {
+        vq->pdesc = (struct virtq_packed_desc *)data;
+        vq->driver_event = (struct virtq_event *)
+            (data + VIRTQ_PACKED_OFF_DRIVER(vq->num));
+        vq->device_event = (struct virtq_event *)
+            (data + VIRTQ_PACKED_OFF_DEVICE(vq->num));
+        vq->avail_wrap = vq->used_wrap = true;
+    }
+    else {
+        vq->desc = (struct virtq_desc *)(data + VIRTQ_OFF_DESC(vq->num));
+        vq->avail = (struct virtq_avail *)(data + VIRTQ_OFF_AVAIL(vq->num));
+        vq->used = (struct virtq_used *)(data + VIRTQ_OFF_USED(vq->num));
+        /* Chain all descriptors into the free list */
+        for (unsigned i = 0; i < vq->num; i++)
+            vq->desc[i].next = i + 1;
+        vq->free_head = 0;
+    }
+
+    pgs = (((2 * vq->num * sizeof(uint16_t)) - 1) >> PAGE_SHIFT) + 1;
+    vq->chain_len = mem_ialloc_pages(pgs);
+    assert(vq->chain_len);
+    memset(vq->chain_len, 0, pgs << PAGE_SHIFT);
+    vq->buf_id = vq->chain_len + vq->num;
+}
+
+static void virtq_add_split(struct virtq *vq, uint16_t id,
+        const struct virtq_buf *bufs, unsigned n, struct virtq_desc *table)
 {
     uint16_t mask = vq->num - 1;
-    struct virtq_desc *desc;
-    uint16_t i;
-    uint16_t used_descs = num;
+    uint16_t head = vq->free_head;
+    uint16_t i = head;
+    struct virtq_desc *desc = NULL;
 
-    if (vq->num_avail < used_descs) {
-        log(WARN, "Solo5: virtq full! next_avail:%d last_used:%d\n",
-            vq->next_avail, vq->last_used);
-        return -1;
+    if (table) {
+        for (unsigned k = 0; k < n; k++) {
+            table[k].addr = bufs[k].addr;
+            table[k].len = bufs[k].len;
+            table[k].flags = (k + 1 < n ? VIRTQ_DESC_F_NEXT : 0) |
+                (bufs[k].write ? VIRTQ_DESC_F_WRITE : 0);
+            table[k].next = k + 1;
+        }
+        desc = &vq->desc[head];
+        desc->addr = (uint64_t)table;
+        desc->len = n * sizeof(struct virtq_desc);
+        desc->flags = VIRTQ_DESC_F_INDIRECT;
+        /* (next) is left pointing to the next free descriptor */
+        vq->free_head = desc->next;
+        vq->chain_len[head] = 1;
+    }
+    else {
+        /*
+         * Descriptors are taken from the head of the free list, whose (next)
+         * links already chain them together.
+         */
+        for (unsigned k = 0; k < n; k++) {
+            desc = &vq->desc[i];
+            desc->addr = bufs[k].addr;
+            desc->len = bufs[k].len;
+            desc->flags = (k + 1 < n ? VIRTQ_DESC_F_NEXT : 0) |
+                (bufs[k].write ? VIRTQ_DESC_F_WRITE : 0);
+            i = desc->next;
+        }
+        vq->free_head = i;
+        vq->chain_len[head] = n;
     }
+    vq->buf_id[head] = id;
+    vq->num_avail -= vq->chain_len[head];
 
-    assert(used_descs > 0);
+    vq->avail->ring[vq->avail->idx & mask] = head;
+    /* The device must see the descriptors before the new index */
+    cc_barrier();
+    /* avail->idx always increments and wraps naturally at 65536 */
+    vq->avail->idx++;
+    vq->num_added++;
+}
 
-    for (i = head; used_descs > 0; used_descs--) {
-        desc = &(vq->desc[i]);
+static void virtq_add_packed(struct virtq *vq, uint16_t id,
+        const struct virtq_buf *bufs, unsigned n,
+        struct virtq_packed_desc *table)
+{
+    uint16_t head = vq->next_avail;
+    uint16_t i = head;
+    bool wrap = vq->avail_wrap;
+    uint16_t head_flags = 0;
+    unsigned ndesc = table ? 1 : n;
 
-        assert(vq->bufs[i].len <= MAX_BUFFER_LEN);
+    if (table) {
+        for (unsigned k = 0; k < n; k++) {
+            table[k].addr = bufs[k].addr;
+            table[k].len = bufs[k].len;
+            table[k].id = 0;
+            table[k].flags = bufs[k].write ? VIRTQ_DESC_F_WRITE : 0;
+        }
+    }
+
+    for (unsigned k = 0; k < ndesc; k++) {
+        struct virtq_packed_desc *desc = &vq->pdesc[i];
+        uint16_t flags;
+
+        if (table) {
+            desc->addr = (uint64_t)table;
+            desc->len = n * sizeof(struct virtq_packed_desc);
+            flags = VIRTQ_DESC_F_INDIRECT;
+        }
+        else {
+            desc->addr = bufs[k].addr;
+            desc->len = bufs[k].len;
+            flags = (k + 1 < n ? VIRTQ_DESC_F_NEXT : 0) |
+                (bufs[k].write ? VIRTQ_DESC_F_WRITE : 0);
+        }
+        desc->id = id;
+        flags |= wrap ? VIRTQ_DESC_F_AVAIL : VIRTQ_DESC_F_USED;
 
         /*
-         * The first field of a "struct io_buffer" is the "data" field, so in
-         * the interrupt handler we can just cast this pointer back into a
-         * 'struct io_buffer'.
+         * The device may start processing as soon as the head descriptor is
+         * marked available, so do that last.
          */
-        assert(vq->bufs[i].data == (uint8_t *) &vq->bufs[i]);
-        desc->addr = (uint64_t) vq->bufs[i].data;
-        desc->len = vq->bufs[i].len;
-        desc->flags = VIRTQ_DESC_F_NEXT | vq->bufs[i].extra_flags;
+        if (k == 0)
+            head_flags = flags;
+        else
+            desc->flags = flags;
 
-        i = (i + 1) & mask;
-        desc->next = i;
+        if (++i == vq->num) {
+            i = 0;
+            wrap = !wrap;
+        }
     }
 
-    /* The last descriptor in the chain does not have a next */
-    desc->next = 0;
-    desc->flags &= ~VIRTQ_DESC_F_NEXT;
+    vq->chain_len[id] = ndesc;
+    vq->num_avail -= ndesc;
+    vq->next_avail = i;
+    vq->avail_wrap = wrap;
+    vq->num_added += ndesc;
 
-    vq->num_avail -= num;
-    /* Memory barriers should be unnecessary with one processor */
-    vq->avail->ring[vq->avail->idx & mask] = head;
-    /* avail->idx always increments and wraps naturally at 65536 */
-    vq->avail->idx++;
-    vq->next_avail += num;
+    cc_barrier();
+    vq->pdesc[head].flags = head_flags;
+}
+
+int virtq_add(struct virtq *vq, uint16_t id, const struct virtq_buf *bufs,
+        unsigned n, void *indirect)
+{
+    bool use_indirect = (indirect != NULL) && vq->indirect && n > 1;
+    unsigned ndesc = use_indirect ? 1 : n;
+
+    assert(n > 0);
+    assert(id < vq->num);
+
+    if (vq->num_avail < ndesc)
+        return -1;
+
+    if (vq->packed)
+        virtq_add_packed(vq, id, bufs, n, use_indirect ? indirect : NULL);
+    else
+        virtq_add_split(vq, id, bufs, n, use_indirect ? indirect : NULL);
 
     return 0;
 }
 
-void virtq_init_rings(uint16_t pci_base, struct virtq *vq, int selector)
+bool virtq_more_used(struct virtq *vq)
+{
+    if (vq->packed) {
+        uint16_t flags = vq->pdesc[vq->last_used].flags;
+        bool avail = (flags & VIRTQ_DESC_F_AVAIL) != 0;
+        bool used = (flags & VIRTQ_DESC_F_USED) != 0;
+
+        return avail == used && used == vq->used_wrap;
+    }
+    else
+        return vq->last_used != vq->used->idx;
+}
+
+bool virtq_get(struct virtq *vq, uint16_t *id, uint32_t *len)
+{
+    if (!virtq_more_used(vq))
+        return false;
+    /* Read the used element only after seeing it is there */
+    cc_barrier();
+
+    if (vq->packed) {
+        struct virtq_packed_desc *desc = &vq->pdesc[vq->last_used];
+        uint16_t n;
+
+        *id = desc->id;
+        *len = desc->len;
+        assert(*id < vq->num);
+
+        /*
+         * The device writes a single used descriptor for the whole buffer,
+         * and then skips the remaining descriptors of the buffer.
+         */
+        n = vq->chain_len[*id];
+        vq->num_avail += n;
+        vq->last_used += n;
+        if (vq->last_used >= vq->num) {
+            vq->last_used -= vq->num;
+            vq->used_wrap = !vq->used_wrap;
+        }
+    }
+    else {
+        uint16_t mask = vq->num - 1;
+        struct virtq_used_elem *e = &vq->used->ring[vq->last_used & mask];
+        uint16_t head = e->id;
+        uint16_t last = head;
+
+        assert(head < vq->num);
+        *id = vq->buf_id[head];
+        *len = e->len;
+
+        /* Return the descriptors to the free list */
+        for (unsigned k = 1; k < vq->chain_len[head]; k++)
+            last = vq->desc[last].next;
+        vq->desc[last].next = vq->free_head;
+        vq->free_head = head;
+        vq->num_avail += vq->chain_len[head];
+        vq->last_used++;
+    }
+
+    return true;
+}
+
+void virtq_kick(struct virtq *vq)
+{
+    bool need_kick;
+
+    if (vq->num_added == 0)
+        return;
+
+    virtq_mb();
+
+    if (vq->packed) {
+        uint16_t flags = vq->device_event->flags;
+
+        if (flags == VIRTQ_EVENT_F_DESC) {
+            uint16_t off_wrap = vq->device_event->off_wrap;
+            uint16_t event_idx = off_wrap & 0x7fff;
+            bool wrap = (off_wrap >> 15) != 0;
+            uint16_t new_idx = vq->next_avail;
+            uint16_t old_idx = new_idx - vq->num_added;
+
+            if (wrap != vq->avail_wrap)
+                event_idx -= vq->num;
+            need_kick = virtq_need_event(event_idx, new_idx, old_idx);
+        }
+        else
+            need_kick = (flags != VIRTQ_EVENT_F_DISABLE);
+    }
+    else if (vq->event_idx) {
+        uint16_t new_idx = vq->avail->idx;
+        uint16_t old_idx = new_idx - vq->num_added;
+
+        need_kick = virtq_need_event(*virtq_avail_event(vq), new_idx,
+                old_idx);
+    }
+    else
+        need_kick = !(vq->used->flags & VIRTQ_USED_F_NO_NOTIFY);
+
+    vq->num_added = 0;
+    if (!need_kick)
+        return;
+
+    vq->kicks++;
+    if (vq->notify)
+        *vq->notify = vq->index;
+    else
+        outw(vq->io_base + VIRTIO_PCI_QUEUE_NOTIFY, vq->index);
+}
+
+void virtq_intr_disable(struct virtq *vq)
+{
+    if (vq->packed) {
+        vq->driver_event->flags = VIRTQ_EVENT_F_DISABLE;
+    }
+    else {
+        vq->avail->flags |= VIRTQ_AVAIL_F_NO_INTERRUPT;
+        /*
+         * With VIRTIO_F_EVENT_IDX the flag above is ignored; set used_event
+         * to an index the device has already passed instead.
+         */
+        if (vq->event_idx)
+            *virtq_used_event(vq) = vq->last_used - 1;
+    }
+}
+
+bool virtq_intr_enable(struct virtq *vq)
+{
+    if (vq->packed) {
+        vq->driver_event->flags = VIRTQ_EVENT_F_ENABLE;
+    }
+    else {
+        vq->avail->flags &= ~VIRTQ_AVAIL_F_NO_INTERRUPT;
+        /* Interrupt us once the device uses the next buffer */
+        if (vq->event_idx)
+            *virtq_used_event(vq) = vq->last_used;
+    }
+
+    virtq_mb();
+    return virtq_more_used(vq);
+}
+
+void virtq_init_bufs(struct virtq *vq, size_t buf_size)
 {
     uint8_t *data;
     size_t pgs;
-    
-    outw(pci_base + VIRTIO_PCI_QUEUE_SEL, selector);
-    vq->last_used = vq->next_avail = 0;
-    vq->num = vq->num_avail = inw(pci_base + VIRTIO_PCI_QUEUE_SIZE);
 
-    pgs = ((VIRTQ_SIZE(vq->num) - 1) >> PAGE_SHIFT) + 1;
+    pgs = (((vq->num * sizeof (struct io_buffer)) - 1) >> PAGE_SHIFT) + 1;
+    vq->bufs = mem_ialloc_pages(pgs);
+    assert(vq->bufs);
+    memset(vq->bufs, 0, pgs << PAGE_SHIFT);
+
+    pgs = (((vq->num * buf_size) - 1) >> PAGE_SHIFT) + 1;
     data = mem_ialloc_pages(pgs);
     assert(data);
     memset(data, 0, pgs << PAGE_SHIFT);
 
-    assert(vq->num <= VIRTQ_MAX_QUEUE_SIZE);
-
-    vq->desc = (struct virtq_desc *)(data + VIRTQ_OFF_DESC(vq->num));
-    vq->avail = (struct virtq_avail *)(data + VIRTQ_OFF_AVAIL(vq->num));
-    vq->used = (struct virtq_used *)(data + VIRTQ_OFF_USED(vq->num));
-
-    outw(pci_base + VIRTIO_PCI_QUEUE_SEL, selector);
-    outl(pci_base + VIRTIO_PCI_QUEUE_PFN, (uint64_t) data
-         >> VIRTIO_PCI_QUEUE_ADDR_SHIFT);
+    for (unsigned i = 0; i < vq->num; i++)
+        vq->bufs[i].data = data + (i * buf_size);
+    vq->buf_size = buf_size;
 }
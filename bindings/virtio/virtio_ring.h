@@ -62,17 +62,41 @@ typedef uint64_t le64;
 /* Arbitrary descriptor layouts. */
 #define VIRTIO_F_ANY_LAYOUT       27
 
+/* Packed virtqueue descriptor flags */
+#define VIRTQ_DESC_F_AVAIL      (1 << 7)
+#define VIRTQ_DESC_F_USED       (1 << 15)
+
+/* Packed virtqueue event suppression flags */
+#define VIRTQ_EVENT_F_ENABLE    0x0
+#define VIRTQ_EVENT_F_DISABLE   0x1
+#define VIRTQ_EVENT_F_DESC      0x2
+
+/*
+ * Split virtqueue layout. The avail ring is followed by used_event, the used
+ * ring by avail_event (both only used with VIRTIO_F_EVENT_IDX).
+ */
 #define VIRTQ_OFF_DESC(q)  0
 #define VIRTQ_OFF_AVAIL(q) ((q) * sizeof(struct virtq_desc))
 #define VIRTQ_OFF_AVAIL_RING(q) (VIRTQ_OFF_AVAIL(q)             \
                                  + sizeof(struct virtq_avail))
 #define VIRTQ_OFF_PADDING(q) (VIRTQ_OFF_AVAIL_RING(q)       \
-                              + (sizeof(le16) * (q)))
+                              + (sizeof(le16) * ((q) + 1)))
 #define VIRTQ_OFF_USED(q) ((VIRTQ_OFF_PADDING(q) + PAGE_SIZE - 1) & PAGE_MASK)
 #define VIRTQ_OFF_USED_RING(q) (VIRTQ_OFF_USED(q) + sizeof(struct virtq_used))
 
 #define VIRTQ_SIZE(q) (VIRTQ_OFF_USED_RING(q) \
-                                   + (sizeof(struct virtq_used_elem) * (q)))
+                       + (sizeof(struct virtq_used_elem) * (q)) \
+                       + sizeof(le16))
+
+/*
+ * Packed virtqueue layout: the descriptor ring, followed by the driver and
+ * device event suppression structures.
+ */
+#define VIRTQ_PACKED_OFF_DRIVER(q) ((q) * sizeof(struct virtq_packed_desc))
+#define VIRTQ_PACKED_OFF_DEVICE(q) (VIRTQ_PACKED_OFF_DRIVER(q) \
+                                    + sizeof(struct virtq_event))
+#define VIRTQ_PACKED_SIZE(q) (VIRTQ_PACKED_OFF_DEVICE(q) \
+                              + sizeof(struct virtq_event))
 
 /* Virtqueue descriptors: 16 bytes.
  * These can chain together via "next". */
@@ -109,15 +133,27 @@ struct virtq_used {
         /* Only if VIRTIO_F_EVENT_IDX: le16 avail_event; */
 };
 
-/* This is the max buffer length per descriptor. */
-#define MAX_BUFFER_LEN 1526
+/* Packed virtqueue descriptors: 16 bytes, written by both sides. */
+struct virtq_packed_desc {
+        le64 addr;
+        le32 len;
+        le16 id;
+        volatile le16 flags;
+};
+
+/* Packed virtqueue event suppression structure. */
+struct virtq_event {
+        volatile le16 off_wrap;
+        volatile le16 flags;
+};
 
 /*
  * Each one of these io_buffer's map to a descriptor. An array of io_buffer's
- * of size virtq.num (same as virtq.desc) is allocated during init.
+ * of size virtq.num (same as virtq.desc), each with (data) pointing to
+ * virtq.buf_size bytes, is allocated during init by virtq_init_bufs().
  */
 struct io_buffer {
-    uint8_t data[MAX_BUFFER_LEN];
+    uint8_t *data;
 
     /* Data length in Bytes. It is written by the driver on a tx/write, or
      * by the device on a rx/read on interrupt handling (do not remove the
@@ -128,20 +164,55 @@ struct io_buffer {
     uint16_t extra_flags;
 };
 
+/*
+ * One element of a buffer submitted with virtq_add().
+ */
+struct virtq_buf {
+    uint64_t addr;
+    uint32_t len;
+    bool write;                 /* Device writes to this element */
+};
+
 struct virtq {
         unsigned int num;
+        bool packed;            /* VIRTIO_F_RING_PACKED negotiated */
+        bool event_idx;         /* VIRTIO_F_EVENT_IDX negotiated */
+        bool indirect;          /* VIRTIO_F_INDIRECT_DESC negotiated */
 
+        /* Split virtqueue */
         struct virtq_desc *desc;
         struct virtq_avail *avail;
         struct virtq_used *used;
+
+        /* Packed virtqueue */
+        struct virtq_packed_desc *pdesc;
+        struct virtq_event *driver_event;
+        struct virtq_event *device_event;
+        bool avail_wrap;
+        bool used_wrap;
+
         struct io_buffer *bufs;
+        size_t buf_size;
 
         /* Keep track of available (free) descriptors */
         uint16_t num_avail;
+        /* Split virtqueue: head of the free descriptor list */
+        uint16_t free_head;
+        /* Descriptors used by each buffer, and (split) its buffer ID */
+        uint16_t *chain_len;
+        uint16_t *buf_id;
 
         /* Indexes in the descriptors array */
         uint16_t last_used;
         uint16_t next_avail;
+        /* Buffers added since the last call to virtq_kick() */
+        uint16_t num_added;
+
+        /* Notification ("kick") address and statistics */
+        uint16_t index;
+        uint16_t io_base;               /* legacy transport */
+        volatile le16 *notify;          /* modern transport */
+        uint64_t kicks;
 };
 
 static inline int virtq_need_event(uint16_t event_idx, uint16_t new_idx, uint16_t old_idx)
@@ -150,28 +221,72 @@ static inline int virtq_need_event(uint16_t event_idx, uint16_t new_idx, uint16_
 }
 
 /* Get location of event indices (only with VIRTIO_F_EVENT_IDX) */
-static inline le16 *virtq_used_event(struct virtq *vq)
+static inline volatile le16 *virtq_used_event(struct virtq *vq)
 {
         /* For backwards compat, used event index is at *end* of avail ring. */
         return &vq->avail->ring[vq->num];
 }
 
-static inline le16 *virtq_avail_event(struct virtq *vq)
+static inline volatile le16 *virtq_avail_event(struct virtq *vq)
 {
         /* For backwards compat, avail event index is at *end* of used ring. */
         return (le16 *)&vq->used->ring[vq->num];
 }
 
 /*
- * Create a descriptor chain starting at index head, using vq->bufs also
- * starting at index head. Num is the number of descriptors (and number of bufs).
+ * Allocate the rings for (vq), with vq->num, vq->packed and vq->event_idx
+ * already set. Called by virtio_dev_setup_queue().
+ */
+void virtq_init_rings(struct virtq *vq);
+
+/*
+ * Allocate vq->bufs, with (buf_size) bytes of data per descriptor.
+ */
+void virtq_init_bufs(struct virtq *vq, size_t buf_size);
+
+/*
+ * Makes the buffer consisting of the (n) elements in (bufs) available to the
+ * device. (id) identifies the buffer on completion, and must be less than
+ * vq->num. If (indirect) is not NULL and indirect descriptors have been
+ * negotiated, the buffer is described by an indirect table of (n) entries
+ * built at (indirect), using a single descriptor in the ring.
  *
- * Returns 0 on success.
+ * The device is not notified until virtq_kick() is called.
+ *
+ * Returns 0 on success, or -1 if there are not enough free descriptors.
+ */
+int virtq_add(struct virtq *vq, uint16_t id, const struct virtq_buf *bufs,
+        unsigned n, void *indirect);
+
+/*
+ * Returns true if the device has used a buffer not yet retrieved by
+ * virtq_get().
+ */
+bool virtq_more_used(struct virtq *vq);
+
+/*
+ * Retrieves the next buffer used by the device, returning its ID in (*id)
+ * and the number of bytes the device wrote to it in (*len), and frees its
+ * descriptors. Returns false if there is no such buffer.
+ */
+bool virtq_get(struct virtq *vq, uint16_t *id, uint32_t *len);
+
+/*
+ * Notifies the device of buffers added since the last call, unless the
+ * device has asked not to be notified.
  */
-int virtq_add_descriptor_chain(struct virtq *vq,
-                               uint16_t head,
-                               uint16_t num);
+void virtq_kick(struct virtq *vq);
 
-void virtq_init_rings(uint16_t pci_base, struct virtq *vq, int selector);
+/*
+ * Asks the device not to interrupt us when it uses buffers ...
+ */
+void virtq_intr_disable(struct virtq *vq);
+
+/*
+ * ... or to interrupt us when it next does so. Returns true if buffers have
+ * been used in the meantime, in which case the caller should not wait for
+ * an interrupt.
+ */
+bool virtq_intr_enable(struct virtq *vq);
 
 #endif /* VIRTQUEUE_H */
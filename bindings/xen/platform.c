@@ -436,3 +436,19 @@ int platform_set_tls_base(uint64_t base)
     cpu_set_tls_base(base);
     return 0;
 }
+
+/*
+ * Returning memory to the host is not supported on this target. As
+ * solo5_mem_release() is advisory, succeed without doing anything.
+ */
+int platform_mem_release(uintptr_t start __attribute__((unused)),
+        size_t size __attribute__((unused)))
+{
+    return 0;
+}
+
+int platform_mem_reuse(uintptr_t start __attribute__((unused)),
+        size_t size __attribute__((unused)))
+{
+    return 0;
+}
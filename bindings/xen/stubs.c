@@ -44,6 +44,20 @@ solo5_result_t solo5_net_read(solo5_handle_t handle, uint8_t *buf, size_t size,
     return SOLO5_R_EUNSPEC;
 }
 
+solo5_result_t solo5_net_write_offload(solo5_handle_t handle,
+	const struct solo5_net_offload *offload, const uint8_t *buf,
+	size_t size)
+{
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_net_read_offload(solo5_handle_t handle,
+	struct solo5_net_offload *offload, uint8_t *buf, size_t size,
+	size_t *read_size)
+{
+    return SOLO5_R_EUNSPEC;
+}
+
 solo5_result_t solo5_block_acquire(const char *name, solo5_handle_t *handle,
 	struct solo5_block_info *info)
 {
@@ -61,3 +75,20 @@ solo5_result_t solo5_block_read(solo5_handle_t handle,solo5_off_t offset,
 {
     return SOLO5_R_EUNSPEC;
 }
+
+solo5_result_t solo5_block_map(solo5_handle_t handle, const uint8_t **addr)
+{
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_block_submit(solo5_handle_t handle,
+	struct solo5_block_request *req)
+{
+    return SOLO5_R_EUNSPEC;
+}
+
+solo5_result_t solo5_block_complete(solo5_handle_t handle,
+	struct solo5_block_request **req)
+{
+    return SOLO5_R_EUNSPEC;
+}
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * blktool.c: Solo5 block image tool.
+ *
+ * This tool creates and merges copy-on-write overlays for use with
+ * --block:NAME=overlay:BASE,DELTA, and converts images to and from the
+ * compressed format used with --block:NAME=compressed:PATH.
+ */
+
+#define _GNU_SOURCE
+#define _FILE_OFFSET_BITS 64
+#include <err.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "compress_abi.h"
+#include "overlay_abi.h"
+#include "version.h"
+
+/*
+ * We pull in the block attach code directly to simplify the build.
+ */
+#include "../tenders/common/block_attach.c"
+
+#define COPY_BUF_SIZE (1024 * 1024)
+#define DEFAULT_CHUNK_SIZE (64 * 1024)
+#define LZ_HASH_BITS 14
+#define LZ_MAX_OFFSET 65535
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s COMMAND ...\n", prog);
+    fprintf(stderr, "%s version %s\n\n", prog, SOLO5_VERSION);
+    fprintf(stderr, "COMMAND is:\n");
+    fprintf(stderr, "    create-overlay BASE DELTA:\n");
+    fprintf(stderr, "        Create an empty copy-on-write overlay DELTA on "
+            "top of BASE.\n");
+    fprintf(stderr, "    merge-overlay BASE DELTA OUTPUT:\n");
+    fprintf(stderr, "        Write BASE with the blocks in DELTA applied to "
+            "OUTPUT.\n");
+    fprintf(stderr, "    merge-overlay --in-place BASE DELTA:\n");
+    fprintf(stderr, "        Merge the blocks in DELTA into BASE. This "
+            "corrupts any other\n"
+            "        overlays on top of BASE, which must be discarded.\n");
+    fprintf(stderr, "    compress IMAGE OUTPUT [CHUNKSIZE]:\n");
+    fprintf(stderr, "        Write IMAGE compressed in chunks of CHUNKSIZE "
+            "bytes (default %d)\n"
+            "        to OUTPUT.\n", DEFAULT_CHUNK_SIZE);
+    fprintf(stderr, "    decompress IMAGE OUTPUT:\n");
+    fprintf(stderr, "        Write the compressed IMAGE uncompressed to "
+            "OUTPUT.\n");
+    exit(EXIT_FAILURE);
+}
+
+static bool is_zero(const uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i != len; i++)
+        if (buf[i] != 0)
+            return false;
+    return true;
+}
+
+/*
+ * Copy (len) bytes from (src_fd) to the newly created (dst_fd), leaving
+ * all-zero regions as holes.
+ */
+static void copy_sparse(int src_fd, int dst_fd, off_t len, const char *src,
+        const char *dst)
+{
+    uint8_t *buf = malloc(COPY_BUF_SIZE);
+    if (buf == NULL)
+        err(1, "malloc");
+
+    if (ftruncate(dst_fd, len) == -1)
+        err(1, "%s: Could not set size", dst);
+    for (off_t pos = 0; pos < len; ) {
+        size_t n = (len - pos < COPY_BUF_SIZE) ? len - pos : COPY_BUF_SIZE;
+        ssize_t ret = pread(src_fd, buf, n, pos);
+        if (ret <= 0)
+            err(1, "%s: Read failed", src);
+        if (!is_zero(buf, ret) && pwrite(dst_fd, buf, ret, pos) != ret)
+            err(1, "%s: Write failed", dst);
+        pos += ret;
+    }
+    free(buf);
+}
+
+static int blktool_create_overlay(const char *base, const char *delta)
+{
+    block_overlay_create(base, delta);
+    return EXIT_SUCCESS;
+}
+
+/*
+ * Merge (delta) into (output), or into (base) if (output) is NULL.
+ */
+static int blktool_merge_overlay(const char *base, const char *delta,
+        const char *output)
+{
+    off_t capacity;
+    struct overlay_dev *o = block_attach_overlay(base, delta, &capacity);
+
+    bool in_place = output == NULL;
+    struct stat base_st, out_st;
+    if (fstat(o->base_fd, &base_st) == -1)
+        err(1, "%s: fstat", base);
+    if (in_place)
+        output = base;
+    else if (stat(output, &out_st) == 0 &&
+            out_st.st_dev == base_st.st_dev && out_st.st_ino == base_st.st_ino)
+        errx(1, "%s: OUTPUT is BASE, use merge-overlay --in-place to merge "
+                "into BASE", output);
+
+    int out_fd;
+    if (in_place) {
+        /*
+         * Upgrade the shared lock taken by block_attach_overlay(), failing
+         * if any tender has an overlay on top of BASE attached.
+         */
+        if (flock(o->base_fd, LOCK_EX | LOCK_NB) == -1) {
+            if (errno == EWOULDBLOCK)
+                errx(1, "%s: Base image is in use by another process", base);
+            err(1, "%s: Could not lock base image", base);
+        }
+        out_fd = open(output, O_WRONLY);
+        if (out_fd == -1)
+            err(1, "Could not open %s", output);
+    }
+    else {
+        out_fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (out_fd == -1)
+            err(1, "Could not create %s", output);
+        copy_sparse(o->base_fd, out_fd, capacity, base, output);
+    }
+
+    /*
+     * Copy runs of allocated blocks from the delta.
+     */
+    uint8_t *buf = malloc(COPY_BUF_SIZE);
+    if (buf == NULL)
+        err(1, "malloc");
+    uint64_t nblocks = capacity / o->block_size;
+    uint64_t max_run = COPY_BUF_SIZE / o->block_size;
+    uint64_t merged = 0;
+    for (uint64_t block = 0; block < nblocks; ) {
+        if (!overlay_is_allocated(o->bitmap, block)) {
+            block++;
+            continue;
+        }
+        uint64_t run = 1;
+        while (block + run < nblocks && run < max_run &&
+                overlay_is_allocated(o->bitmap, block + run))
+            run++;
+        size_t len = run * o->block_size;
+        off_t pos = block * o->block_size;
+        if (pread(o->delta_fd, buf, len, o->data_offset + pos) != (ssize_t)len)
+            err(1, "%s: Read failed", delta);
+        if (pwrite(out_fd, buf, len, pos) != (ssize_t)len)
+            err(1, "%s: Write failed", output);
+        block += run;
+        merged += run;
+    }
+    free(buf);
+    if (fsync(out_fd) == -1 || close(out_fd) == -1)
+        err(1, "%s: Write failed", output);
+
+    printf("%s: Merged %llu of %llu blocks from %s\n", output,
+            (unsigned long long)merged, (unsigned long long)nblocks, delta);
+    return EXIT_SUCCESS;
+}
+
+/*
+ * Emit a length continuation (see compress_lz_decode()) for (len), which has
+ * already had 15 subtracted.
+ */
+static uint8_t *lz_put_len(uint8_t *op, size_t len)
+{
+    while (len >= 255) {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = len;
+    return op;
+}
+
+/*
+ * Emit a sequence of (lit) literals at (src) followed by a match of (mlen)
+ * bytes at (offset), or no match if (mlen) is 0. Returns NULL if the output
+ * would exceed (oend).
+ */
+static uint8_t *lz_put_seq(uint8_t *op, uint8_t *oend, const uint8_t *src,
+        size_t lit, size_t offset, size_t mlen)
+{
+    /*
+     * Worst case: token, length bytes for both lengths, literals, offset.
+     */
+    if ((size_t)(oend - op) < 1 + lit / 255 + 1 + lit + 2 + mlen / 255 + 1)
+        return NULL;
+
+    uint8_t *token = op++;
+    *token = (lit >= 15 ? 15 : lit) << 4;
+    if (lit >= 15)
+        op = lz_put_len(op, lit - 15);
+    memcpy(op, src, lit);
+    op += lit;
+    if (mlen == 0)
+        return op;
+
+    *op++ = offset & 0xff;
+    *op++ = offset >> 8;
+    mlen -= 4;
+    *token |= (mlen >= 15 ? 15 : mlen);
+    if (mlen >= 15)
+        op = lz_put_len(op, mlen - 15);
+    return op;
+}
+
+static uint32_t lz_read32(const uint8_t *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, sizeof v);
+    return v;
+}
+
+/*
+ * Compress (len) bytes at (src) into at most (cap) bytes at (dst) using
+ * greedy matching against a hash table of 4-byte sequences. Returns the
+ * compressed size, or 0 if it would not fit.
+ */
+static size_t lz_compress(const uint8_t *src, size_t len, uint8_t *dst,
+        size_t cap)
+{
+    static int64_t table[1 << LZ_HASH_BITS];
+    uint8_t *op = dst, *oend = dst + cap;
+    size_t ip = 0, anchor = 0;
+
+    for (size_t i = 0; i != sizeof table / sizeof table[0]; i++)
+        table[i] = -1;
+
+    while (ip + 4 <= len) {
+        uint32_t seq = lz_read32(src + ip);
+        uint32_t h = (seq * 2654435761U) >> (32 - LZ_HASH_BITS);
+        int64_t ref = table[h];
+        table[h] = ip;
+        if (ref < 0 || ip - ref > LZ_MAX_OFFSET ||
+                lz_read32(src + ref) != seq) {
+            ip++;
+            continue;
+        }
+
+        size_t mlen = 4;
+        while (ip + mlen < len && src[ref + mlen] == src[ip + mlen])
+            mlen++;
+        op = lz_put_seq(op, oend, src + anchor, ip - anchor, ip - ref, mlen);
+        if (op == NULL)
+            return 0;
+        ip += mlen;
+        anchor = ip;
+    }
+    if (anchor < len) {
+        op = lz_put_seq(op, oend, src + anchor, len - anchor, 0, 0);
+        if (op == NULL)
+            return 0;
+    }
+    return op - dst;
+}
+
+static int blktool_compress(const char *image, const char *output,
+        const char *chunk_size_arg)
+{
+    uint32_t chunk_size = DEFAULT_CHUNK_SIZE;
+    if (chunk_size_arg != NULL) {
+        char *end;
+        unsigned long v = strtoul(chunk_size_arg, &end, 0);
+        if (*end != '\0' || v < COMPRESS_MIN_CHUNK_SIZE ||
+                v > COMPRESS_MAX_CHUNK_SIZE || (v & (v - 1)) != 0)
+            errx(1, "CHUNKSIZE must be a power of two from %d to %d",
+                    COMPRESS_MIN_CHUNK_SIZE, COMPRESS_MAX_CHUNK_SIZE);
+        chunk_size = v;
+    }
+
+    off_t capacity;
+    int in_fd = block_attach_ro(image, &capacity);
+    int out_fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out_fd == -1)
+        err(1, "Could not create %s", output);
+
+    uint64_t nchunks = (capacity + chunk_size - 1) / chunk_size;
+    uint64_t *index = malloc((nchunks + 1) * sizeof (uint64_t));
+    uint8_t *ibuf = malloc(chunk_size);
+    uint8_t *obuf = malloc(chunk_size);
+    if (index == NULL || ibuf == NULL || obuf == NULL)
+        err(1, "malloc");
+
+    struct compress_header hdr = { 0 };
+    memcpy(hdr.magic, COMPRESS_MAGIC, sizeof hdr.magic);
+    hdr.version = COMPRESS_VERSION;
+    hdr.chunk_size = chunk_size;
+    hdr.capacity = capacity;
+
+    uint64_t pos = sizeof hdr;
+    for (uint64_t i = 0; i != nchunks; i++) {
+        size_t ulen = (capacity - i * chunk_size < chunk_size) ?
+            capacity - i * chunk_size : chunk_size;
+        if (pread(in_fd, ibuf, ulen, i * chunk_size) != (ssize_t)ulen)
+            err(1, "%s: Read failed", image);
+        /*
+         * Chunks which do not compress to less than their size are stored
+         * as is.
+         */
+        const uint8_t *data = obuf;
+        size_t clen = lz_compress(ibuf, ulen, obuf, ulen - 1);
+        if (clen == 0) {
+            data = ibuf;
+            clen = ulen;
+        }
+        if (pwrite(out_fd, data, clen, pos) != (ssize_t)clen)
+            err(1, "%s: Write failed", output);
+        index[i] = pos;
+        pos += clen;
+        if (clen > hdr.max_csize)
+            hdr.max_csize = clen;
+    }
+    index[nchunks] = pos;
+    hdr.index_offset = pos;
+
+    size_t index_size = (nchunks + 1) * sizeof (uint64_t);
+    if (pwrite(out_fd, index, index_size, pos) != (ssize_t)index_size ||
+            pwrite(out_fd, &hdr, sizeof hdr, 0) != sizeof hdr)
+        err(1, "%s: Write failed", output);
+    if (fsync(out_fd) == -1 || close(out_fd) == -1)
+        err(1, "%s: Write failed", output);
+
+    uint64_t total = pos + index_size;
+    printf("%s: %llu bytes compressed to %llu bytes (%.1f%%)\n", output,
+            (unsigned long long)capacity, (unsigned long long)total,
+            100.0 * total / capacity);
+    return EXIT_SUCCESS;
+}
+
+static int blktool_decompress(const char *image, const char *output)
+{
+    off_t capacity;
+    struct compress_dev *d = block_attach_compressed(image, 1, &capacity);
+    int out_fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out_fd == -1)
+        err(1, "Could not create %s", output);
+    if (ftruncate(out_fd, capacity) == -1)
+        err(1, "%s: Could not set size", output);
+
+    uint8_t *buf = malloc(d->chunk_size);
+    if (buf == NULL)
+        err(1, "malloc");
+    for (uint64_t i = 0; i != d->nchunks; i++) {
+        size_t len = compress_chunk_len(d, i);
+        off_t pos = i * d->chunk_size;
+        if (block_compressed_read(d, buf, len, pos) == -1)
+            errx(1, "%s: Chunk %llu is corrupt", image, (unsigned long long)i);
+        if (!is_zero(buf, len) && pwrite(out_fd, buf, len, pos) != (ssize_t)len)
+            err(1, "%s: Write failed", output);
+    }
+    free(buf);
+    if (fsync(out_fd) == -1 || close(out_fd) == -1)
+        err(1, "%s: Write failed", output);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *prog;
+
+    prog = basename(argv[0]);
+
+    if (argc < 2)
+        usage(prog);
+    if (strcmp(argv[1], "create-overlay") == 0) {
+        if (argc != 4)
+            usage(prog);
+        return blktool_create_overlay(argv[2], argv[3]);
+    }
+    else if (strcmp(argv[1], "merge-overlay") == 0) {
+        if (argc == 5 && strcmp(argv[2], "--in-place") == 0)
+            return blktool_merge_overlay(argv[3], argv[4], NULL);
+        if (argc != 5)
+            usage(prog);
+        return blktool_merge_overlay(argv[2], argv[3], argv[4]);
+    }
+    else if (strcmp(argv[1], "compress") == 0) {
+        if (argc != 4 && argc != 5)
+            usage(prog);
+        return blktool_compress(argv[2], argv[3], argc == 5 ? argv[4] : NULL);
+    }
+    else if (strcmp(argv[1], "decompress") == 0) {
+        if (argc != 4)
+            usage(prog);
+        return blktool_decompress(argv[2], argv[3]);
+    }
+    else
+        usage(prog);
+}
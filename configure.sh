@@ -55,6 +55,10 @@ Options:
     --disable-toolchain
         Do not build or install toolchain and bindings.
 
+    --enable-virtio-modern
+        Experimental: Use the virtio 1.0 PCI transport, packed virtqueues and
+        VIRTIO_F_EVENT_IDX in the virtio bindings if offered by the device.
+
 Environment variables affecting the build system configuration:
     HOST_CC
         C compiler used for host tools and tenders.
@@ -220,6 +224,7 @@ EOM
 
 OPT_PREFIX=/usr/local
 OPT_DISABLE_TOOLCHAIN=
+OPT_ENABLE_VIRTIO_MODERN=
 while [ $# -gt 0 ]; do
     OPT="$1"
 
@@ -232,6 +237,9 @@ while [ $# -gt 0 ]; do
         --disable-toolchain|--only-tools)
             OPT_DISABLE_TOOLCHAIN=1
             ;;
+        --enable-virtio-modern)
+            OPT_ENABLE_VIRTIO_MODERN=1
+            ;;
         --help)
             usage
             ;;
@@ -524,6 +532,7 @@ CONFIG_SPT_TENDER_NO_PIE=${CONFIG_SPT_TENDER_NO_PIE}
 CONFIG_SPT_TENDER_LIBSECCOMP_CFLAGS=${CONFIG_SPT_TENDER_LIBSECCOMP_CFLAGS}
 CONFIG_SPT_TENDER_LIBSECCOMP_LDLIBS=${CONFIG_SPT_TENDER_LIBSECCOMP_LDLIBS}
 CONFIG_VIRTIO=${CONFIG_VIRTIO}
+CONFIG_VIRTIO_MODERN=${OPT_ENABLE_VIRTIO_MODERN}
 CONFIG_MUEN=${CONFIG_MUEN}
 CONFIG_XEN=${CONFIG_XEN}
 CONFIG_TARGET_ARCH=${TARGET_ARCH}
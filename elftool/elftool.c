@@ -24,6 +24,9 @@
  * This tool produces a C source file defining the binary manifest from its
  * JSON source. The produced C source file should be compiled with the Solo5
  * toolchain and linked into the unikernel binary.
+ *
+ * It can also produce prelinked boot images (see prelink_abi.h) from hvt and
+ * spt unikernel binaries.
  */
 
 #define _GNU_SOURCE
@@ -34,12 +37,14 @@
 #include <libgen.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
 #include "json.h"
 #include "elf_abi.h"
 #include "mft_abi.h"
+#include "prelink_abi.h"
 #include "version.h"
 
 /*
@@ -103,6 +108,9 @@ static void usage(const char *prog)
     fprintf(stderr, "        Display the ABI target and version from BINARY.\n");
     fprintf(stderr, "    query-manifest BINARY:\n");
     fprintf(stderr, "        Display the application manifest from BINARY.\n");
+    fprintf(stderr, "    prelink BINARY OUTPUT:\n");
+    fprintf(stderr, "        Write a prelinked boot image of the hvt or spt "
+            "BINARY to OUTPUT.\n");
     exit(EXIT_FAILURE);
 }
 
@@ -301,6 +309,219 @@ static int elftool_query_abi(const char *binary)
     return EXIT_SUCCESS;
 }
 
+/*
+ * Lowest guest address the hvt and spt tenders load executables at
+ * (HVT_GUEST_MIN_BASE, SPT_GUEST_MIN_BASE).
+ */
+#define PRELINK_MIN_LOADADDR 0x100000
+
+/*
+ * Size of the scratch memory the executable is loaded into. Reserved, but
+ * only populated as far as the executable extends.
+ */
+#define PRELINK_SCRATCH_SIZE (1ULL << 30)
+
+/*
+ * guest_mprotect_fn_t used while loading the executable into scratch memory,
+ * records the requested protections as image regions.
+ */
+static int prelink_add_region(void *arg, uint64_t addr_start,
+        uint64_t addr_end, int prot)
+{
+    struct prelink_hdr *hdr = arg;
+
+    if (hdr->nregions == PRELINK_MAX_REGIONS) {
+        errno = E2BIG;
+        return -1;
+    }
+    struct prelink_region *r = &hdr->regions[hdr->nregions++];
+    r->start = addr_start;
+    r->end = addr_end;
+    r->prot = 0;
+    if (prot & PROT_READ)
+        r->prot |= PRELINK_PROT_R;
+    if (prot & PROT_WRITE)
+        r->prot |= PRELINK_PROT_W;
+    if (prot & PROT_EXEC)
+        r->prot |= PRELINK_PROT_X;
+    return 0;
+}
+
+static int pwrite_in_full(int fd, const void *buf, size_t count, off_t offset)
+{
+    const char *p = buf;
+
+    while (count > 0) {
+        ssize_t nw = pwrite(fd, p, count, offset);
+        if (nw == -1 && errno == EINTR)
+            continue;
+        else if (nw == -1)
+            return -1;
+
+        count -= nw;
+        p += nw;
+        offset += nw;
+    }
+    return 0;
+}
+
+static int elftool_prelink(const char *binary, const char *output)
+{
+    int bin_fd = -1, out_fd = -1;
+    char *tmp_output = NULL;
+    uint8_t *mem = MAP_FAILED;
+    struct prelink_hdr *hdr = NULL;
+    struct abi1_info *abi1 = NULL;
+    struct mft *mft = NULL;
+    size_t abi1_size, mft_size;
+
+    bin_fd = open(binary, O_RDONLY);
+    if (bin_fd == -1) {
+        warn("%s: Could not open", binary);
+        goto out_error;
+    }
+    if (elf_is_prelinked(bin_fd)) {
+        warnx("%s: Already a prelinked image", binary);
+        goto out_error;
+    }
+    if (elf_load_note(bin_fd, binary, ABI1_NOTE_TYPE, ABI1_NOTE_ALIGN,
+                ABI1_NOTE_MAX_SIZE, (void **)&abi1, &abi1_size) == -1) {
+        warnx("%s: No Solo5 ABI information found in executable", binary);
+        goto out_error;
+    }
+    if (abi1->abi_target != HVT_ABI_TARGET &&
+            abi1->abi_target != SPT_ABI_TARGET) {
+        warnx("%s: Prelinking is not supported for the %s target", binary,
+                abi_target_to_string(abi1->abi_target));
+        goto out_error;
+    }
+    if (elf_load_note(bin_fd, binary, MFT1_NOTE_TYPE, MFT1_NOTE_ALIGN,
+                MFT1_NOTE_MAX_SIZE, (void **)&mft, &mft_size) == -1) {
+        warnx("%s: No Solo5 manifest found in executable", binary);
+        goto out_error;
+    }
+    if (mft_validate(mft, mft_size) == -1) {
+        warnx("%s: Manifest validation failed", binary);
+        goto out_error;
+    }
+
+    hdr = calloc(1, sizeof *hdr);
+    if (hdr == NULL) {
+        warn("calloc");
+        goto out_error;
+    }
+    mem = mmap(NULL, PRELINK_SCRATCH_SIZE, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mem == MAP_FAILED) {
+        warn("mmap");
+        goto out_error;
+    }
+    uint64_t entry, end;
+    elf_load(bin_fd, binary, mem, PRELINK_SCRATCH_SIZE, PRELINK_MIN_LOADADDR,
+            false, prelink_add_region, hdr, &entry, &end);
+    if (hdr->nregions == 0) {
+        warnx("%s: No loadable segments found in executable", binary);
+        goto out_error;
+    }
+
+    memcpy(hdr->magic, PRELINK_MAGIC, PRELINK_MAGIC_SIZE);
+    hdr->version = PRELINK_VERSION;
+    hdr->machine = EM_TARGET;
+    hdr->page_size = EM_PAGE_SIZE;
+    hdr->entry = entry;
+    hdr->base = hdr->regions[0].start;
+    hdr->end = end;
+    /*
+     * Trailing zero pages (typically .bss) need not be stored, the tenders
+     * zero-fill guest memory up to (end).
+     */
+    uint64_t last = end;
+    while (last > hdr->base && mem[last - 1] == 0)
+        last--;
+    hdr->filesz = (last - hdr->base + (EM_PAGE_SIZE - 1)) & -EM_PAGE_SIZE;
+
+    uint64_t offset = sizeof *hdr;
+    hdr->nnotes = 2;
+    hdr->notes[0].type = ABI1_NOTE_TYPE;
+    hdr->notes[0].offset = offset = (offset + 7) & -8ULL;
+    hdr->notes[0].size = abi1_size;
+    offset += abi1_size;
+    hdr->notes[1].type = MFT1_NOTE_TYPE;
+    hdr->notes[1].offset = offset = (offset + 7) & -8ULL;
+    hdr->notes[1].size = mft_size;
+    offset += mft_size;
+    hdr->image_offset = (offset + (EM_PAGE_SIZE - 1)) & -EM_PAGE_SIZE;
+
+    /*
+     * Tenders map prelinked images into guest memory, so OUTPUT must not be
+     * truncated or rewritten while a guest may be running from it. Write a
+     * temporary file in the same directory and atomically replace OUTPUT.
+     */
+    if (asprintf(&tmp_output, "%s.XXXXXX", output) == -1) {
+        tmp_output = NULL;
+        warn("asprintf");
+        goto out_error;
+    }
+    out_fd = mkstemp(tmp_output);
+    if (out_fd == -1) {
+        warn("%s: Could not create temporary file", output);
+        free(tmp_output);
+        tmp_output = NULL;
+        goto out_error;
+    }
+    mode_t mask = umask(0);
+    umask(mask);
+    if (fchmod(out_fd, 0644 & ~mask) == -1) {
+        warn("%s: Could not set mode", tmp_output);
+        goto out_error;
+    }
+    if (pwrite_in_full(out_fd, hdr, sizeof *hdr, 0) == -1
+            || pwrite_in_full(out_fd, abi1, abi1_size,
+                hdr->notes[0].offset) == -1
+            || pwrite_in_full(out_fd, mft, mft_size,
+                hdr->notes[1].offset) == -1
+            || pwrite_in_full(out_fd, mem + hdr->base, hdr->filesz,
+                hdr->image_offset) == -1
+            || ftruncate(out_fd, hdr->image_offset + hdr->filesz) == -1) {
+        warn("%s: Write failed", tmp_output);
+        goto out_error;
+    }
+    if (close(out_fd) == -1) {
+        warn("%s: Write failed", tmp_output);
+        out_fd = -1;
+        goto out_error;
+    }
+    out_fd = -1;
+    if (rename(tmp_output, output) == -1) {
+        warn("%s: Could not rename to %s", tmp_output, output);
+        goto out_error;
+    }
+
+    munmap(mem, PRELINK_SCRATCH_SIZE);
+    close(bin_fd);
+    free(hdr);
+    free(abi1);
+    free(mft);
+    free(tmp_output);
+    return EXIT_SUCCESS;
+
+out_error:
+    if (out_fd != -1)
+        close(out_fd);
+    if (tmp_output != NULL) {
+        unlink(tmp_output);
+        free(tmp_output);
+    }
+    if (mem != MAP_FAILED)
+        munmap(mem, PRELINK_SCRATCH_SIZE);
+    if (bin_fd != -1)
+        close(bin_fd);
+    free(hdr);
+    free(abi1);
+    free(mft);
+    return EXIT_FAILURE;
+}
+
 int main(int argc, char *argv[])
 {
     const char *prog;
@@ -324,6 +545,11 @@ int main(int argc, char *argv[])
             usage(prog);
         return elftool_query_abi(argv[2]);
     }
+    else if (strcmp(argv[1], "prelink") == 0) {
+        if (argc != 4)
+            usage(prog);
+        return elftool_prelink(argv[2], argv[3]);
+    }
     else
         usage(prog);
 }
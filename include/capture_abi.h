@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * capture_abi.h: Network packet capture ring, shared by the tenders and the
+ * spt bindings.
+ *
+ * This header file must be kept self-contained with no external dependencies
+ * other than C99 headers.
+ */
+
+#ifndef CAPTURE_ABI_H
+#define CAPTURE_ABI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Direction of a captured frame, as seen from the guest.
+ */
+#define CAPTURE_DIR_IN  1
+#define CAPTURE_DIR_OUT 2
+
+/*
+ * A slot in the capture ring, followed by (snaplen) bytes of frame data.
+ * (seq) is set to the sequence number of the frame plus one once the slot has
+ * been filled.
+ */
+struct capture_slot {
+    uint64_t seq;
+    uint64_t ts_ns;             /* Wall clock time of capture */
+    uint32_t len;               /* Original frame length */
+    uint32_t caplen;            /* Captured frame length */
+    uint32_t dir;               /* CAPTURE_DIR_* */
+    uint32_t pad;
+    uint8_t data[];
+};
+
+/*
+ * A bounded multiple-producer, single-consumer ring of captured frames.
+ * Producers claim slots by advancing (head) and never wait; if the ring is
+ * full the frame is counted in (dropped). The consumer (the tender's capture
+ * helper) writes out slots in order, advancing (tail).
+ *
+ * Setting (stop) asks the consumer to write out all remaining slots, after
+ * which it sets (stopped).
+ */
+struct capture_ring {
+    uint64_t head;
+    uint64_t tail;
+    uint64_t dropped;
+    uint32_t nslots;
+    uint32_t snaplen;
+    uint32_t slot_size;         /* sizeof (struct capture_slot) + snaplen,
+                                   rounded up to a multiple of 8 */
+    uint32_t stop;
+    uint32_t stopped;
+    uint32_t pad;
+    uint8_t slots[];
+};
+
+static inline struct capture_slot *capture_ring_slot(struct capture_ring *r,
+        uint64_t seq)
+{
+    return (struct capture_slot *)
+        &r->slots[(size_t)(seq % r->nslots) * r->slot_size];
+}
+
+/*
+ * Capture the frame (data, len) travelling in direction (dir) at wall clock
+ * time (ts_ns) into the ring (r). Never blocks.
+ */
+static inline void capture_ring_put(struct capture_ring *r, uint32_t dir,
+        uint64_t ts_ns, const uint8_t *data, size_t len)
+{
+    uint64_t head = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+
+    do {
+        if (head - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE) >= r->nslots) {
+            __atomic_fetch_add(&r->dropped, 1, __ATOMIC_RELAXED);
+            return;
+        }
+    } while (!__atomic_compare_exchange_n(&r->head, &head, head + 1, 1,
+                __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    struct capture_slot *s = capture_ring_slot(r, head);
+    uint32_t caplen = (len > r->snaplen) ? r->snaplen : (uint32_t)len;
+    s->ts_ns = ts_ns;
+    s->len = (uint32_t)len;
+    s->caplen = caplen;
+    s->dir = dir;
+    __builtin_memcpy(s->data, data, caplen);
+    __atomic_store_n(&s->seq, head + 1, __ATOMIC_RELEASE);
+}
+
+#endif /* CAPTURE_ABI_H */
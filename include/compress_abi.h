@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * compress_abi.h: Compressed read-only block image format, shared by the
+ * tenders, the spt bindings and solo5-blktool.
+ *
+ * This header file must be kept self-contained with no external dependencies
+ * other than C99 headers.
+ */
+
+#ifndef COMPRESS_ABI_H
+#define COMPRESS_ABI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * A compressed image consists of:
+ *
+ *     [ header | chunk 0 | chunk 1 | ... | chunk N-1 | index ]
+ *
+ * The uncompressed image is split into fixed-size chunks of (chunk_size)
+ * bytes (the last chunk may be shorter), each of which is compressed
+ * independently. The index at (index_offset) holds N + 1 offsets: chunk i is
+ * stored at [index[i], index[i + 1]). A chunk whose stored size equals its
+ * uncompressed size is stored uncompressed.
+ *
+ * Chunks are compressed with a byte-oriented LZ77 variant, see
+ * compress_lz_decode() below.
+ *
+ * All fields are stored in host byte order.
+ */
+#define COMPRESS_MAGIC          "SOLO5CMP"
+#define COMPRESS_VERSION        1
+#define COMPRESS_MIN_CHUNK_SIZE 4096
+#define COMPRESS_MAX_CHUNK_SIZE (1024 * 1024)
+
+struct compress_header {
+    char magic[8];              /* COMPRESS_MAGIC, not NUL-terminated */
+    uint32_t version;           /* COMPRESS_VERSION */
+    uint32_t chunk_size;        /* Uncompressed chunk size, bytes */
+    uint64_t capacity;          /* Uncompressed image size, bytes */
+    uint64_t index_offset;      /* Offset of chunk index */
+    uint64_t max_csize;         /* Largest stored chunk, bytes */
+};
+
+/*
+ * An attached compressed image, as seen by the tender and spt bindings.
+ * Chunks are decompressed on read into a cache of (nslots) chunks, evicting
+ * the least recently used.
+ */
+struct compress_dev {
+    int fd;
+    uint32_t chunk_size;
+    uint32_t nslots;
+    uint64_t capacity;
+    uint64_t nchunks;
+    uint64_t max_csize;
+    const uint64_t *index;      /* nchunks + 1 entries */
+    uint8_t *cbuf;              /* max_csize bytes, for compressed chunks */
+    uint8_t *cache;             /* nslots * chunk_size bytes */
+    uint64_t *tags;             /* Chunk number + 1 in each slot, or 0 */
+    uint64_t *used;             /* Time of last use of each slot */
+    uint64_t clock;
+    uint64_t hits;
+    uint64_t misses;
+};
+
+/*
+ * Decompress (slen) bytes at (src) into at most (dlen) bytes at (dst).
+ * Returns the decompressed size, or -1 if the input is malformed.
+ *
+ * The input is a sequence of sequences, each consisting of:
+ *
+ *     token               4 bits literal length, 4 bits match length - 4
+ *     [ length bytes ]    if literal length is 15, add bytes until one < 255
+ *     literals
+ *     offset              2 bytes, little-endian, 1 .. 65535
+ *     [ length bytes ]    if match length - 4 is 15, as for literals
+ *
+ * The last sequence ends after its literals, with no offset.
+ */
+static inline long compress_lz_decode(const uint8_t *src, size_t slen,
+        uint8_t *dst, size_t dlen)
+{
+    const uint8_t *ip = src, *iend = src + slen;
+    uint8_t *op = dst, *oend = dst + dlen;
+
+    while (ip < iend) {
+        unsigned token = *ip++;
+        size_t lit = token >> 4;
+        if (lit == 15) {
+            unsigned b;
+            do {
+                if (ip == iend)
+                    return -1;
+                b = *ip++;
+                lit += b;
+            } while (b == 255);
+        }
+        if (lit > (size_t)(iend - ip) || lit > (size_t)(oend - op))
+            return -1;
+        __builtin_memcpy(op, ip, lit);
+        op += lit;
+        ip += lit;
+        if (ip == iend)
+            break;
+
+        if (iend - ip < 2)
+            return -1;
+        size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - dst))
+            return -1;
+        size_t mlen = token & 15;
+        if (mlen == 15) {
+            unsigned b;
+            do {
+                if (ip == iend)
+                    return -1;
+                b = *ip++;
+                mlen += b;
+            } while (b == 255);
+        }
+        mlen += 4;
+        if (mlen > (size_t)(oend - op))
+            return -1;
+        const uint8_t *match = op - offset;
+        if (offset >= mlen) {
+            __builtin_memcpy(op, match, mlen);
+            op += mlen;
+        }
+        else {
+            /*
+             * Overlapping match, e.g. a run of a repeated short pattern.
+             */
+            while (mlen--)
+                *op++ = *match++;
+        }
+    }
+    return op - dst;
+}
+
+static inline size_t compress_chunk_len(const struct compress_dev *d,
+        uint64_t chunk)
+{
+    uint64_t start = chunk * d->chunk_size;
+
+    return (d->capacity - start < d->chunk_size) ?
+        (size_t)(d->capacity - start) : d->chunk_size;
+}
+
+/*
+ * Reads (len) bytes at offset (off) from (fd) into (buf), returning the number
+ * of bytes read or a negative value on error.
+ */
+typedef long (*compress_pread_fn)(int fd, void *buf, size_t len,
+        uint64_t off);
+
+/*
+ * Returns the decompressed contents of (chunk) of (d), reading and
+ * decompressing it into the cache if necessary, or NULL on error.
+ */
+static inline const uint8_t *compress_get_chunk(struct compress_dev *d,
+        uint64_t chunk, compress_pread_fn pread_fn)
+{
+    unsigned victim = 0;
+
+    d->clock++;
+    for (unsigned i = 0; i != d->nslots; i++) {
+        if (d->tags[i] == chunk + 1) {
+            d->used[i] = d->clock;
+            d->hits++;
+            return d->cache + (size_t)i * d->chunk_size;
+        }
+        if (d->used[i] < d->used[victim])
+            victim = i;
+    }
+    d->misses++;
+
+    uint8_t *dst = d->cache + (size_t)victim * d->chunk_size;
+    uint64_t start = d->index[chunk], end = d->index[chunk + 1];
+    size_t ulen = compress_chunk_len(d, chunk);
+    d->tags[victim] = 0;
+    if (end < start || end - start > d->max_csize || end - start > ulen)
+        return NULL;
+    size_t clen = end - start;
+
+    if (clen == ulen) {
+        if (pread_fn(d->fd, dst, clen, start) != (long)clen)
+            return NULL;
+    }
+    else {
+        if (pread_fn(d->fd, d->cbuf, clen, start) != (long)clen)
+            return NULL;
+        if (compress_lz_decode(d->cbuf, clen, dst, ulen) != (long)ulen)
+            return NULL;
+    }
+    d->tags[victim] = chunk + 1;
+    d->used[victim] = d->clock;
+    return dst;
+}
+
+/*
+ * Read (len) bytes at (pos) of the uncompressed image (d) into (buf). The
+ * range must be within the image's capacity. Returns 0 on success, -1 on
+ * failure.
+ */
+static inline int compress_read(struct compress_dev *d, uint8_t *buf,
+        size_t len, uint64_t pos, compress_pread_fn pread_fn)
+{
+    while (len > 0) {
+        uint64_t chunk = pos / d->chunk_size;
+        size_t off = pos % d->chunk_size;
+        size_t n = compress_chunk_len(d, chunk) - off;
+        if (n > len)
+            n = len;
+
+        const uint8_t *data = compress_get_chunk(d, chunk, pread_fn);
+        if (data == NULL)
+            return -1;
+        __builtin_memcpy(buf, data + off, n);
+        buf += n;
+        pos += n;
+        len -= n;
+    }
+    return 0;
+}
+
+#endif /* COMPRESS_ABI_H */
@@ -41,7 +41,7 @@
  * in this file.
  */
 
-#define HVT_ABI_VERSION 1
+#define HVT_ABI_VERSION 2
 
 /*
  * Lowest virtual address at which guests can be loaded.
@@ -177,6 +177,9 @@ enum hvt_hypercall {
     HVT_HYPERCALL_NET_WRITE,
     HVT_HYPERCALL_NET_READ,
     HVT_HYPERCALL_HALT,
+    HVT_HYPERCALL_MEM_ADVISE,
+    HVT_HYPERCALL_NET_TXRING,
+    HVT_HYPERCALL_NET_NOTIFY,
     HVT_HYPERCALL_MAX
 };
 
@@ -223,12 +226,23 @@ struct hvt_hc_block_read {
     int ret;
 };
 
+/*
+ * HVT_HYPERCALL_NET_WRITE, HVT_HYPERCALL_NET_READ: (offload) points to
+ * HVT_NET_OFFLOAD_SIZE bytes of offload metadata (struct solo5_net_offload)
+ * to be sent with, or received for, the packet. It must be NULL if offload is
+ * not enabled for (handle). Otherwise, it must not be NULL for
+ * HVT_HYPERCALL_NET_READ, and NULL is equivalent to all zeroes for
+ * HVT_HYPERCALL_NET_WRITE.
+ */
+#define HVT_NET_OFFLOAD_SIZE 10
+
 /* HVT_HYPERCALL_NET_WRITE */
 struct hvt_hc_net_write {
     /* IN */
     uint64_t handle;
     HVT_GUEST_PTR(const void *) data;
     size_t len;
+    HVT_GUEST_PTR(const void *) offload;
 
     /* OUT */
     int ret;
@@ -239,6 +253,7 @@ struct hvt_hc_net_read {
     /* IN */
     uint64_t handle;
     HVT_GUEST_PTR(void *) data;
+    HVT_GUEST_PTR(void *) offload;
 
     /* IN/OUT */
     size_t len;
@@ -277,4 +292,72 @@ struct hvt_hc_halt {
     int exit_status;
 };
 
+/*
+ * HVT_HYPERCALL_MEM_ADVISE: Advise the tender about the guest's use of the
+ * memory range (addr, addr + len).
+ *
+ * HVT_MEM_ADVISE_RELEASE: The guest no longer needs the contents of the
+ * range, the tender may return the backing pages to the host.
+ * HVT_MEM_ADVISE_REUSE: The guest is about to use a previously released range
+ * again.
+ *
+ * (addr) and (len) must be aligned to the guest page size.
+ */
+#define HVT_MEM_ADVISE_RELEASE 1
+#define HVT_MEM_ADVISE_REUSE   2
+
+struct hvt_hc_mem_advise {
+    /* IN */
+    HVT_GUEST_PTR(void *) addr;
+    size_t len;
+    int advice;
+
+    /* OUT */
+    int ret;
+};
+
+/*
+ * HVT_HYPERCALL_NET_TXRING: Register a transmit ring for the network device
+ * (handle).
+ *
+ * If the tender has enabled asynchronous transmit for (handle), the (struct
+ * hvt_net_txring) at (ring) is registered and SOLO5_R_OK is returned. If
+ * (ring) is NULL, the tender only reports whether asynchronous transmit is
+ * enabled. Otherwise, SOLO5_R_EUNSPEC is returned and the guest must use
+ * HVT_HYPERCALL_NET_WRITE.
+ *
+ * Once a ring has been registered, the guest transmits a frame by copying it
+ * to the slot at (prod % HVT_NET_TXRING_SLOTS) and incrementing (prod). If
+ * (kick) is non-zero the guest must then notify the tender by issuing
+ * HVT_HYPERCALL_NET_NOTIFY with (handle) as the argument. The tender consumes
+ * frames asynchronously, incrementing (cons) as it does so. The tender
+ * initialises (prod), (cons) and (kick) when the ring is registered.
+ *
+ * HVT_HYPERCALL_NET_NOTIFY has no argument structure and no return value; the
+ * tender may service it without the VCPU leaving the hypervisor.
+ *
+ * Frames larger than HVT_NET_TXRING_FRAME_SIZE, or which do not fit into the
+ * ring, may be sent using HVT_HYPERCALL_NET_WRITE, which first transmits any
+ * frames queued on the ring.
+ */
+#define HVT_NET_TXRING_SLOTS      128
+#define HVT_NET_TXRING_FRAME_SIZE 2048
+
+struct hvt_net_txring {
+    uint32_t prod;                      /* Written by guest */
+    uint32_t cons;                      /* Written by tender */
+    uint32_t kick;                      /* Written by tender */
+    uint32_t len[HVT_NET_TXRING_SLOTS]; /* Written by guest */
+    uint8_t frame[HVT_NET_TXRING_SLOTS][HVT_NET_TXRING_FRAME_SIZE];
+};
+
+struct hvt_hc_net_txring {
+    /* IN */
+    uint64_t handle;
+    HVT_GUEST_PTR(struct hvt_net_txring *) ring;
+
+    /* OUT */
+    int ret;
+};
+
 #endif /* HVT_ABI_H */
@@ -62,6 +62,7 @@ struct mft_block_basic {
 struct mft_net_basic {
     uint8_t mac[6];
     uint16_t mtu;
+    bool offload;               /* Offload metadata (virtio-net header)? */
 };
 
 #define MFT_NAME_SIZE 68        /* Bytes, including string terminator */
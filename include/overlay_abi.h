@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * overlay_abi.h: Copy-on-write overlay block image format, shared by the
+ * tenders, the spt bindings and solo5-blktool.
+ *
+ * This header file must be kept self-contained with no external dependencies
+ * other than C99 headers.
+ */
+
+#ifndef OVERLAY_ABI_H
+#define OVERLAY_ABI_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * An overlay ("delta") file records the blocks written by a guest on top of a
+ * read-only base image. It consists of:
+ *
+ *     [ header | allocation bitmap | data ]
+ *
+ * The bitmap has one bit per block of the base image, set once the block has
+ * been written to the delta. Block N is stored at (data_offset + N *
+ * block_size), i.e. at the same offset as in the base image, so that the
+ * data area of the file is sparse and only consumes space for blocks which
+ * have been written. The bitmap and data areas are aligned to
+ * OVERLAY_ALIGN, allowing the bitmap to be memory-mapped.
+ *
+ * All fields are stored in host byte order.
+ */
+#define OVERLAY_MAGIC       "SOLO5OVL"
+#define OVERLAY_VERSION     1
+#define OVERLAY_BLOCK_SIZE  512
+#define OVERLAY_ALIGN       4096
+
+struct overlay_header {
+    char magic[8];              /* OVERLAY_MAGIC, not NUL-terminated */
+    uint32_t version;           /* OVERLAY_VERSION */
+    uint32_t block_size;        /* Allocation granularity, bytes */
+    uint64_t capacity;          /* Size of the base image, bytes */
+    uint64_t bitmap_offset;     /* Offset of the allocation bitmap */
+    uint64_t bitmap_size;       /* Size of the allocation bitmap, bytes */
+    uint64_t data_offset;       /* Offset of block 0 */
+};
+
+/*
+ * An attached overlay, as seen by the tender and spt bindings. (bitmap) is a
+ * shared mapping of the delta file's allocation bitmap.
+ */
+struct overlay_dev {
+    int base_fd;
+    int delta_fd;
+    uint32_t block_size;
+    uint64_t capacity;
+    uint64_t data_offset;
+    uint8_t *bitmap;
+};
+
+static inline uint64_t overlay_bitmap_size(uint64_t capacity,
+        uint32_t block_size)
+{
+    uint64_t nblocks = (capacity + block_size - 1) / block_size;
+    uint64_t size = (nblocks + 7) / 8;
+
+    return (size + OVERLAY_ALIGN - 1) & ~(uint64_t)(OVERLAY_ALIGN - 1);
+}
+
+static inline bool overlay_is_allocated(const uint8_t *bitmap, uint64_t block)
+{
+    return __atomic_load_n(&bitmap[block / 8], __ATOMIC_ACQUIRE) &
+        (1U << (block % 8));
+}
+
+/*
+ * Mark (block) as allocated in (bitmap). Must only be called once the block
+ * has been written to the delta.
+ */
+static inline void overlay_set_allocated(uint8_t *bitmap, uint64_t block)
+{
+    __atomic_fetch_or(&bitmap[block / 8], (uint8_t)(1U << (block % 8)),
+            __ATOMIC_RELEASE);
+}
+
+#endif /* OVERLAY_ABI_H */
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * prelink_abi.h: Prelinked boot image format, shared by solo5-elftool and the
+ * tenders.
+ *
+ * A prelinked image contains the guest memory image of a unikernel as it
+ * would be loaded by the tender's ELF loader, so that the tender can map it
+ * directly into guest memory at startup. Prelinked images are specific to
+ * the host architecture and ABI target they were produced for.
+ *
+ * This header file must be kept self-contained with no external dependencies
+ * other than C99 headers.
+ */
+
+#ifndef PRELINK_ABI_H
+#define PRELINK_ABI_H
+
+#include <stdint.h>
+
+#define PRELINK_MAGIC           "SOLO5PLI"
+#define PRELINK_MAGIC_SIZE      8
+#define PRELINK_VERSION         1
+
+/*
+ * Maximum number of memory protection regions in an image. The Solo5
+ * linker scripts produce at most four (text, rodata, data and bss).
+ */
+#define PRELINK_MAX_REGIONS     16
+
+/*
+ * Maximum number of Solo5 notes carried over from the original executable.
+ */
+#define PRELINK_MAX_NOTES       4
+
+/*
+ * Region protection flags, with the same values as PF_X, PF_W, PF_R in ELF.
+ */
+#define PRELINK_PROT_X          0x1
+#define PRELINK_PROT_W          0x2
+#define PRELINK_PROT_R          0x4
+
+/*
+ * Guest memory range (start .. end) with protection flags (prot).
+ */
+struct prelink_region {
+    uint64_t start;
+    uint64_t end;
+    uint32_t prot;
+    uint32_t reserved;
+};
+
+/*
+ * Copy of the descriptor (content) of the Solo5-owned ELF note of (type),
+ * without any internal alignment, found at (offset) in the file.
+ */
+struct prelink_note {
+    uint32_t type;
+    uint32_t reserved;
+    uint64_t offset;
+    uint64_t size;
+};
+
+/*
+ * Image header, found at offset 0 in the file. All offsets are from the
+ * start of the file, and all guest addresses are guest-physical.
+ *
+ * The memory image for guest addresses (base .. base + filesz) is found at
+ * (image_offset), which is aligned to (page_size). Guest memory from
+ * (base + filesz) up to (end) is zero-filled. Regions must be sorted by
+ * (start) in ascending order and must not overlap.
+ */
+struct prelink_hdr {
+    char magic[PRELINK_MAGIC_SIZE];
+    uint32_t version;
+    uint32_t machine;           /* ELF e_machine */
+    uint64_t page_size;
+    uint64_t entry;
+    uint64_t base;
+    uint64_t end;
+    uint64_t image_offset;
+    uint64_t filesz;
+    uint32_t nnotes;
+    uint32_t nregions;
+    struct prelink_note notes[PRELINK_MAX_NOTES];
+    struct prelink_region regions[PRELINK_MAX_REGIONS];
+};
+
+#endif /* PRELINK_ABI_H */
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * rate_abi.h: Token bucket rate limiting, shared by the tenders and the spt
+ * bindings.
+ *
+ * This header file must be kept self-contained with no external dependencies
+ * other than C99 headers.
+ */
+
+#ifndef RATE_ABI_H
+#define RATE_ABI_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * A token bucket, refilled at (rate) tokens per second up to (burst) tokens.
+ * A (rate) of 0 means unlimited.
+ *
+ * The bucket is implemented as a generic cell rate algorithm: (tat) is the
+ * theoretical time at which the bucket will be full again, in nanoseconds.
+ * An operation may proceed if the bucket is not in debt, i.e. (tat) is less
+ * than (burst) tokens' worth of time in the future, which allows a single
+ * operation larger than (burst) once the bucket has refilled.
+ */
+struct rate_bucket {
+    uint64_t rate;
+    uint64_t burst;
+    uint64_t tat;
+};
+
+/*
+ * Rate limit for a single device, in bytes and operations per second, and
+ * statistics on the time the device has been throttled.
+ */
+struct rate_limit {
+    struct rate_bucket bytes;
+    struct rate_bucket ops;
+    uint64_t last_ns;           /* Time of last operation */
+    uint64_t throttled_since;   /* Start of current throttled period, or 0 */
+    uint64_t throttled_ns;      /* Total time throttled */
+    uint64_t throttled;         /* Number of throttled periods */
+};
+
+#define RATE_NSEC_PER_SEC UINT64_C(1000000000)
+
+static inline bool rate_limit_enabled(const struct rate_limit *rl)
+{
+    return rl->bytes.rate != 0 || rl->ops.rate != 0;
+}
+
+/*
+ * Returns the time in nanoseconds from (now_ns) until an operation on (b) may
+ * proceed, or 0 if it may proceed now.
+ */
+static inline uint64_t rate_bucket_wait_ns(const struct rate_bucket *b,
+        uint64_t now_ns)
+{
+    if (b->rate == 0)
+        return 0;
+    uint64_t limit = now_ns + b->burst * RATE_NSEC_PER_SEC / b->rate;
+    return (b->tat < limit) ? 0 : b->tat - limit + 1;
+}
+
+static inline void rate_bucket_take(struct rate_bucket *b, uint64_t now_ns,
+        uint64_t n)
+{
+    if (b->rate == 0)
+        return;
+    if (b->tat < now_ns)
+        b->tat = now_ns;
+    b->tat += n * RATE_NSEC_PER_SEC / b->rate;
+}
+
+/*
+ * Account for an operation of (bytes) at time (now_ns) against (rl). Returns
+ * true if the operation may proceed, or false if the device is throttled.
+ */
+static inline bool rate_limit_take(struct rate_limit *rl, uint64_t now_ns,
+        uint64_t bytes)
+{
+    rl->last_ns = now_ns;
+    if (rate_bucket_wait_ns(&rl->bytes, now_ns) != 0 ||
+            rate_bucket_wait_ns(&rl->ops, now_ns) != 0) {
+        if (rl->throttled_since == 0) {
+            rl->throttled_since = now_ns;
+            rl->throttled++;
+        }
+        return false;
+    }
+    if (rl->throttled_since != 0) {
+        rl->throttled_ns += now_ns - rl->throttled_since;
+        rl->throttled_since = 0;
+    }
+    rate_bucket_take(&rl->bytes, now_ns, bytes);
+    rate_bucket_take(&rl->ops, now_ns, 1);
+    return true;
+}
+
+/*
+ * Returns the time in nanoseconds until an operation on (rl) may proceed,
+ * as of its last operation.
+ */
+static inline uint64_t rate_limit_wait_ns(const struct rate_limit *rl)
+{
+    uint64_t bytes_ns = rate_bucket_wait_ns(&rl->bytes, rl->last_ns);
+    uint64_t ops_ns = rate_bucket_wait_ns(&rl->ops, rl->last_ns);
+
+    return (bytes_ns > ops_ns) ? bytes_ns : ops_ns;
+}
+
+#endif /* RATE_ABI_H */
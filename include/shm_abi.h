@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * shm_abi.h: Shared memory point-to-point network link definitions, shared
+ * between the tenders and spt guests.
+ *
+ * A link connects exactly two network devices, possibly in different
+ * tenders, through a shared memory region containing one packet ring per
+ * direction. Each ring has an eventfd "doorbell", which the producer signals
+ * only when the ring goes from empty to non-empty. The consumer clears the
+ * doorbell only when it finds the ring empty, so no system calls are needed
+ * while packets are flowing.
+ *
+ * On spt, the guest operates the rings directly. On hvt, the tender operates
+ * the rings on behalf of the guest.
+ *
+ * This header file must be kept self-contained with no external dependencies
+ * other than C99 headers.
+ */
+
+#ifndef SHM_ABI_H
+#define SHM_ABI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHM_NET_MAGIC      0x4d484e35  /* "5NHM" */
+#define SHM_NET_SLOTS      256         /* Per ring, must be a power of 2 */
+#define SHM_NET_SLOT_SIZE  2048
+#define SHM_NET_MAX_PACKET (SHM_NET_SLOT_SIZE - sizeof (uint32_t))
+
+struct shm_net_slot {
+    uint32_t len;
+    uint8_t data[SHM_NET_MAX_PACKET];
+};
+
+/*
+ * (head) is written only by the producer, (tail) only by the consumer. They
+ * are kept on separate cache lines.
+ */
+struct shm_net_ring {
+    uint32_t head;
+    uint8_t pad0[60];
+    uint32_t tail;
+    uint8_t pad1[60];
+    struct shm_net_slot slots[SHM_NET_SLOTS];
+};
+
+/*
+ * Layout of the shared memory region. Ring (i) carries packets sent by side
+ * (i) of the link.
+ */
+struct shm_net_region {
+    uint32_t magic;
+    uint8_t pad[60];
+    struct shm_net_ring ring[2];
+};
+
+/*
+ * One side's view of a link.
+ */
+struct shm_net_port {
+    struct shm_net_ring *rx, *tx;
+    int rx_fd;                          /* Doorbell for (rx), pollable */
+    int tx_fd;                          /* Doorbell for (tx) */
+};
+
+/*
+ * Receive a single packet from (port) into (buf), of at most (size) bytes.
+ * Returns the length of the packet received, or 0 if none were available.
+ * Packets larger than (size) are truncated.
+ *
+ * If this returns 0, the caller must clear (port->rx_fd) by reading from it
+ * and then call shm_net_read() again, to avoid missing a packet sent in the
+ * meantime.
+ */
+static inline size_t shm_net_read(struct shm_net_port *port, uint8_t *buf,
+        size_t size)
+{
+    struct shm_net_ring *r = port->rx;
+    uint32_t tail = r->tail;
+    uint32_t head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+
+    if (head == tail)
+        return 0;
+
+    struct shm_net_slot *s = &r->slots[tail & (SHM_NET_SLOTS - 1)];
+    /*
+     * The slot is writable by the peer, so read (len) only once and bound
+     * it.
+     */
+    size_t len = __atomic_load_n(&s->len, __ATOMIC_RELAXED);
+    if (len > SHM_NET_MAX_PACKET)
+        len = SHM_NET_MAX_PACKET;
+    if (len > size)
+        len = size;
+    __builtin_memcpy(buf, s->data, len);
+    __atomic_store_n(&r->tail, tail + 1, __ATOMIC_RELEASE);
+
+    return len;
+}
+
+/*
+ * Queue a single packet of (len) bytes from (buf) on (port). (len) must not
+ * exceed SHM_NET_MAX_PACKET.
+ *
+ * Returns -1 if the ring is full, otherwise 0, or 1 if the caller must signal
+ * (port->tx_fd) by writing to it.
+ */
+static inline int shm_net_write(struct shm_net_port *port, const uint8_t *buf,
+        size_t len)
+{
+    struct shm_net_ring *r = port->tx;
+    uint32_t head = r->head;
+    uint32_t tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= SHM_NET_SLOTS)
+        return -1;
+
+    struct shm_net_slot *s = &r->slots[head & (SHM_NET_SLOTS - 1)];
+    __builtin_memcpy(s->data, buf, len);
+    s->len = len;
+    __atomic_store_n(&r->head, head + 1, __ATOMIC_RELEASE);
+
+    /*
+     * Pairs with the consumer clearing its doorbell before re-checking the
+     * ring: either the consumer sees our new (head), or we see that it has
+     * consumed everything up to it and must be woken up.
+     */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+    return tail == head ? 1 : 0;
+}
+
+#endif /* SHM_ABI_H */
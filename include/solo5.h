@@ -134,6 +134,38 @@ void solo5_abort(void) __attribute__((noreturn));
  */
 solo5_result_t solo5_set_tls_base(uintptr_t base);
 
+/*
+ * Memory.
+ */
+
+/*
+ * Advises Solo5 that the application no longer needs the contents of the
+ * memory range (start, start + size), allowing the host to reclaim the
+ * backing pages.
+ *
+ * The range MUST lie entirely within the heap region passed to
+ * solo5_app_main() in (info->heap_start, info->heap_size), otherwise
+ * SOLO5_R_EINVAL is returned. Only whole pages within the range are
+ * released; a range which does not cover any whole page is a no-op.
+ *
+ * After this call returns, the contents of the released pages are undefined.
+ * The application MUST call solo5_mem_reuse() before accessing the range
+ * again.
+ *
+ * This call is advisory: Solo5 implementations which do not support returning
+ * memory to the host will return SOLO5_R_OK without releasing any memory.
+ */
+solo5_result_t solo5_mem_release(uintptr_t start, size_t size);
+
+/*
+ * Advises Solo5 that the application is about to re-use the memory range
+ * (start, start + size), previously released with solo5_mem_release().
+ *
+ * The same constraints on (start, size) as for solo5_mem_release() apply. The
+ * contents of any pages in the range which were released are undefined.
+ */
+solo5_result_t solo5_mem_reuse(uintptr_t start, size_t size);
+
 /*
  * Time.
  */
@@ -203,6 +235,7 @@ void solo5_console_write(const char *buf, size_t size);
 struct solo5_net_info {
     uint8_t mac_address[SOLO5_NET_ALEN];
     size_t mtu;                 /* Not including Ethernet header */
+    bool offload;               /* Offload metadata supported? */
 };
 
 /*
@@ -223,6 +256,9 @@ solo5_result_t solo5_net_acquire(const char *name, solo5_handle_t *handle,
  *
  * The maximum allowed value for (size) is (solo5_net_info.mtu +
  * SOLO5_NET_HLEN). The packet must include the ethernet frame header.
+ *
+ * If the host limits the transmit rate of the network device and the limit
+ * has been reached, returns SOLO5_R_AGAIN and the packet is not sent.
  */
 solo5_result_t solo5_net_write(solo5_handle_t handle, const uint8_t *buf,
         size_t size);
@@ -240,6 +276,82 @@ solo5_result_t solo5_net_write(solo5_handle_t handle, const uint8_t *buf,
 solo5_result_t solo5_net_read(solo5_handle_t handle, uint8_t *buf,
         size_t size, size_t *read_size);
 
+/*
+ * Offload metadata for a single network packet, used with
+ * solo5_net_write_offload() and solo5_net_read_offload(). The layout and
+ * values of this structure are those of the virtio-net packet header (struct
+ * virtio_net_hdr).
+ *
+ * (flags) is a combination of:
+ *
+ *   SOLO5_NET_OFFLOAD_F_NEEDS_CSUM: The packet requires a checksum to be
+ *   computed over the packet data starting at (csum_start) and stored at
+ *   (csum_start + csum_offset). The checksum field must be pre-filled with the
+ *   folded checksum of the pseudo-header, if the protocol requires one.
+ *   SOLO5_NET_OFFLOAD_F_DATA_VALID: (Received packets only.) The packet
+ *   checksums have already been validated.
+ *
+ * (gso_type) is one of SOLO5_NET_GSO_NONE, SOLO5_NET_GSO_TCPV4 or
+ * SOLO5_NET_GSO_TCPV6, optionally combined with SOLO5_NET_GSO_ECN. If not
+ * SOLO5_NET_GSO_NONE, the packet is a "super-frame" of up to
+ * SOLO5_NET_OFFLOAD_MAX_PACKET bytes, which is to be segmented into packets
+ * carrying (gso_size) bytes of payload each, with (hdr_len) being the length
+ * of the Ethernet, IP and TCP headers. Segmentation requires
+ * SOLO5_NET_OFFLOAD_F_NEEDS_CSUM.
+ */
+#define SOLO5_NET_OFFLOAD_F_NEEDS_CSUM  1
+#define SOLO5_NET_OFFLOAD_F_DATA_VALID  2
+
+#define SOLO5_NET_GSO_NONE              0
+#define SOLO5_NET_GSO_TCPV4             1
+#define SOLO5_NET_GSO_TCPV6             4
+#define SOLO5_NET_GSO_ECN               0x80
+
+/*
+ * Maximum size of a packet sent or received with offload metadata, including
+ * the Ethernet frame header.
+ */
+#define SOLO5_NET_OFFLOAD_MAX_PACKET    (65535 + SOLO5_NET_HLEN)
+
+struct solo5_net_offload {
+    uint8_t flags;
+    uint8_t gso_type;
+    uint16_t hdr_len;
+    uint16_t gso_size;
+    uint16_t csum_start;
+    uint16_t csum_offset;
+};
+
+/*
+ * Sends a single network packet to the network device identified by
+ * (handle), as for solo5_net_write(), with offload metadata (*offload).
+ *
+ * If (solo5_net_info.offload) is true, the host computes checksums and
+ * performs segmentation as requested by (*offload), and the maximum allowed
+ * value for (size) is SOLO5_NET_OFFLOAD_MAX_PACKET. Otherwise, (*offload)
+ * must be all zeroes, or SOLO5_R_EINVAL is returned.
+ */
+solo5_result_t solo5_net_write_offload(solo5_handle_t handle,
+        const struct solo5_net_offload *offload, const uint8_t *buf,
+        size_t size);
+
+/*
+ * Receives a single network packet from the network device identified by
+ * (handle), as for solo5_net_read(), storing its offload metadata in
+ * (*offload).
+ *
+ * If (solo5_net_info.offload) is true, the host may deliver packets with
+ * checksums not yet computed, and unsegmented super-frames; (size) should be
+ * at least SOLO5_NET_OFFLOAD_MAX_PACKET, as packets which do not fit are
+ * dropped. Otherwise, (*offload) is always set to all zeroes.
+ *
+ * Packets received with solo5_net_read() on a device supporting offload
+ * metadata always have their checksums computed; super-frames are dropped.
+ */
+solo5_result_t solo5_net_read_offload(solo5_handle_t handle,
+        struct solo5_net_offload *offload, uint8_t *buf, size_t size,
+        size_t *read_size);
+
 /*
  * Block I/O.
  *
@@ -279,6 +391,10 @@ solo5_result_t solo5_block_acquire(const char *name, solo5_handle_t *handle,
  * Both (size) and (offset) must be a multiple of the block size, otherwise
  * SOLO5_R_EINVAL is returned.
  *
+ * If the host limits the I/O rate of the block device and the limit has been
+ * reached, returns SOLO5_R_AGAIN and no data is written. If the block device
+ * has been attached read-only, returns SOLO5_R_EINVAL.
+ *
  * NOTE: Current implementations further limit the *maximum* I/O size to a
  * single block.
  */
@@ -293,10 +409,76 @@ solo5_result_t solo5_block_write(solo5_handle_t handle, solo5_off_t offset,
  * Both (size) and (offset) must be a multiple of the block size, otherwise
  * SOLO5_R_EINVAL is returned.
  *
+ * If the host limits the I/O rate of the block device and the limit has been
+ * reached, returns SOLO5_R_AGAIN and no data is read.
+ *
  * NOTE: Current implementations further limit the *maximum* I/O size to a
  * single block.
  */
 solo5_result_t solo5_block_read(solo5_handle_t handle, solo5_off_t offset,
         uint8_t *buf, size_t size);
 
+/*
+ * Maps the contents of the block device identified by (handle) read-only into
+ * the application's address space, storing the address of the mapping in
+ * (*addr). The mapping covers solo5_block_info.capacity bytes and remains
+ * valid for the lifetime of the application. Accessing the mapping does not
+ * count towards any I/O rate limit set by the host.
+ *
+ * This is only supported for block devices which the host has attached
+ * read-only and mapped; currently this is the case on spt for devices
+ * attached with --block:NAME=ro:PATH. Otherwise, returns SOLO5_R_EUNSPEC and
+ * the application should use solo5_block_read() instead.
+ */
+solo5_result_t solo5_block_map(solo5_handle_t handle, const uint8_t **addr);
+
+/*
+ * Asynchronous block I/O.
+ *
+ * An application may keep multiple requests in flight on a block device by
+ * submitting them with solo5_block_submit() and collecting them, in any
+ * order, with solo5_block_complete(). The request structure and the buffer
+ * (buf) it refers to are owned by the implementation from submission until
+ * the request is returned by solo5_block_complete(), and must not be modified
+ * or freed in the meantime.
+ *
+ * Both (size) and (offset) must be a multiple of the block size. Unlike
+ * solo5_block_read() and solo5_block_write(), (size) may span multiple
+ * blocks.
+ */
+struct solo5_block_request {
+    solo5_off_t offset;         /* Offset on block device, bytes */
+    uint8_t *buf;               /* Buffer to read into or write from */
+    size_t size;                /* Size of I/O, bytes */
+    bool write;                 /* true for a write, false for a read */
+    solo5_result_t result;      /* Result, set on completion */
+};
+
+/*
+ * Submits the request (*req) to the block device identified by (handle).
+ *
+ * If the device queue is full, returns SOLO5_R_AGAIN; the application should
+ * collect completed requests with solo5_block_complete() and try again. If
+ * (offset) or (size) are not valid for the device, or (size) exceeds the
+ * largest request the device supports, returns SOLO5_R_EINVAL.
+ *
+ * Once a request completes, the handle of its block device is included in
+ * the set of handles returned by solo5_yield().
+ *
+ * This is currently only supported on virtio. Otherwise, returns
+ * SOLO5_R_EUNSPEC and the application should use solo5_block_read() and
+ * solo5_block_write() instead.
+ */
+solo5_result_t solo5_block_submit(solo5_handle_t handle,
+        struct solo5_block_request *req);
+
+/*
+ * Retrieves a completed request from the block device identified by
+ * (handle), storing a pointer to it in (*req). The outcome of the I/O is
+ * stored in (*req)->result. If no request has completed, returns
+ * SOLO5_R_AGAIN.
+ */
+solo5_result_t solo5_block_complete(solo5_handle_t handle,
+        struct solo5_block_request **req);
+
 #endif
@@ -30,7 +30,13 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include "capture_abi.h"
+#include "compress_abi.h"
 #include "elf_abi.h"
+#include "overlay_abi.h"
+#include "rate_abi.h"
+#include "shm_abi.h"
+#include "xdp_abi.h"
 
 /*
  * ABI version. This must be incremented before cutting a release of Solo5 if
@@ -38,7 +44,7 @@
  * in this file.
  */
 
-#define SPT_ABI_VERSION 1
+#define SPT_ABI_VERSION 2
 
 /*
  * Lowest virtual address at which guests can be loaded.
@@ -56,6 +62,16 @@ struct spt_boot_info {
     const void *mft;                    /* Address of application manifest */
     int epollfd;                        /* epoll() set for yield() */
     int timerfd;                        /* internal timerfd for yield() */
+    struct xdp_port **net_xdp;          /* AF_XDP ports by handle, or NULL */
+    struct shm_net_port **net_shm;      /* shm ports by handle, or NULL */
+    struct rate_limit *net_rate;        /* Transmit limits by handle, or NULL */
+    struct rate_limit *block_rate;      /* I/O limits by handle, or NULL */
+    struct capture_ring **net_capture;  /* Capture rings by handle, or NULL */
+    struct overlay_dev **block_overlay; /* Block overlays by handle, or NULL */
+    const uint8_t **block_map;          /* Read-only block mappings by handle,
+                                           or NULL */
+    struct compress_dev **block_compressed; /* Compressed images by handle,
+                                               or NULL */
 };
 
 /*
@@ -0,0 +1,8 @@
+/* Automatically generated, do not edit */
+
+#ifndef __VERSION_H__
+#define __VERSION_H__
+
+#define SOLO5_VERSION "b86f65a-dirty"
+
+#endif
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * xdp_abi.h: AF_XDP port definitions, shared between the tenders and spt
+ * guests.
+ *
+ * An AF_XDP port consists of a UMEM (packet buffer area) and four rings
+ * shared with the host kernel. On spt, the tender sets up the port and the
+ * guest operates the rings directly, without any system calls on the receive
+ * path. On hvt, the tender operates the rings on behalf of the guest.
+ *
+ * This header file must be kept self-contained with no external dependencies
+ * other than C99 headers.
+ */
+
+#ifndef XDP_ABI_H
+#define XDP_ABI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * UMEM layout: XDP_PORT_NUM_FRAMES frames of XDP_PORT_FRAME_SIZE bytes each.
+ * The first XDP_PORT_RING_SIZE frames are used for receiving, the remaining
+ * XDP_PORT_RING_SIZE frames for transmitting. All rings have
+ * XDP_PORT_RING_SIZE entries.
+ */
+#define XDP_PORT_FRAME_SIZE 2048
+#define XDP_PORT_RING_SIZE  1024
+#define XDP_PORT_NUM_FRAMES (2 * XDP_PORT_RING_SIZE)
+
+/*
+ * Same value as XDP_RING_NEED_WAKEUP in <linux/if_xdp.h>.
+ */
+#define XDP_PORT_NEED_WAKEUP 1
+
+/*
+ * A single-producer, single-consumer ring shared with the host kernel.
+ * (producer), (consumer) and (flags) point to the shared indices and flags,
+ * (descs) to the ring entries.
+ */
+struct xdp_port_ring {
+    uint32_t *producer;
+    uint32_t *consumer;
+    uint32_t *flags;
+    void *descs;
+};
+
+/*
+ * Layout of RX and TX ring entries, same as struct xdp_desc in
+ * <linux/if_xdp.h>. FILL and COMPLETION ring entries are UMEM addresses
+ * (uint64_t).
+ */
+struct xdp_port_desc {
+    uint64_t addr;
+    uint32_t len;
+    uint32_t options;
+};
+
+struct xdp_port {
+    int fd;                             /* AF_XDP socket */
+    uint8_t *umem;                      /* UMEM base address */
+    struct xdp_port_ring fill, comp, rx, tx;
+    uint32_t tx_nfree;                  /* Free TX frames in (tx_free) */
+    uint64_t tx_free[XDP_PORT_RING_SIZE];
+};
+
+#define XDP_PORT_RING_MASK (XDP_PORT_RING_SIZE - 1)
+
+/*
+ * Receive a single packet from (port) into (buf), of at most (size) bytes.
+ * Returns the length of the packet received, or 0 if none were available.
+ * Packets larger than (size) are truncated.
+ */
+static inline size_t xdp_port_read(struct xdp_port *port, uint8_t *buf,
+        size_t size)
+{
+    uint32_t cons = *port->rx.consumer;
+    uint32_t prod = __atomic_load_n(port->rx.producer, __ATOMIC_ACQUIRE);
+
+    if (cons == prod)
+        return 0;
+
+    struct xdp_port_desc *d =
+        &((struct xdp_port_desc *)port->rx.descs)[cons & XDP_PORT_RING_MASK];
+    size_t len = d->len < size ? d->len : size;
+    __builtin_memcpy(buf, port->umem + d->addr, len);
+
+    /*
+     * Return the frame to the kernel. The FILL ring always has space, as
+     * there are exactly as many RX frames as FILL ring entries.
+     */
+    uint32_t fprod = *port->fill.producer;
+    ((uint64_t *)port->fill.descs)[fprod & XDP_PORT_RING_MASK] =
+        d->addr & ~(uint64_t)(XDP_PORT_FRAME_SIZE - 1);
+    __atomic_store_n(port->fill.producer, fprod + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(port->rx.consumer, cons + 1, __ATOMIC_RELEASE);
+
+    return len;
+}
+
+/*
+ * Queue a single packet of (len) bytes from (buf) for transmission on (port).
+ * (len) must not exceed XDP_PORT_FRAME_SIZE.
+ *
+ * Returns 0 on success, or -1 if no TX frames are available. On success, the
+ * caller must then kick the kernel with sendto() on (port->fd) if
+ * xdp_port_tx_need_wakeup() is true.
+ */
+static inline int xdp_port_write(struct xdp_port *port, const uint8_t *buf,
+        size_t len)
+{
+    /*
+     * Reclaim frames from completed transmissions.
+     */
+    uint32_t ccons = *port->comp.consumer;
+    uint32_t cprod = __atomic_load_n(port->comp.producer, __ATOMIC_ACQUIRE);
+    while (ccons != cprod) {
+        port->tx_free[port->tx_nfree++] =
+            ((uint64_t *)port->comp.descs)[ccons & XDP_PORT_RING_MASK];
+        ccons++;
+    }
+    __atomic_store_n(port->comp.consumer, ccons, __ATOMIC_RELEASE);
+
+    if (port->tx_nfree == 0)
+        return -1;
+
+    /*
+     * The TX ring always has space if there is a free frame, as there are
+     * exactly as many TX frames as TX ring entries.
+     */
+    uint64_t addr = port->tx_free[--port->tx_nfree];
+    __builtin_memcpy(port->umem + addr, buf, len);
+    uint32_t prod = *port->tx.producer;
+    struct xdp_port_desc *d =
+        &((struct xdp_port_desc *)port->tx.descs)[prod & XDP_PORT_RING_MASK];
+    d->addr = addr;
+    d->len = len;
+    d->options = 0;
+    __atomic_store_n(port->tx.producer, prod + 1, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+static inline int xdp_port_tx_need_wakeup(struct xdp_port *port)
+{
+    return __atomic_load_n(port->tx.flags, __ATOMIC_ACQUIRE) &
+        XDP_PORT_NEED_WAKEUP;
+}
+
+#endif /* XDP_ABI_H */
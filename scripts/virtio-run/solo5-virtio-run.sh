@@ -25,11 +25,18 @@ Usage: solo5-virtio-run [ OPTIONS ] UNIKERNEL [ -- ] [ ARGUMENTS ... ]
 Launch the Solo5 UNIKERNEL (virtio target). Unikernel output is sent to stdout.
 
 Options:
-    -d DISK: Attach virtio-blk device with DISK image file.
+    -d DISK: Attach virtio-blk device with DISK image file. May be given
+       more than once, devices are attached in the order given.
 
     -m MEM: Start guest with MEM megabytes of memory (default is 128).
 
-    -n NETIF: Attach virtio-net device with NETIF tap interface.
+    -n NETIF: Attach virtio-net device with NETIF tap interface. May be
+       given more than once, devices are attached in the order given.
+
+    -o PROPS: Set PROPS on the virtio devices (QEMU only). For example, use
+       "disable-legacy=on,packed=on" for modern-only devices with packed
+       virtqueues, which require Solo5 to be configured with
+       --enable-virtio-modern.
 
     -q: Quiet mode. Don't print hypervisor incantations.
 
@@ -59,19 +66,21 @@ is_quiet ()
 }
 
 # Parse command line arguments.
-ARGS=$(getopt d:m:n:qH: $*)
+ARGS=$(getopt d:m:n:o:qH: $*)
 [ $? -ne 0 ] && usage
 set -- $ARGS
 MEM=128
 HV=best
-NETIF=
-BLKIMG=
+NETIFS=
+BLKIMGS=
+DEVPROPS=
 QUIET=
 while true; do
     case "$1" in
     -d)
         BLKIMG=$(readlink -f $2)
         [ -f ${BLKIMG} ] || die "not found: ${BLKIMG}"
+        BLKIMGS="${BLKIMGS} ${BLKIMG}"
         shift; shift
         ;;
     -m)
@@ -87,6 +96,11 @@ while true; do
         ip a show ${NETIF} >/dev/null 2>&1 ||
             ifconfig ${NETIF} >/dev/null 2>&1 ||
             die "no such network interface: ${NETIF}"
+        NETIFS="${NETIFS} ${NETIF}"
+        shift; shift
+        ;;
+    -o)
+        DEVPROPS=",$2"
         shift; shift
         ;;
     -q)
@@ -155,14 +169,19 @@ kvm|qemu)
     hv_addargs -display none -serial stdio
 
     # Network
-    if [ -n "${NETIF}" ]; then
-        hv_addargs -device virtio-net,netdev=n0
-        hv_addargs -netdev tap,id=n0,ifname=${NETIF},script=no,downscript=no
-    fi
+    N=0
+    for NETIF in ${NETIFS}; do
+        hv_addargs -device virtio-net-pci,netdev=n${N}${DEVPROPS}
+        hv_addargs -netdev tap,id=n${N},ifname=${NETIF},script=no,downscript=no
+        N=$((N + 1))
+    done
     # Disk
-    if [ -n "${BLKIMG}" ]; then
-        hv_addargs -drive file=${BLKIMG},if=virtio,format=raw
-    fi
+    N=0
+    for BLKIMG in ${BLKIMGS}; do
+        hv_addargs -drive file=${BLKIMG},if=none,id=d${N},format=raw
+        hv_addargs -device virtio-blk-pci,drive=d${N}${DEVPROPS}
+        N=$((N + 1))
+    done
 
     # Used by automated tests on QEMU (see kernel/virtio/platform.c).
     hv_addargs -device isa-debug-exit
@@ -181,6 +200,8 @@ kvm|qemu)
     fi
     ;;
 bhyve)
+    [ -n "${DEVPROPS}" ] && die "-o is only supported with QEMU"
+
     # Load the VM using grub-bhyve. Kill stdout as this is normal GRUB output.
     (is_quiet || set -x; \
         printf -- "multiboot ${UNIKERNEL} placeholder %s\nboot\n" "$*" \
@@ -199,13 +220,17 @@ bhyve)
     hv_addargs -l com1,${TTYB}
     
     # Network
-    if [ -n "${NETIF}" ]; then
-        hv_addargs -s 2:0,virtio-net,${NETIF}
-    fi
+    N=0
+    for NETIF in ${NETIFS}; do
+        hv_addargs -s 2:${N},virtio-net,${NETIF}
+        N=$((N + 1))
+    done
     # Disk
-    if [ -n "${BLKIMG}" ]; then
-        hv_addargs -s 3:0,virtio-blk,${BLKIMG}
-    fi
+    N=0
+    for BLKIMG in ${BLKIMGS}; do
+        hv_addargs -s 3:${N},virtio-blk,${BLKIMG}
+        N=$((N + 1))
+    done
 
     hv_addargs ${VMNAME}
 
@@ -25,18 +25,23 @@
 #define _GNU_SOURCE
 #define _FILE_OFFSET_BITS 64
 #include <err.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <fcntl.h>
 #include <unistd.h>
 
-/*
- * Attach to the block device specified by (path), returning its capacity in
- * bytes in (*capacity).
- */
-int block_attach(const char *path, off_t *capacity_)
+#include "block_attach.h"
+
+static int block_open(const char *path, int flags, off_t *capacity_)
 {
-    int fd = open(path, O_RDWR);
+    int fd = open(path, flags);
     if (fd == -1)
         err(1, "Could not open block device: %s", path);
     off_t capacity = lseek(fd, 0, SEEK_END);
@@ -49,3 +54,278 @@ int block_attach(const char *path, off_t *capacity_)
     *capacity_ = capacity;
     return fd;
 }
+
+/*
+ * Attach to the block device specified by (path), returning its capacity in
+ * bytes in (*capacity).
+ */
+int block_attach(const char *path, off_t *capacity_)
+{
+    return block_open(path, O_RDWR, capacity_);
+}
+
+int block_attach_ro(const char *path, off_t *capacity_)
+{
+    return block_open(path, O_RDONLY, capacity_);
+}
+
+const uint8_t *block_attach_map(const char *path, off_t *capacity_)
+{
+    int fd = block_open(path, O_RDONLY, capacity_);
+    /*
+     * The mapping is shared so that guests mapping the same image share its
+     * pages in the host page cache.
+     */
+    void *map = mmap(NULL, *capacity_, PROT_READ, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED)
+        err(1, "%s: Could not map block device", path);
+    close(fd);
+    return map;
+}
+
+/*
+ * Open the image (base) read-only, returning its size in (*size).
+ */
+static int overlay_open_base(const char *base, off_t *size)
+{
+    int fd = open(base, O_RDONLY);
+    if (fd == -1)
+        err(1, "Could not open base image: %s", base);
+    *size = lseek(fd, 0, SEEK_END);
+    if (*size == -1)
+        err(1, "%s: Could not determine capacity", base);
+    if (*size < OVERLAY_BLOCK_SIZE)
+        errx(1, "%s: Base image must be at least 1 block (%d bytes) in size",
+                base, OVERLAY_BLOCK_SIZE);
+    return fd;
+}
+
+void block_overlay_create(const char *base, const char *delta)
+{
+    off_t capacity;
+    int base_fd = overlay_open_base(base, &capacity);
+    close(base_fd);
+
+    struct overlay_header hdr = { 0 };
+    memcpy(hdr.magic, OVERLAY_MAGIC, sizeof hdr.magic);
+    hdr.version = OVERLAY_VERSION;
+    hdr.block_size = OVERLAY_BLOCK_SIZE;
+    hdr.capacity = capacity;
+    hdr.bitmap_offset = OVERLAY_ALIGN;
+    hdr.bitmap_size = overlay_bitmap_size(capacity, OVERLAY_BLOCK_SIZE);
+    hdr.data_offset = hdr.bitmap_offset + hdr.bitmap_size;
+
+    int fd = open(delta, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd == -1)
+        err(1, "Could not create overlay: %s", delta);
+    /*
+     * The bitmap and data areas are left as holes, reading as zeroes (i.e.
+     * unallocated). Extending the file to its full size up front means that
+     * guest writes never have to grow it.
+     */
+    if (ftruncate(fd, hdr.data_offset + hdr.capacity) == -1)
+        err(1, "%s: Could not set size", delta);
+    if (pwrite(fd, &hdr, sizeof hdr, 0) != sizeof hdr)
+        err(1, "%s: Could not write header", delta);
+    if (close(fd) == -1)
+        err(1, "%s: Could not write overlay", delta);
+}
+
+struct overlay_dev *block_attach_overlay(const char *base, const char *delta,
+        off_t *capacity_)
+{
+    struct overlay_dev *o = calloc(1, sizeof *o);
+    if (o == NULL)
+        err(1, "calloc");
+
+    off_t capacity;
+    o->base_fd = overlay_open_base(base, &capacity);
+    /*
+     * A shared lock on the base image lets "solo5-blktool merge-overlay
+     * --in-place" refuse to modify it while it is in use.
+     */
+    if (flock(o->base_fd, LOCK_SH | LOCK_NB) == -1) {
+        if (errno == EWOULDBLOCK)
+            errx(1, "%s: Base image is being modified by another process",
+                    base);
+        err(1, "%s: Could not lock base image", base);
+    }
+    o->delta_fd = open(delta, O_RDWR);
+    if (o->delta_fd == -1)
+        err(1, "Could not open overlay: %s", delta);
+    /*
+     * Two writers sharing a delta would corrupt it, so hold an exclusive
+     * lock on it for as long as we are running.
+     */
+    if (flock(o->delta_fd, LOCK_EX | LOCK_NB) == -1) {
+        if (errno == EWOULDBLOCK)
+            errx(1, "%s: Overlay is in use by another process", delta);
+        err(1, "%s: Could not lock overlay", delta);
+    }
+
+    struct overlay_header hdr;
+    if (pread(o->delta_fd, &hdr, sizeof hdr, 0) != sizeof hdr)
+        errx(1, "%s: Could not read overlay header", delta);
+    if (memcmp(hdr.magic, OVERLAY_MAGIC, sizeof hdr.magic) != 0 ||
+            hdr.version != OVERLAY_VERSION)
+        errx(1, "%s: Not a Solo5 overlay, or unsupported version", delta);
+    if (hdr.block_size != OVERLAY_BLOCK_SIZE ||
+            hdr.bitmap_offset < sizeof hdr ||
+            hdr.bitmap_offset % OVERLAY_ALIGN != 0 ||
+            hdr.bitmap_size !=
+                overlay_bitmap_size(hdr.capacity, hdr.block_size) ||
+            hdr.data_offset < hdr.bitmap_offset + hdr.bitmap_size ||
+            hdr.data_offset % OVERLAY_ALIGN != 0)
+        errx(1, "%s: Invalid overlay header", delta);
+    /*
+     * The base image must not change under an overlay, a change in size is
+     * the only thing we can cheaply detect.
+     */
+    if (hdr.capacity != (uint64_t)capacity)
+        errx(1, "%s: Overlay was created for a base image of %llu bytes, "
+                "but %s is %llu bytes", delta,
+                (unsigned long long)hdr.capacity, base,
+                (unsigned long long)capacity);
+    off_t size = lseek(o->delta_fd, 0, SEEK_END);
+    if (size == -1)
+        err(1, "%s: Could not determine size", delta);
+    if ((uint64_t)size < hdr.data_offset + hdr.capacity &&
+            ftruncate(o->delta_fd, hdr.data_offset + hdr.capacity) == -1)
+        err(1, "%s: Could not set size", delta);
+
+    o->bitmap = mmap(NULL, hdr.bitmap_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED, o->delta_fd, hdr.bitmap_offset);
+    if (o->bitmap == MAP_FAILED)
+        err(1, "%s: Could not map allocation bitmap", delta);
+    o->block_size = hdr.block_size;
+    o->capacity = hdr.capacity;
+    o->data_offset = hdr.data_offset;
+
+    *capacity_ = capacity;
+    return o;
+}
+
+int block_overlay_read(struct overlay_dev *o, void *buf_, size_t len,
+        off_t pos)
+{
+    uint8_t *buf = buf_;
+
+    if (len % o->block_size != 0 || pos % o->block_size != 0)
+        return -1;
+    /*
+     * Read runs of blocks allocated in the delta, or not, with a single call
+     * each.
+     */
+    while (len > 0) {
+        uint64_t block = pos / o->block_size;
+        bool allocated = overlay_is_allocated(o->bitmap, block);
+        size_t n = o->block_size;
+        while (n < len && overlay_is_allocated(o->bitmap,
+                    block + n / o->block_size) == allocated)
+            n += o->block_size;
+
+        ssize_t ret = allocated ?
+            pread(o->delta_fd, buf, n, o->data_offset + pos) :
+            pread(o->base_fd, buf, n, pos);
+        if (ret != (ssize_t)n)
+            return -1;
+        buf += n;
+        pos += n;
+        len -= n;
+    }
+    return 0;
+}
+
+int block_overlay_write(struct overlay_dev *o, const void *buf, size_t len,
+        off_t pos)
+{
+    if (len % o->block_size != 0 || pos % o->block_size != 0)
+        return -1;
+
+    ssize_t ret = pwrite(o->delta_fd, buf, len, o->data_offset + pos);
+    if (ret != (ssize_t)len)
+        return -1;
+    for (uint64_t block = pos / o->block_size;
+            block != (pos + len) / o->block_size; block++)
+        overlay_set_allocated(o->bitmap, block);
+    return 0;
+}
+
+struct compress_dev *block_attach_compressed(const char *path,
+        unsigned nslots, off_t *capacity_)
+{
+    struct compress_dev *d = calloc(1, sizeof *d);
+    if (d == NULL)
+        err(1, "calloc");
+
+    d->fd = open(path, O_RDONLY);
+    if (d->fd == -1)
+        err(1, "Could not open compressed image: %s", path);
+    off_t size = lseek(d->fd, 0, SEEK_END);
+    if (size == -1)
+        err(1, "%s: Could not determine size", path);
+
+    struct compress_header hdr;
+    if (pread(d->fd, &hdr, sizeof hdr, 0) != sizeof hdr)
+        errx(1, "%s: Could not read header", path);
+    if (memcmp(hdr.magic, COMPRESS_MAGIC, sizeof hdr.magic) != 0 ||
+            hdr.version != COMPRESS_VERSION)
+        errx(1, "%s: Not a Solo5 compressed image, or unsupported version",
+                path);
+    if (hdr.chunk_size < COMPRESS_MIN_CHUNK_SIZE ||
+            hdr.chunk_size > COMPRESS_MAX_CHUNK_SIZE ||
+            (hdr.chunk_size & (hdr.chunk_size - 1)) != 0 ||
+            hdr.capacity < 512 ||
+            hdr.max_csize > hdr.chunk_size)
+        errx(1, "%s: Invalid header", path);
+
+    d->chunk_size = hdr.chunk_size;
+    d->capacity = hdr.capacity;
+    d->nchunks = (hdr.capacity + hdr.chunk_size - 1) / hdr.chunk_size;
+    d->max_csize = hdr.max_csize;
+    size_t index_size = (d->nchunks + 1) * sizeof (uint64_t);
+    if (hdr.index_offset < sizeof hdr ||
+            hdr.index_offset + index_size != (uint64_t)size)
+        errx(1, "%s: Invalid header", path);
+
+    uint64_t *index = malloc(index_size);
+    if (index == NULL)
+        err(1, "malloc");
+    if (pread(d->fd, index, index_size, hdr.index_offset) !=
+            (ssize_t)index_size)
+        errx(1, "%s: Could not read index", path);
+    if (index[0] < sizeof hdr || index[d->nchunks] != hdr.index_offset)
+        errx(1, "%s: Invalid index", path);
+    for (uint64_t i = 0; i != d->nchunks; i++) {
+        if (index[i + 1] < index[i] ||
+                index[i + 1] - index[i] > hdr.max_csize)
+            errx(1, "%s: Invalid index", path);
+    }
+    d->index = index;
+
+    if (nslots == 0 || nslots > BLOCK_COMPRESSED_MAX_SLOTS ||
+            nslots > SIZE_MAX / hdr.chunk_size)
+        errx(1, "%s: Invalid cache size of %u chunks", path, nslots);
+    d->nslots = nslots;
+    d->cbuf = malloc(hdr.max_csize ? hdr.max_csize : 1);
+    d->cache = malloc((size_t)nslots * hdr.chunk_size);
+    d->tags = calloc(nslots, sizeof (uint64_t));
+    d->used = calloc(nslots, sizeof (uint64_t));
+    if (d->cbuf == NULL || d->cache == NULL || d->tags == NULL ||
+            d->used == NULL)
+        err(1, "%s: Could not allocate chunk cache", path);
+
+    *capacity_ = hdr.capacity;
+    return d;
+}
+
+static long compressed_pread(int fd, void *buf, size_t len, uint64_t off)
+{
+    return pread(fd, buf, len, off);
+}
+
+int block_compressed_read(struct compress_dev *d, void *buf, size_t len,
+        off_t pos)
+{
+    return compress_read(d, buf, len, pos, compressed_pread);
+}
@@ -27,12 +27,79 @@
 
 #define _GNU_SOURCE
 #define _FILE_OFFSET_BITS 64
+#include <stddef.h>
+#include <stdint.h>
 #include <sys/types.h>
 
+#include "compress_abi.h"
+#include "overlay_abi.h"
+
 /*
  * Attach to the block device specified by (path). Returns the file descriptor
  * and device capacity in * bytes in (*capacity).
  */
 int block_attach(const char *path, off_t *capacity_);
 
+/*
+ * As block_attach(), but attach read-only.
+ */
+int block_attach_ro(const char *path, off_t *capacity_);
+
+/*
+ * Map the block device specified by (path) read-only, returning the address of
+ * the mapping, and the device capacity in bytes in (*capacity). Exits on
+ * failure.
+ */
+const uint8_t *block_attach_map(const char *path, off_t *capacity_);
+
+/*
+ * Attach to the copy-on-write overlay (delta) on top of the read-only image
+ * (base), returning its capacity in bytes in (*capacity). Exits on failure.
+ */
+struct overlay_dev *block_attach_overlay(const char *base, const char *delta,
+        off_t *capacity_);
+
+/*
+ * Create an empty overlay file (delta) for the image (base). Exits on
+ * failure.
+ */
+void block_overlay_create(const char *base, const char *delta);
+
+/*
+ * Read or write (len) bytes at (pos) of the overlay (o). Both (len) and (pos)
+ * must be a multiple of the overlay's block size, and within its capacity.
+ * Returns 0 on success, -1 on failure.
+ */
+int block_overlay_read(struct overlay_dev *o, void *buf, size_t len,
+        off_t pos);
+int block_overlay_write(struct overlay_dev *o, const void *buf, size_t len,
+        off_t pos);
+
+/*
+ * Default number of chunks cached for compressed images.
+ */
+#define BLOCK_COMPRESSED_DEFAULT_SLOTS 16
+
+/*
+ * Maximum number of chunks cached for compressed images. The cache is
+ * searched linearly on each read, and at the largest chunk size this is
+ * already 4 GB.
+ */
+#define BLOCK_COMPRESSED_MAX_SLOTS 4096
+
+/*
+ * Attach to the compressed image (path), with a cache of (nslots) chunks,
+ * returning its uncompressed capacity in bytes in (*capacity). Exits on
+ * failure.
+ */
+struct compress_dev *block_attach_compressed(const char *path,
+        unsigned nslots, off_t *capacity_);
+
+/*
+ * Read (len) bytes at (pos) of the compressed image (d). Returns 0 on
+ * success, -1 on failure.
+ */
+int block_compressed_read(struct compress_dev *d, void *buf, size_t len,
+        off_t pos);
+
 #endif /* COMMON_BLOCK_ATTACH_H */
@@ -19,7 +19,7 @@
  */
 
 /*
- * elf.c: ELF loader.
+ * elf.c: ELF loader, also handling prelinked images (see prelink_abi.h).
  *
  * This module should be kept backend-independent and architectural
  * dependencies should be self-contained.
@@ -39,11 +39,14 @@
 #include <string.h>
 #include <sys/mman.h>
 #include <sys/param.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
 #include <sys/types.h>
 #include <unistd.h>
 
 #include "cc.h"
 #include "elf.h"
+#include "prelink_abi.h"
 
 /*
  * Define EM_TARGET, EM_PAGE_SIZE and EI_DATA_TARGET for the architecture we
@@ -194,9 +197,295 @@ static int align_up(Elf64_Addr addr, Elf64_Xword align, Elf64_Addr *out_result)
         return 1;
 }
 
+/*
+ * Prelinked images are recognised by elf_load(), elf_load_note() and
+ * elf_load_symtab() by their magic, which can never be mistaken for the
+ * start of an ELF header.
+ */
+static bool hdr_is_prelinked(const void *hdr)
+{
+    return memcmp(hdr, PRELINK_MAGIC, PRELINK_MAGIC_SIZE) == 0;
+}
+
+bool elf_is_prelinked(int bin_fd)
+{
+    char magic[PRELINK_MAGIC_SIZE];
+
+    return pread_in_full(bin_fd, magic, sizeof magic, 0) == sizeof magic
+        && hdr_is_prelinked(magic);
+}
+
+static bool prelink_hdr_is_valid(const struct prelink_hdr *hdr,
+        uint64_t file_size)
+{
+    uint64_t temp;
+
+    /*
+     * 1. Validate that this is an image we support, produced for our target
+     * architecture.
+     */
+    if (!hdr_is_prelinked(hdr))
+        return false;
+    if (hdr->version != PRELINK_VERSION)
+        return false;
+    if (hdr->machine != EM_TARGET || hdr->page_size != EM_PAGE_SIZE)
+        return false;
+    /*
+     * 2. Validate that the memory image is page-aligned, lies within (base ..
+     * end), and is present in the file.
+     */
+    if ((hdr->base | hdr->end | hdr->filesz | hdr->image_offset)
+            & (EM_PAGE_SIZE - 1))
+        return false;
+    if (hdr->base >= hdr->end)
+        return false;
+    if (hdr->filesz > hdr->end - hdr->base)
+        return false;
+    if (hdr->entry < hdr->base || hdr->entry >= hdr->end)
+        return false;
+    if (add_overflow(hdr->image_offset, hdr->filesz, temp))
+        return false;
+    if (temp > file_size)
+        return false;
+    /*
+     * 3. Validate that all notes are present in the file.
+     */
+    if (hdr->nnotes > PRELINK_MAX_NOTES)
+        return false;
+    for (uint32_t i = 0; i < hdr->nnotes; i++) {
+        if (add_overflow(hdr->notes[i].offset, hdr->notes[i].size, temp))
+            return false;
+        if (temp > file_size)
+            return false;
+    }
+    /*
+     * 4. Validate that regions are page-aligned, sorted in ascending order,
+     * do not overlap and lie within (base .. end).
+     */
+    if (hdr->nregions < 1 || hdr->nregions > PRELINK_MAX_REGIONS)
+        return false;
+    uint64_t last_end = hdr->base;
+    for (uint32_t i = 0; i < hdr->nregions; i++) {
+        const struct prelink_region *r = &hdr->regions[i];
+
+        if ((r->start | r->end) & (EM_PAGE_SIZE - 1))
+            return false;
+        if (r->start < last_end || r->end <= r->start || r->end > hdr->end)
+            return false;
+        last_end = r->end;
+    }
+
+    return true;
+}
+
+/*
+ * Read and validate the header of the prelinked image (bin_fd) into (*hdr).
+ * Returns 0 on success, -1 and errno set on error, or 1 if the image is
+ * invalid.
+ */
+static int prelink_read_hdr(int bin_fd, struct prelink_hdr *hdr)
+{
+    ssize_t nbytes;
+    struct stat st;
+
+    nbytes = pread_in_full(bin_fd, hdr, sizeof *hdr, 0);
+    if (nbytes < 0)
+        return -1;
+    if (nbytes != sizeof *hdr)
+        return 1;
+    if (fstat(bin_fd, &st) == -1)
+        return -1;
+    if (!prelink_hdr_is_valid(hdr, st.st_size))
+        return 1;
+    return 0;
+}
+
+/*
+ * Map (size) bytes of the prelinked image (bin_fd) at (offset) directly over
+ * host memory at (host_addr). Returns 0 on success, or -1 if the image
+ * cannot be mapped and must be read in instead.
+ */
+static int prelink_map(int bin_fd, uint8_t *host_addr, uint64_t size,
+        uint64_t offset)
+{
+#if defined(__linux__)
+    long host_page_size = sysconf(_SC_PAGESIZE);
+    struct statvfs vfs;
+
+    if (size == 0 || host_page_size <= 0)
+        return -1;
+    /*
+     * The mapping must cover whole host pages, otherwise the tail of the
+     * last page would either clobber guest memory or fault beyond the end
+     * of the file.
+     */
+    if (((uintptr_t)host_addr | size | offset) % host_page_size)
+        return -1;
+    /*
+     * spt runs the guest in the tender's address space, and PROT_EXEC
+     * cannot be applied to a file mapping on a noexec filesystem.
+     */
+    if (fstatvfs(bin_fd, &vfs) == -1 || vfs.f_flag & ST_NOEXEC)
+        return -1;
+    /*
+     * MAP_PRIVATE: pages are populated from the page cache as the guest
+     * touches them, and are shared between instances until written to.
+     */
+    if (mmap(host_addr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+                bin_fd, offset) == MAP_FAILED)
+        return -1;
+    return 0;
+#else
+    (void)bin_fd;
+    (void)host_addr;
+    (void)size;
+    (void)offset;
+    return -1;
+#endif
+}
+
+static void prelink_load(int bin_fd, const char *bin_name, uint8_t *mem,
+        size_t mem_size, uint64_t p_min_loadaddr, bool p_map,
+        guest_mprotect_fn_t t_guest_mprotect, void *t_guest_mprotect_arg,
+        uint64_t *p_entry, uint64_t *p_end)
+{
+    ssize_t nbytes;
+    struct prelink_hdr *hdr = NULL;
+    int rc;
+
+    hdr = malloc(sizeof *hdr);
+    if (hdr == NULL)
+        goto out_error;
+    rc = prelink_read_hdr(bin_fd, hdr);
+    if (rc == -1)
+        goto out_error;
+    if (rc == 1)
+        goto out_invalid;
+    if (hdr->base < p_min_loadaddr || hdr->end > mem_size)
+        goto out_invalid;
+
+    /*
+     * Load the image (base .. base + filesz) into host memory at host_base,
+     * mapping it directly from the file if (p_map) and possible, and ensure
+     * the rest of the image up to (end) is initialised to zero.
+     */
+    uint8_t *host_base = mem + hdr->base;
+    /*
+     * Double check result for host (caller) address space overflow.
+     */
+    assert(host_base >= (mem + p_min_loadaddr));
+    assert((mem + hdr->end) > host_base);
+    if (!p_map || prelink_map(bin_fd, host_base, hdr->filesz,
+                hdr->image_offset) == -1) {
+        nbytes = pread_in_full(bin_fd, host_base, hdr->filesz,
+                hdr->image_offset);
+        if (nbytes < 0)
+            goto out_error;
+        if (nbytes != hdr->filesz)
+            goto out_invalid;
+    }
+    memset(host_base + hdr->filesz, 0, hdr->end - hdr->base - hdr->filesz);
+
+    for (uint32_t i = 0; i < hdr->nregions; i++) {
+        int prot = PROT_NONE;
+        if (hdr->regions[i].prot & PRELINK_PROT_R)
+            prot |= PROT_READ;
+        if (hdr->regions[i].prot & PRELINK_PROT_W)
+            prot |= PROT_WRITE;
+        if (hdr->regions[i].prot & PRELINK_PROT_X)
+            prot |= PROT_EXEC;
+        if (prot & PROT_WRITE && prot & PROT_EXEC) {
+            warnx("%s: Error: region[%u] requests WRITE and EXEC permissions",
+                  bin_name, i);
+            goto out_invalid;
+        }
+        assert(t_guest_mprotect != NULL);
+        if (t_guest_mprotect(t_guest_mprotect_arg, hdr->regions[i].start,
+                    hdr->regions[i].end, prot) == -1)
+            goto out_error;
+    }
+
+    *p_entry = hdr->entry;
+    *p_end = hdr->end;
+    free(hdr);
+    return;
+
+out_error:
+    warn("%s", bin_name);
+    free(hdr);
+    exit(1);
+
+out_invalid:
+    warnx("%s: Invalid or unsupported prelinked image", bin_name);
+    free(hdr);
+    exit(1);
+}
+
+static int prelink_load_note(int bin_fd, const char *bin_name,
+        uint32_t note_type, size_t max_note_size, void **out_note_data,
+        size_t *out_note_size)
+{
+    ssize_t nbytes;
+    struct prelink_hdr *hdr = NULL;
+    uint8_t *note_data = NULL;
+    int rc;
+
+    hdr = malloc(sizeof *hdr);
+    if (hdr == NULL)
+        goto out_error;
+    rc = prelink_read_hdr(bin_fd, hdr);
+    if (rc == -1)
+        goto out_error;
+    if (rc == 1)
+        goto out_invalid;
+
+    /*
+     * Notes are stored without internal alignment, so (note_align) does not
+     * apply here.
+     */
+    uint32_t i;
+    for (i = 0; i < hdr->nnotes; i++) {
+        if (hdr->notes[i].type == note_type)
+            break;
+    }
+    if (i == hdr->nnotes) {
+        free(hdr);
+        return -1;
+    }
+    if (hdr->notes[i].size < 1 || hdr->notes[i].size > max_note_size)
+        goto out_invalid;
+    note_data = malloc(hdr->notes[i].size);
+    if (note_data == NULL)
+        goto out_error;
+    nbytes = pread_in_full(bin_fd, note_data, hdr->notes[i].size,
+            hdr->notes[i].offset);
+    if (nbytes < 0)
+        goto out_error;
+    if (nbytes != hdr->notes[i].size)
+        goto out_invalid;
+
+    *out_note_data = note_data;
+    *out_note_size = hdr->notes[i].size;
+    free(hdr);
+    return 0;
+
+out_error:
+    warn("%s", bin_name);
+    free(hdr);
+    free(note_data);
+    exit(1);
+
+out_invalid:
+    warnx("%s: Invalid or unsupported prelinked image", bin_name);
+    free(hdr);
+    free(note_data);
+    exit(1);
+}
+
 void elf_load(int bin_fd, const char *bin_name, uint8_t *mem, size_t mem_size,
-        uint64_t p_min_loadaddr, guest_mprotect_fn_t t_guest_mprotect,
-        void *t_guest_mprotect_arg, uint64_t *p_entry, uint64_t *p_end)
+        uint64_t p_min_loadaddr, bool p_map,
+        guest_mprotect_fn_t t_guest_mprotect, void *t_guest_mprotect_arg,
+        uint64_t *p_entry, uint64_t *p_end)
 {
     ssize_t nbytes;
     Elf64_Phdr *phdr = NULL;
@@ -212,6 +501,12 @@ void elf_load(int bin_fd, const char *bin_name, uint8_t *mem, size_t mem_size,
         goto out_error;
     if (nbytes != sizeof(Elf64_Ehdr))
         goto out_invalid;
+    if (hdr_is_prelinked(ehdr)) {
+        free(ehdr);
+        prelink_load(bin_fd, bin_name, mem, mem_size, p_min_loadaddr, p_map,
+                t_guest_mprotect, t_guest_mprotect_arg, p_entry, p_end);
+        return;
+    }
     if (!ehdr_is_valid(ehdr))
         goto out_invalid;
     /*
@@ -386,6 +681,11 @@ int elf_load_note(int bin_fd, const char *bin_name, uint32_t note_type,
         goto out_error;
     if (nbytes != sizeof(Elf64_Ehdr))
         goto out_invalid;
+    if (hdr_is_prelinked(ehdr)) {
+        free(ehdr);
+        return prelink_load_note(bin_fd, bin_name, note_type, max_note_size,
+                out_note_data, out_note_size);
+    }
     if (!ehdr_is_valid(ehdr))
         goto out_invalid;
 
@@ -504,3 +804,220 @@ out_invalid:
     free(note_data);
     exit(1);
 }
+
+/*
+ * Upper bound on the size of the symbol and string tables we are prepared to
+ * load, to avoid unbounded allocations on malformed executables.
+ */
+#define ELF_SYMTAB_MAX_SIZE (64 * 1024 * 1024)
+
+static int sym_compare(const void *a, const void *b)
+{
+    const struct elf_sym *sa = a, *sb = b;
+
+    if (sa->addr < sb->addr)
+        return -1;
+    else if (sa->addr > sb->addr)
+        return 1;
+    else
+        return 0;
+}
+
+int elf_load_symtab(int bin_fd, const char *bin_name,
+        struct elf_symtab *out_symtab)
+{
+    ssize_t nbytes;
+    Elf64_Ehdr *ehdr = NULL;
+    Elf64_Shdr *shdr = NULL;
+    Elf64_Sym *syms = NULL;
+    char *strtab = NULL;
+    struct elf_sym *out_syms = NULL;
+    size_t nsyms, out_nsyms;
+
+    ehdr = malloc(sizeof(Elf64_Ehdr));
+    if (ehdr == NULL)
+        goto out_error;
+    nbytes = pread_in_full(bin_fd, ehdr, sizeof(Elf64_Ehdr), 0);
+    if (nbytes < 0)
+        goto out_error;
+    if (nbytes != sizeof(Elf64_Ehdr))
+        goto out_invalid;
+    /*
+     * Prelinked images do not carry a symbol table.
+     */
+    if (hdr_is_prelinked(ehdr))
+        goto out_none;
+    if (!ehdr_is_valid(ehdr))
+        goto out_invalid;
+    /*
+     * An executable without section headers (or using extended section
+     * numbering, which the Solo5 toolchains never produce) is valid, but has
+     * no symbol table we can use.
+     */
+    if (ehdr->e_shoff == 0 || ehdr->e_shnum == 0)
+        goto out_none;
+    if (ehdr->e_shentsize != sizeof (Elf64_Shdr))
+        goto out_invalid;
+
+    size_t sh_size = ehdr->e_shnum * ehdr->e_shentsize;
+    shdr = malloc(sh_size);
+    if (shdr == NULL)
+        goto out_error;
+    nbytes = pread_in_full(bin_fd, shdr, sh_size, ehdr->e_shoff);
+    if (nbytes < 0)
+        goto out_error;
+    if (nbytes != sh_size)
+        goto out_invalid;
+
+    /*
+     * Find the (first) SHT_SYMTAB section and its linked string table.
+     */
+    Elf64_Half sh_i;
+    for (sh_i = 0; sh_i < ehdr->e_shnum; sh_i++) {
+        if (shdr[sh_i].sh_type == SHT_SYMTAB)
+            break;
+    }
+    if (sh_i == ehdr->e_shnum)
+        goto out_none;
+    Elf64_Shdr *sh_sym = &shdr[sh_i];
+    if (sh_sym->sh_entsize != sizeof (Elf64_Sym))
+        goto out_invalid;
+    if (sh_sym->sh_size > ELF_SYMTAB_MAX_SIZE ||
+            sh_sym->sh_size % sizeof (Elf64_Sym) != 0)
+        goto out_invalid;
+    if (sh_sym->sh_link == SHN_UNDEF || sh_sym->sh_link >= ehdr->e_shnum)
+        goto out_invalid;
+    Elf64_Shdr *sh_str = &shdr[sh_sym->sh_link];
+    if (sh_str->sh_type != SHT_STRTAB)
+        goto out_invalid;
+    if (sh_str->sh_size < 1 || sh_str->sh_size > ELF_SYMTAB_MAX_SIZE)
+        goto out_invalid;
+
+    nsyms = sh_sym->sh_size / sizeof (Elf64_Sym);
+    syms = malloc(sh_sym->sh_size);
+    if (syms == NULL)
+        goto out_error;
+    nbytes = pread_in_full(bin_fd, syms, sh_sym->sh_size, sh_sym->sh_offset);
+    if (nbytes < 0)
+        goto out_error;
+    if (nbytes != sh_sym->sh_size)
+        goto out_invalid;
+    strtab = malloc(sh_str->sh_size);
+    if (strtab == NULL)
+        goto out_error;
+    nbytes = pread_in_full(bin_fd, strtab, sh_str->sh_size,
+            sh_str->sh_offset);
+    if (nbytes < 0)
+        goto out_error;
+    if (nbytes != sh_str->sh_size)
+        goto out_invalid;
+    /*
+     * Guarantee that all names are terminated, regardless of what the
+     * executable contains.
+     */
+    strtab[sh_str->sh_size - 1] = '\0';
+
+    /*
+     * Keep only defined function symbols (and untyped symbols, which is what
+     * assembly labels such as _start end up as) with a non-empty name.
+     */
+    out_syms = calloc(nsyms ? nsyms : 1, sizeof (struct elf_sym));
+    if (out_syms == NULL)
+        goto out_error;
+    out_nsyms = 0;
+    for (size_t i = 0; i < nsyms; i++) {
+        unsigned char type = ELF64_ST_TYPE(syms[i].st_info);
+
+        if (type != STT_FUNC && type != STT_NOTYPE)
+            continue;
+        if (syms[i].st_shndx == SHN_UNDEF || syms[i].st_shndx == SHN_ABS)
+            continue;
+        if (syms[i].st_name == 0 || syms[i].st_name >= sh_str->sh_size)
+            continue;
+        /*
+         * Skip mapping symbols ($x, $d, ...) emitted on some architectures.
+         */
+        if (strtab[syms[i].st_name] == '\0' ||
+                strtab[syms[i].st_name] == '$')
+            continue;
+        out_syms[out_nsyms].addr = syms[i].st_value;
+        out_syms[out_nsyms].size = syms[i].st_size;
+        out_syms[out_nsyms].name = strtab + syms[i].st_name;
+        out_nsyms++;
+    }
+    if (out_nsyms == 0)
+        goto out_none;
+    qsort(out_syms, out_nsyms, sizeof (struct elf_sym), sym_compare);
+
+    out_symtab->syms = out_syms;
+    out_symtab->nsyms = out_nsyms;
+    out_symtab->strtab = strtab;
+    free(ehdr);
+    free(shdr);
+    free(syms);
+    return 0;
+
+out_none:
+    free(ehdr);
+    free(shdr);
+    free(syms);
+    free(strtab);
+    free(out_syms);
+    return -1;
+
+out_error:
+    warn("%s", bin_name);
+    free(ehdr);
+    free(shdr);
+    free(syms);
+    free(strtab);
+    free(out_syms);
+    exit(1);
+
+out_invalid:
+    warnx("%s: Invalid or unsupported executable", bin_name);
+    free(ehdr);
+    free(shdr);
+    free(syms);
+    free(strtab);
+    free(out_syms);
+    exit(1);
+}
+
+const struct elf_sym *elf_symtab_lookup(const struct elf_symtab *symtab,
+        uint64_t addr)
+{
+    size_t lo = 0, hi = symtab->nsyms;
+
+    /*
+     * Find the last symbol with an address <= (addr).
+     */
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (symtab->syms[mid].addr <= addr)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == 0)
+        return NULL;
+
+    const struct elf_sym *sym = &symtab->syms[lo - 1];
+    /*
+     * Symbols with a known size must contain (addr). Symbols of unknown size
+     * (typically assembly labels) are assumed to extend to the next symbol.
+     */
+    if (sym->size != 0 && addr - sym->addr >= sym->size)
+        return NULL;
+    return sym;
+}
+
+void elf_symtab_free(struct elf_symtab *symtab)
+{
+    free(symtab->syms);
+    free(symtab->strtab);
+    symtab->syms = NULL;
+    symtab->strtab = NULL;
+    symtab->nsyms = 0;
+}
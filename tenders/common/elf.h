@@ -25,6 +25,8 @@
 #ifndef COMMON_ELF_H
 #define COMMON_ELF_H
 
+#include <stdbool.h>
+
 /*
  * guest_mprotect_fn() is called by the ELF loader to request that the page
  * protection flags (prot) as used by the system mprotect(), i.e. PROT_X from
@@ -36,6 +38,13 @@
 typedef int (*guest_mprotect_fn_t)(void *t_arg, uint64_t addr_start,
         uint64_t addr_end, int prot);
 
+/*
+ * Returns true if (bin_fd) is a prelinked image produced by "solo5-elftool
+ * prelink" rather than an ELF binary. elf_load(), elf_load_note() and
+ * elf_load_symtab() accept either.
+ */
+bool elf_is_prelinked(int bin_fd);
+
 /*
  * Load an ELF binary from (bin_fd) into (mem_size) bytes of memory at (*mem).
  * (p_min_loadaddr) is the lowest allowed load address within (*mem). (bin_name)
@@ -46,12 +55,18 @@ typedef int (*guest_mprotect_fn_t)(void *t_arg, uint64_t addr_start,
  * If successful, returns the entry point (*p_entry) and last address used by
  * the binary (*p_end).
  *
+ * If (p_map) is true, a prelinked image is mapped directly from (bin_fd) where
+ * the host supports it, in which case (mem .. mem + *p_end) is partially
+ * replaced by a private file mapping. Callers which have applied a memory
+ * policy to (mem) must pass false, as the mapping would not inherit it.
+ *
  * If the executable is invalid, or on any other error, reports to stderr and
  * terminates the program.
  */
 void elf_load(int bin_fd, const char *bin_name, uint8_t *mem, size_t mem_size,
-        uint64_t p_min_loadaddr, guest_mprotect_fn_t t_guest_mprotect,
-        void *t_guest_mprotect_arg, uint64_t *p_entry, uint64_t *p_end);
+        uint64_t p_min_loadaddr, bool p_map,
+        guest_mprotect_fn_t t_guest_mprotect, void *t_guest_mprotect_arg,
+        uint64_t *p_entry, uint64_t *p_end);
 
 /*
  * Load the Solo5-owned NOTE of (note_type) from the ELF binary (file).
@@ -80,4 +95,50 @@ int elf_load_note(int bin_fd, const char *bin_name, uint32_t note_type,
         size_t note_align, size_t max_note_size, void **note_data,
         size_t *note_size);
 
+/*
+ * A function symbol from the ELF symbol table, as loaded by elf_load_symtab().
+ * A (size) of 0 means the size of the symbol is not known.
+ */
+struct elf_sym {
+    uint64_t addr;
+    uint64_t size;
+    const char *name;
+};
+
+/*
+ * Symbol table of an ELF binary, sorted by ascending (addr).
+ */
+struct elf_symtab {
+    struct elf_sym *syms;
+    size_t nsyms;
+    char *strtab;
+};
+
+/*
+ * Load the function symbols from the symbol table (.symtab) of the ELF binary
+ * (bin_fd) into (*symtab). (bin_name) is the file name of the binary and is
+ * used to report errors.
+ *
+ * Returns 0 on success. Memory for the symbol table is allocated with
+ * malloc(), and should be released with elf_symtab_free().
+ *
+ * If the executable is valid but does not contain any function symbols (e.g.
+ * it has been stripped, or is a prelinked image), returns -1.
+ *
+ * In all other cases, reports any errors to stderr and terminates the program.
+ */
+int elf_load_symtab(int bin_fd, const char *bin_name,
+        struct elf_symtab *symtab);
+
+/*
+ * Look up the symbol containing (addr) in (symtab). Returns NULL if not found.
+ */
+const struct elf_sym *elf_symtab_lookup(const struct elf_symtab *symtab,
+        uint64_t addr);
+
+/*
+ * Release memory allocated by elf_load_symtab().
+ */
+void elf_symtab_free(struct elf_symtab *symtab);
+
 #endif /* COMMON_ELF_H */
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * net_capture.c: Common functions for capturing network traffic to pcapng
+ * files.
+ */
+
+#define _GNU_SOURCE
+#include <assert.h>
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "net_capture.h"
+
+/*
+ * pcapng block types and options, see
+ * https://datatracker.ietf.org/doc/draft-ietf-opsawg-pcapng/.
+ */
+#define PCAPNG_SHB          0x0a0d0d0a
+#define PCAPNG_IDB          0x00000001
+#define PCAPNG_ISB          0x00000005
+#define PCAPNG_EPB          0x00000006
+#define PCAPNG_BOM          0x1a2b3c4d
+#define PCAPNG_LINKTYPE_ETHERNET 1
+#define PCAPNG_OPT_END      0
+#define PCAPNG_OPT_IF_NAME  2
+#define PCAPNG_OPT_IF_TSRESOL 9
+#define PCAPNG_OPT_EPB_FLAGS 2
+#define PCAPNG_OPT_ISB_IFDROP 5
+
+/*
+ * Size of the output buffer; must hold the largest enhanced packet block.
+ */
+#define CAPTURE_BUF_SIZE (256 * 1024)
+#define CAPTURE_MAX_SNAPLEN (128 * 1024)
+#define CAPTURE_MAX_SLOTS (1024 * 1024)
+#define CAPTURE_POLL_NS 10000000
+
+int net_capture_parse(const char *spec, char **path, uint32_t *snaplen,
+        uint32_t *nslots)
+{
+    char *s = strdup(spec);
+    if (s == NULL)
+        err(1, "strdup");
+
+    *snaplen = 0;
+    *nslots = NET_CAPTURE_DEFAULT_SLOTS;
+    char *p = strchr(s, ',');
+    if (p != NULL) {
+        *p++ = '\0';
+        char *end;
+        unsigned long v = strtoul(p, &end, 10);
+        if (end == p || v == 0 || v > CAPTURE_MAX_SNAPLEN ||
+                (*end != '\0' && *end != ','))
+            goto invalid;
+        *snaplen = v;
+        if (*end == ',') {
+            p = end + 1;
+            v = strtoul(p, &end, 10);
+            if (end == p || v == 0 || v > CAPTURE_MAX_SLOTS || *end != '\0')
+                goto invalid;
+            *nslots = v;
+        }
+    }
+    if (s[0] == '\0')
+        goto invalid;
+    *path = s;
+    return 0;
+
+invalid:
+    warnx("Invalid capture specification: '%s'", spec);
+    free(s);
+    return -1;
+}
+
+static void buf_put(struct net_capture *c, const void *data, size_t len)
+{
+    if (len == 0)
+        return;
+    assert(c->buf_len + len <= CAPTURE_BUF_SIZE);
+    memcpy(c->buf + c->buf_len, data, len);
+    c->buf_len += len;
+}
+
+static void buf_put32(struct net_capture *c, uint32_t v)
+{
+    buf_put(c, &v, sizeof v);
+}
+
+static void buf_pad(struct net_capture *c)
+{
+    static const uint8_t zero[4];
+    buf_put(c, zero, (4 - (c->buf_len % 4)) % 4);
+}
+
+/*
+ * Write out the output buffer. Errors are ignored, there is nothing the
+ * capture helper can do about them.
+ */
+static void buf_flush(struct net_capture *c)
+{
+    size_t off = 0;
+
+    while (off < c->buf_len) {
+        ssize_t n = write(c->fd, c->buf + off, c->buf_len - off);
+        if (n == -1 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+        off += n;
+    }
+    c->buf_len = 0;
+}
+
+/*
+ * Block lengths are patched in once the block is complete.
+ */
+static size_t block_start(struct net_capture *c, uint32_t type)
+{
+    size_t start = c->buf_len;
+
+    buf_put32(c, type);
+    buf_put32(c, 0);
+    return start;
+}
+
+static void block_end(struct net_capture *c, size_t start)
+{
+    uint32_t len = c->buf_len - start + sizeof (uint32_t);
+
+    memcpy(c->buf + start + sizeof (uint32_t), &len, sizeof len);
+    buf_put32(c, len);
+}
+
+static void put_option(struct net_capture *c, uint16_t code,
+        const void *data, uint16_t len)
+{
+    buf_put(c, &code, sizeof code);
+    buf_put(c, &len, sizeof len);
+    buf_put(c, data, len);
+    buf_pad(c);
+}
+
+/*
+ * Write out the frame in slot (s). On spt the ring is writable by the guest at
+ * any time, so the header of the slot is read exactly once, and the captured
+ * length is checked against the snapshot length owned by the helper.
+ */
+static void put_epb(struct net_capture *c, struct capture_slot *s)
+{
+    uint64_t ts_ns = __atomic_load_n(&s->ts_ns, __ATOMIC_RELAXED);
+    uint32_t len = __atomic_load_n(&s->len, __ATOMIC_RELAXED);
+    uint32_t caplen = __atomic_load_n(&s->caplen, __ATOMIC_RELAXED);
+    uint32_t dir = __atomic_load_n(&s->dir, __ATOMIC_RELAXED);
+
+    if (caplen > c->snaplen || caplen > len)
+        return;
+    if (c->buf_len + 64 + caplen > CAPTURE_BUF_SIZE)
+        buf_flush(c);
+
+    size_t start = block_start(c, PCAPNG_EPB);
+    buf_put32(c, 0); /* Interface ID */
+    buf_put32(c, (uint32_t)(ts_ns >> 32));
+    buf_put32(c, (uint32_t)ts_ns);
+    buf_put32(c, caplen);
+    buf_put32(c, len);
+    buf_put(c, s->data, caplen);
+    buf_pad(c);
+    uint32_t flags = (dir == CAPTURE_DIR_IN) ? 1 : 2;
+    put_option(c, PCAPNG_OPT_EPB_FLAGS, &flags, sizeof flags);
+    put_option(c, PCAPNG_OPT_END, NULL, 0);
+    block_end(c, start);
+}
+
+static uint64_t wall_clock_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void sleep_ns(uint64_t ns)
+{
+    struct timespec ts = {
+        .tv_sec = ns / 1000000000ULL,
+        .tv_nsec = ns % 1000000000ULL
+    };
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, &ts) == EINTR)
+        ;
+}
+
+/*
+ * Returns the slot for sequence number (seq), using the ring geometry owned by
+ * the helper rather than that in the ring header, which on spt the guest can
+ * modify.
+ */
+static struct capture_slot *helper_slot(struct net_capture *c, uint64_t seq)
+{
+    return (struct capture_slot *)
+        &c->ring->slots[(size_t)(seq % c->nslots) * c->slot_size];
+}
+
+/*
+ * The capture helper, running in a process forked from the tender before the
+ * guest is started. It only reads the shared ring, and exits once asked to
+ * stop or once the tender has exited, after writing out all remaining frames.
+ */
+static void capture_helper(struct net_capture *c, pid_t parent)
+{
+    struct capture_ring *r = c->ring;
+    uint64_t tail = 0;
+
+    /*
+     * Leave it to the tender to handle ^C and friends; we will notice once it
+     * has exited.
+     */
+    signal(SIGINT, SIG_IGN);
+    signal(SIGTERM, SIG_IGN);
+    signal(SIGHUP, SIG_IGN);
+
+    for (;;) {
+        bool stop = __atomic_load_n(&r->stop, __ATOMIC_ACQUIRE) ||
+            getppid() != parent;
+        for (;;) {
+            struct capture_slot *s = helper_slot(c, tail);
+            if (__atomic_load_n(&s->seq, __ATOMIC_ACQUIRE) != tail + 1)
+                break;
+            put_epb(c, s);
+            tail++;
+            __atomic_store_n(&r->tail, tail, __ATOMIC_RELEASE);
+        }
+        if (stop)
+            break;
+        buf_flush(c);
+        sleep_ns(CAPTURE_POLL_NS);
+    }
+
+    uint64_t ts_ns = wall_clock_ns();
+    uint64_t dropped = __atomic_load_n(&r->dropped, __ATOMIC_RELAXED);
+    size_t start = block_start(c, PCAPNG_ISB);
+    buf_put32(c, 0); /* Interface ID */
+    buf_put32(c, (uint32_t)(ts_ns >> 32));
+    buf_put32(c, (uint32_t)ts_ns);
+    put_option(c, PCAPNG_OPT_ISB_IFDROP, &dropped, sizeof dropped);
+    put_option(c, PCAPNG_OPT_END, NULL, 0);
+    block_end(c, start);
+    buf_flush(c);
+    __atomic_store_n(&r->stopped, 1, __ATOMIC_RELEASE);
+}
+
+struct net_capture *net_capture_open(const char *path, const char *name,
+        uint32_t snaplen, uint32_t nslots)
+{
+    struct net_capture *c = calloc(1, sizeof *c);
+    if (c == NULL)
+        err(1, "calloc");
+    c->path = strdup(path);
+    if (c->path == NULL)
+        err(1, "strdup");
+    c->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (c->fd == -1)
+        err(1, "%s: Could not open %s", name, path);
+    c->buf = malloc(CAPTURE_BUF_SIZE);
+    if (c->buf == NULL)
+        err(1, "malloc");
+
+    /*
+     * The ring is shared with the capture helper. Its geometry is also kept
+     * in (c), which the helper uses instead of the ring header.
+     */
+    c->nslots = nslots;
+    c->snaplen = snaplen;
+    c->slot_size = (sizeof (struct capture_slot) + snaplen + 7) & ~7U;
+    size_t ring_size = sizeof (struct capture_ring) +
+        (size_t)nslots * c->slot_size;
+    c->ring = mmap(NULL, ring_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (c->ring == MAP_FAILED)
+        err(1, "%s: Could not allocate capture ring", name);
+    c->ring->nslots = nslots;
+    c->ring->snaplen = snaplen;
+    c->ring->slot_size = c->slot_size;
+
+    size_t start = block_start(c, PCAPNG_SHB);
+    buf_put32(c, PCAPNG_BOM);
+    uint16_t version[2] = { 1, 0 };
+    buf_put(c, version, sizeof version);
+    int64_t section_len = -1;
+    buf_put(c, &section_len, sizeof section_len);
+    block_end(c, start);
+
+    start = block_start(c, PCAPNG_IDB);
+    uint16_t linktype[2] = { PCAPNG_LINKTYPE_ETHERNET, 0 };
+    buf_put(c, linktype, sizeof linktype);
+    buf_put32(c, snaplen);
+    put_option(c, PCAPNG_OPT_IF_NAME, name, strlen(name));
+    uint8_t tsresol = 9; /* Nanoseconds */
+    put_option(c, PCAPNG_OPT_IF_TSRESOL, &tsresol, sizeof tsresol);
+    put_option(c, PCAPNG_OPT_END, NULL, 0);
+    block_end(c, start);
+    buf_flush(c);
+
+    /*
+     * Write out the file from a separate process, so that on spt, where the
+     * guest shares our address space, the guest is never able to write to the
+     * file itself.
+     */
+    pid_t parent = getpid();
+    c->pid = fork();
+    if (c->pid == -1)
+        err(1, "%s: Could not start capture helper", name);
+    if (c->pid == 0) {
+        capture_helper(c, parent);
+        _exit(0);
+    }
+    close(c->fd);
+    c->fd = -1;
+    return c;
+}
+
+void net_capture_put(struct net_capture *c, uint32_t dir, const uint8_t *data,
+        size_t len)
+{
+    capture_ring_put(c->ring, dir, wall_clock_ns(), data, len);
+}
+
+void net_capture_stop(struct net_capture *c, const char *name)
+{
+    struct capture_ring *r = c->ring;
+
+    __atomic_store_n(&r->stop, 1, __ATOMIC_RELEASE);
+    for (int i = 0; i != 1000; i++) {
+        if (__atomic_load_n(&r->stopped, __ATOMIC_ACQUIRE))
+            break;
+        sleep_ns(1000000);
+    }
+    warnx("%s: Captured %" PRIu64 " frames to %s, %" PRIu64 " dropped",
+            name, __atomic_load_n(&r->tail, __ATOMIC_RELAXED), c->path,
+            __atomic_load_n(&r->dropped, __ATOMIC_RELAXED));
+    waitpid(c->pid, NULL, WNOHANG);
+}
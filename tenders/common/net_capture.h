@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * net_capture.h: Common functions for capturing network traffic to pcapng
+ * files.
+ */
+
+#ifndef COMMON_NET_CAPTURE_H
+#define COMMON_NET_CAPTURE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "capture_abi.h"
+
+#define NET_CAPTURE_DEFAULT_SLOTS 1024
+
+struct net_capture {
+    struct capture_ring *ring;
+    /*
+     * Ring geometry, as used by the capture helper.
+     */
+    uint32_t nslots;
+    uint32_t snaplen;
+    uint32_t slot_size;
+    int fd;
+    char *path;
+    pid_t pid;
+    size_t buf_len;
+    uint8_t *buf;
+};
+
+/*
+ * Parse the capture specification (spec) of the form "FILE[,SNAPLEN
+ * [,RINGSIZE]]". (*snaplen) is set to 0 if not specified. Returns -1 and
+ * prints a warning on failure.
+ */
+int net_capture_parse(const char *spec, char **path, uint32_t *snaplen,
+        uint32_t *nslots);
+
+/*
+ * Create the pcapng file (path) for the network device (name), and fork a
+ * helper process writing out frames captured into a shared ring of (nslots)
+ * frames of up to (snaplen) bytes. Only the helper keeps the file open. The
+ * helper exits once asked to by net_capture_stop() or by setting (stop) in
+ * the ring, or once the calling process has exited. Exits on failure.
+ */
+struct net_capture *net_capture_open(const char *path, const char *name,
+        uint32_t snaplen, uint32_t nslots);
+
+/*
+ * Capture the frame (data, len) travelling in direction (dir). Never blocks.
+ */
+void net_capture_put(struct net_capture *c, uint32_t dir, const uint8_t *data,
+        size_t len);
+
+/*
+ * Ask the capture helper of (c) to write out all remaining frames, wait for
+ * it to do so, and print statistics for the network device (name).
+ */
+void net_capture_stop(struct net_capture *c, const char *name);
+
+#endif /* COMMON_NET_CAPTURE_H */
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * placement.c: Common functions for CPU and NUMA placement of the tender.
+ */
+
+#define _GNU_SOURCE
+#include <err.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "placement.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#endif
+
+void placement_init(struct placement *pl)
+{
+    memset(pl, 0, sizeof *pl);
+    pl->node = -1;
+}
+
+bool placement_enabled(const struct placement *pl)
+{
+    return pl->have_cpus || pl->node != -1 || pl->prefault;
+}
+
+bool placement_mem_enabled(const struct placement *pl)
+{
+    return pl->node != -1 || pl->prefault;
+}
+
+static int parse_uint(const char **p, unsigned max, unsigned *value)
+{
+    char *end;
+
+    errno = 0;
+    unsigned long v = strtoul(*p, &end, 10);
+    if (errno != 0 || end == *p || **p == '-' || **p == '+' || v >= max)
+        return -1;
+    *value = v;
+    *p = end;
+    return 0;
+}
+
+int placement_parse_cpus(struct placement *pl, const char *list)
+{
+    const char *p = list;
+
+    memset(pl->cpus, 0, sizeof pl->cpus);
+    do {
+        unsigned first, last;
+        if (parse_uint(&p, PLACEMENT_MAX_CPUS, &first) == -1)
+            goto invalid;
+        last = first;
+        if (*p == '-') {
+            p++;
+            if (parse_uint(&p, PLACEMENT_MAX_CPUS, &last) == -1 ||
+                    last < first)
+                goto invalid;
+        }
+        for (unsigned cpu = first; cpu <= last; cpu++)
+            pl->cpus[cpu / 64] |= 1ULL << (cpu % 64);
+        if (*p != ',' && *p != '\0')
+            goto invalid;
+    } while (*p++ == ',');
+
+    pl->have_cpus = true;
+    return 0;
+
+invalid:
+    warnx("Invalid CPU list: '%s'", list);
+    return -1;
+}
+
+int placement_parse_node(struct placement *pl, const char *spec)
+{
+    const char *p = spec;
+    unsigned node;
+
+    if (parse_uint(&p, PLACEMENT_MAX_NODES, &node) == -1 || *p != '\0') {
+        warnx("Invalid NUMA node: '%s'", spec);
+        return -1;
+    }
+    pl->node = node;
+    return 0;
+}
+
+#if defined(__linux__)
+
+/*
+ * Format the CPU bitmap (cpus) as a list of CPU numbers and ranges.
+ */
+static void format_cpus(char *buf, size_t size, const uint64_t *cpus)
+{
+    size_t len = 0;
+
+    buf[0] = '\0';
+    for (unsigned cpu = 0; cpu < PLACEMENT_MAX_CPUS; cpu++) {
+        if (!(cpus[cpu / 64] & (1ULL << (cpu % 64))))
+            continue;
+        unsigned last = cpu;
+        while (last + 1 < PLACEMENT_MAX_CPUS &&
+                (cpus[(last + 1) / 64] & (1ULL << ((last + 1) % 64))))
+            last++;
+        int rc;
+        if (last == cpu)
+            rc = snprintf(buf + len, size - len, "%s%u", len ? "," : "", cpu);
+        else
+            rc = snprintf(buf + len, size - len, "%s%u-%u", len ? "," : "",
+                    cpu, last);
+        if (rc < 0 || (size_t)rc >= size - len)
+            return;
+        len += rc;
+        cpu = last;
+    }
+}
+
+void placement_apply_cpus(const struct placement *pl)
+{
+    if (!pl->have_cpus)
+        return;
+
+    cpu_set_t *set = CPU_ALLOC(PLACEMENT_MAX_CPUS);
+    size_t set_size = CPU_ALLOC_SIZE(PLACEMENT_MAX_CPUS);
+    if (set == NULL)
+        err(1, "CPU_ALLOC() failed");
+    CPU_ZERO_S(set_size, set);
+    for (unsigned cpu = 0; cpu < PLACEMENT_MAX_CPUS; cpu++)
+        if (pl->cpus[cpu / 64] & (1ULL << (cpu % 64)))
+            CPU_SET_S(cpu, set_size, set);
+    if (sched_setaffinity(0, set_size, set) == -1)
+        err(1, "Could not set CPU affinity");
+    CPU_FREE(set);
+}
+
+void placement_apply_mem(const struct placement *pl, void *mem, size_t size)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+
+    if (pl->node != -1) {
+        unsigned long nodemask[PLACEMENT_MAX_NODES / (8 * sizeof(long))] = { 0 };
+        nodemask[pl->node / (8 * sizeof(long))] |=
+            1UL << (pl->node % (8 * sizeof(long)));
+        /*
+         * MPOL_MF_STRICT fails if any pages in the range are already
+         * allocated elsewhere, which would mean we are too late.
+         */
+        if (syscall(SYS_mbind, mem, size, MPOL_BIND, nodemask,
+                    PLACEMENT_MAX_NODES + 1, MPOL_MF_STRICT) == -1)
+            err(1, "Could not bind guest memory to NUMA node %d", pl->node);
+    }
+
+    if (pl->prefault) {
+        /*
+         * Guest memory is zero-filled, writing zeroes forces allocation
+         * without changing its contents.
+         */
+        for (size_t off = 0; off < size; off += page_size)
+            ((volatile uint8_t *)mem)[off] = 0;
+    }
+}
+
+/*
+ * Count the pages of (mem, size) resident on each NUMA node into (counts).
+ * Returns -1 if this is not possible.
+ */
+static int count_node_pages(void *mem, size_t size, size_t *counts)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+    size_t npages = size / page_size;
+    enum { CHUNK = 1024 };
+    void *pages[CHUNK];
+    int status[CHUNK];
+
+    for (size_t i = 0; i < npages; i += CHUNK) {
+        size_t n = (npages - i < CHUNK) ? npages - i : CHUNK;
+        for (size_t j = 0; j < n; j++)
+            pages[j] = (uint8_t *)mem + (i + j) * page_size;
+        if (syscall(SYS_move_pages, 0, n, pages, NULL, status, 0) == -1)
+            return -1;
+        for (size_t j = 0; j < n; j++)
+            if (status[j] >= 0 && status[j] < PLACEMENT_MAX_NODES)
+                counts[status[j]]++;
+    }
+    return 0;
+}
+
+void placement_report(const struct placement *pl, void *mem, size_t size)
+{
+    char cpus[256] = "all";
+
+    cpu_set_t *set = CPU_ALLOC(PLACEMENT_MAX_CPUS);
+    size_t set_size = CPU_ALLOC_SIZE(PLACEMENT_MAX_CPUS);
+    if (set != NULL && sched_getaffinity(0, set_size, set) == 0) {
+        uint64_t bitmap[PLACEMENT_MAX_CPUS / 64] = { 0 };
+        for (unsigned cpu = 0; cpu < PLACEMENT_MAX_CPUS; cpu++)
+            if (CPU_ISSET_S(cpu, set_size, set))
+                bitmap[cpu / 64] |= 1ULL << (cpu % 64);
+        format_cpus(cpus, sizeof cpus, bitmap);
+    }
+    CPU_FREE(set);
+    warnx("Placement: CPUs %s", cpus);
+
+    if (pl->node != -1)
+        warnx("Placement: guest memory bound to NUMA node %d", pl->node);
+    if (!pl->prefault)
+        return;
+
+    size_t *counts = calloc(PLACEMENT_MAX_NODES, sizeof (size_t));
+    if (counts == NULL)
+        err(1, "malloc");
+    if (count_node_pages(mem, size, counts) == 0) {
+        for (unsigned node = 0; node < PLACEMENT_MAX_NODES; node++)
+            if (counts[node])
+                warnx("Placement: %zu MB of guest memory on NUMA node %u",
+                        (counts[node] * sysconf(_SC_PAGESIZE)) >> 20, node);
+    }
+    free(counts);
+}
+
+#else /* !__linux__ */
+
+void placement_apply_cpus(const struct placement *pl)
+{
+    if (pl->have_cpus)
+        errx(1, "--cpu is not supported on this host");
+}
+
+void placement_apply_mem(const struct placement *pl, void *mem, size_t size)
+{
+    if (pl->node != -1)
+        errx(1, "--numa-node is not supported on this host");
+    if (pl->prefault) {
+        long page_size = sysconf(_SC_PAGESIZE);
+        for (size_t off = 0; off < size; off += page_size)
+            ((volatile uint8_t *)mem)[off] = 0;
+    }
+}
+
+void placement_report(const struct placement *pl, void *mem, size_t size)
+{
+    (void)pl;
+    (void)mem;
+    (void)size;
+}
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * placement.h: Common functions for CPU and NUMA placement of the tender.
+ */
+
+#ifndef COMMON_PLACEMENT_H
+#define COMMON_PLACEMENT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PLACEMENT_MAX_CPUS  1024
+#define PLACEMENT_MAX_NODES 1024
+
+struct placement {
+    bool have_cpus;
+    uint64_t cpus[PLACEMENT_MAX_CPUS / 64];
+    int node;                   /* -1 if not set */
+    bool prefault;
+};
+
+/*
+ * Initialise (pl) to "no placement requested".
+ */
+void placement_init(struct placement *pl);
+
+/*
+ * Returns true if any placement was requested in (pl).
+ */
+bool placement_enabled(const struct placement *pl);
+
+/*
+ * Returns true if placement of guest memory (--numa-node or --mem-prefault)
+ * was requested in (pl).
+ */
+bool placement_mem_enabled(const struct placement *pl);
+
+/*
+ * Parse the CPU list (list) into (pl). (list) is a comma-separated list of
+ * CPU numbers and ranges, e.g. "0,2-3". Returns -1 and prints a warning on
+ * failure.
+ */
+int placement_parse_cpus(struct placement *pl, const char *list);
+
+/*
+ * Parse the NUMA node number (spec) into (pl). Returns -1 and prints a
+ * warning on failure.
+ */
+int placement_parse_node(struct placement *pl, const char *spec);
+
+/*
+ * Restrict the calling thread to the CPUs in (pl), if any. Threads created
+ * afterwards inherit the restriction, so this must be called before any I/O
+ * threads are started.
+ *
+ * On failure, reports to stderr and terminates the program.
+ */
+void placement_apply_cpus(const struct placement *pl);
+
+/*
+ * Bind the guest memory at (mem, size) to the NUMA node in (pl), if any, and
+ * prefault it if requested. Must be called before the memory is first
+ * touched, as pages already allocated are not migrated.
+ *
+ * On failure, reports to stderr and terminates the program.
+ */
+void placement_apply_mem(const struct placement *pl, void *mem, size_t size);
+
+/*
+ * Print the effective CPU affinity of the calling thread, and the memory
+ * policy and (if prefaulted) the NUMA nodes backing (mem, size).
+ */
+void placement_report(const struct placement *pl, void *mem, size_t size);
+
+#endif /* COMMON_PLACEMENT_H */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * rate_limit.c: Common functions for per-device rate limiting.
+ */
+
+#define _GNU_SOURCE
+#include <err.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rate_limit.h"
+
+int rate_limit_parse(struct rate_limit *rl, const char *spec)
+{
+    uint64_t bytes_burst = 0, ops_burst = 0;
+    const char *p = spec;
+
+    memset(rl, 0, sizeof *rl);
+    while (*p != '\0') {
+        uint64_t *value;
+        if (strncmp(p, "bytes=", 6) == 0)
+            value = &rl->bytes.rate, p += 6;
+        else if (strncmp(p, "ops=", 4) == 0)
+            value = &rl->ops.rate, p += 4;
+        else if (strncmp(p, "bytes-burst=", 12) == 0)
+            value = &bytes_burst, p += 12;
+        else if (strncmp(p, "ops-burst=", 10) == 0)
+            value = &ops_burst, p += 10;
+        else
+            goto invalid;
+
+        char *end;
+        errno = 0;
+        unsigned long long v = strtoull(p, &end, 10);
+        if (errno != 0 || end == p || v == 0 || v > UINT32_MAX ||
+                (*end != '\0' && *end != ','))
+            goto invalid;
+        *value = v;
+        p = (*end == ',') ? end + 1 : end;
+    }
+    if (!rate_limit_enabled(rl))
+        goto invalid;
+
+    rl->bytes.burst = bytes_burst ? bytes_burst : (rl->bytes.rate + 9) / 10;
+    rl->ops.burst = ops_burst ? ops_burst : (rl->ops.rate + 9) / 10;
+    return 0;
+
+invalid:
+    warnx("Invalid rate limit: '%s'", spec);
+    return -1;
+}
+
+uint64_t rate_limit_clock(void)
+{
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == -1)
+        err(1, "clock_gettime() failed");
+    return (uint64_t)ts.tv_sec * RATE_NSEC_PER_SEC + ts.tv_nsec;
+}
+
+void rate_limit_sleep(uint64_t wait_ns)
+{
+    struct timespec ts = {
+        .tv_sec = wait_ns / RATE_NSEC_PER_SEC,
+        .tv_nsec = wait_ns % RATE_NSEC_PER_SEC
+    };
+
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR)
+        ;
+}
+
+void rate_limit_report(const char *name, struct rate_limit *rl)
+{
+    if (rl->throttled_since != 0) {
+        rl->throttled_ns += rate_limit_clock() - rl->throttled_since;
+        rl->throttled_since = 0;
+    }
+    warnx("%s: throttled %" PRIu64 " times for %" PRIu64 ".%03" PRIu64 " s",
+            name, rl->throttled, rl->throttled_ns / RATE_NSEC_PER_SEC,
+            (rl->throttled_ns % RATE_NSEC_PER_SEC) / 1000000);
+}
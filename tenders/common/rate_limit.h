@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * rate_limit.h: Common functions for per-device rate limiting.
+ */
+
+#ifndef COMMON_RATE_LIMIT_H
+#define COMMON_RATE_LIMIT_H
+
+#include <stdint.h>
+
+#include "rate_abi.h"
+
+/*
+ * Parse the rate limit specification (spec) into (rl). (spec) is a
+ * comma-separated list of "bytes=N" and "ops=N" (per second), and
+ * "bytes-burst=N" and "ops-burst=N". Bursts default to a tenth of a second
+ * at the configured rate. Returns -1 and prints a warning on failure.
+ */
+int rate_limit_parse(struct rate_limit *rl, const char *spec);
+
+/*
+ * Returns the current time in nanoseconds, as used by rate_limit_take().
+ */
+uint64_t rate_limit_clock(void);
+
+/*
+ * Sleep for (wait_ns), as returned by rate_limit_wait_ns().
+ */
+void rate_limit_sleep(uint64_t wait_ns);
+
+/*
+ * Print statistics on the time the device (name) limited by (rl) has been
+ * throttled.
+ */
+void rate_limit_report(const char *name, struct rate_limit *rl);
+
+#endif /* COMMON_RATE_LIMIT_H */
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * shm_attach.c: Common functions for attaching to shared memory network
+ * links.
+ */
+
+#define _GNU_SOURCE
+#include <err.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "shm_attach.h"
+
+#if defined(__linux__)
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/*
+ * File descriptors passed from the first to the second side of a link: the
+ * shared memory region, followed by the doorbells for ring 0 and ring 1.
+ */
+#define SHM_NFDS 3
+
+static struct shm_net_port *make_port(int side, const int *fds)
+{
+    struct shm_net_region *region = mmap(NULL, sizeof *region,
+            PROT_READ | PROT_WRITE, MAP_SHARED, fds[0], 0);
+    if (region == MAP_FAILED)
+        err(1, "shm: Could not map shared memory");
+    close(fds[0]);
+    if (region->magic != SHM_NET_MAGIC)
+        errx(1, "shm: Shared memory region is invalid");
+
+    struct shm_net_port *port = calloc(1, sizeof *port);
+    if (port == NULL)
+        err(1, "calloc");
+    port->tx = &region->ring[side];
+    port->rx = &region->ring[!side];
+    port->tx_fd = fds[1 + side];
+    port->rx_fd = fds[1 + !side];
+    return port;
+}
+
+static void sun_init(struct sockaddr_un *sun, const char *path)
+{
+    memset(sun, 0, sizeof *sun);
+    sun->sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof sun->sun_path)
+        errx(1, "shm: %s: Path too long", path);
+    strcpy(sun->sun_path, path);
+}
+
+/*
+ * Connect to the first side of the link at (path). Returns -1 if there is
+ * nobody listening, setting (*stale) if (path) exists.
+ */
+static int connect_peer(const char *path, int *fds, bool *stale)
+{
+    struct sockaddr_un sun;
+    sun_init(&sun, path);
+    int s = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (s == -1)
+        err(1, "shm: socket");
+    if (connect(s, (struct sockaddr *)&sun, sizeof sun) == -1) {
+        if (errno != ENOENT && errno != ECONNREFUSED)
+            err(1, "shm: %s: Could not connect", path);
+        *stale = (errno == ECONNREFUSED);
+        close(s);
+        return -1;
+    }
+
+    char byte;
+    struct iovec iov = { .iov_base = &byte, .iov_len = 1 };
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(SHM_NFDS * sizeof (int))];
+    } cmsg;
+    struct msghdr msg = {
+        .msg_iov = &iov,
+        .msg_iovlen = 1,
+        .msg_control = &cmsg,
+        .msg_controllen = sizeof cmsg
+    };
+    ssize_t n;
+    do {
+        n = recvmsg(s, &msg, MSG_CMSG_CLOEXEC);
+    } while (n == -1 && errno == EINTR);
+    if (n == -1)
+        err(1, "shm: %s: recvmsg", path);
+    struct cmsghdr *c = CMSG_FIRSTHDR(&msg);
+    if (n != 1 || c == NULL || c->cmsg_level != SOL_SOCKET ||
+            c->cmsg_type != SCM_RIGHTS ||
+            c->cmsg_len != CMSG_LEN(SHM_NFDS * sizeof (int)))
+        errx(1, "shm: %s: Invalid response from peer", path);
+    memcpy(fds, CMSG_DATA(c), SHM_NFDS * sizeof (int));
+    close(s);
+    return 0;
+}
+
+/*
+ * Create the link, and wait for the second side to connect at (path).
+ * Returns -1 if someone else got there first.
+ */
+static int listen_peer(const char *path, int *fds, bool stale)
+{
+    struct sockaddr_un sun;
+    sun_init(&sun, path);
+    int s = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (s == -1)
+        err(1, "shm: socket");
+    /*
+     * (path) may be left over from a tender which exited before being paired.
+     */
+    if (stale && unlink(path) == -1 && errno != ENOENT)
+        err(1, "shm: %s: Could not remove stale socket", path);
+    if (bind(s, (struct sockaddr *)&sun, sizeof sun) == -1) {
+        if (errno != EADDRINUSE)
+            err(1, "shm: %s: Could not bind", path);
+        close(s);
+        return -1;
+    }
+    if (listen(s, 1) == -1)
+        err(1, "shm: %s: listen", path);
+
+    fds[0] = memfd_create("solo5-shm-net", MFD_CLOEXEC);
+    if (fds[0] == -1)
+        err(1, "shm: memfd_create");
+    if (ftruncate(fds[0], sizeof (struct shm_net_region)) == -1)
+        err(1, "shm: ftruncate");
+    struct shm_net_region *region = mmap(NULL, sizeof *region,
+            PROT_READ | PROT_WRITE, MAP_SHARED, fds[0], 0);
+    if (region == MAP_FAILED)
+        err(1, "shm: Could not map shared memory");
+    region->magic = SHM_NET_MAGIC;
+    munmap(region, sizeof *region);
+    for (int i = 1; i < SHM_NFDS; i++) {
+        fds[i] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (fds[i] == -1)
+            err(1, "shm: eventfd");
+    }
+
+    warnx("shm: %s: Waiting for peer", path);
+    int c;
+    do {
+        c = accept4(s, NULL, NULL, SOCK_CLOEXEC);
+    } while (c == -1 && errno == EINTR);
+    if (c == -1)
+        err(1, "shm: %s: accept", path);
+    close(s);
+    unlink(path);
+
+    char byte = 0;
+    struct iovec iov = { .iov_base = &byte, .iov_len = 1 };
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(SHM_NFDS * sizeof (int))];
+    } cmsg;
+    memset(&cmsg, 0, sizeof cmsg);
+    struct msghdr msg = {
+        .msg_iov = &iov,
+        .msg_iovlen = 1,
+        .msg_control = &cmsg,
+        .msg_controllen = sizeof cmsg
+    };
+    struct cmsghdr *ch = CMSG_FIRSTHDR(&msg);
+    ch->cmsg_level = SOL_SOCKET;
+    ch->cmsg_type = SCM_RIGHTS;
+    ch->cmsg_len = CMSG_LEN(SHM_NFDS * sizeof (int));
+    memcpy(CMSG_DATA(ch), fds, SHM_NFDS * sizeof (int));
+    if (sendmsg(c, &msg, MSG_NOSIGNAL) != 1)
+        err(1, "shm: %s: sendmsg", path);
+    close(c);
+    return 0;
+}
+
+struct shm_net_port *shm_attach(const char *path)
+{
+    int fds[SHM_NFDS];
+    bool stale;
+
+    /*
+     * Retry if we race with another tender trying to create the link.
+     */
+    for (int tries = 0; tries < 10; tries++) {
+        if (connect_peer(path, fds, &stale) == 0)
+            return make_port(1, fds);
+        if (listen_peer(path, fds, stale) == 0)
+            return make_port(0, fds);
+    }
+    errx(1, "shm: %s: Could not pair with peer", path);
+}
+
+#else /* !__linux__ */
+
+struct shm_net_port *shm_attach(const char *path)
+{
+    errx(1, "shm: %s: Not supported on this host", path);
+}
+
+#endif
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * shm_attach.h: Common functions for attaching to shared memory network
+ * links.
+ */
+
+#ifndef COMMON_SHM_ATTACH_H
+#define COMMON_SHM_ATTACH_H
+
+#include "shm_abi.h"
+
+/*
+ * Attach to the shared memory network link rendezvous point at (path), a
+ * UNIX domain socket. The first tender to attach to (path) creates the link
+ * and waits for a peer to attach; the second connects to the first. Once
+ * paired, (path) is removed and may be reused for another link.
+ *
+ * Returns the port for this side of the link.
+ *
+ * On failure, reports to stderr and terminates the program.
+ */
+struct shm_net_port *shm_attach(const char *path);
+
+#endif /* COMMON_SHM_ATTACH_H */
@@ -27,7 +27,9 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <ifaddrs.h>
+#include <inttypes.h>
 #include <limits.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -41,11 +43,13 @@
  * Linux TAP device specific.
  */
 #include <sys/socket.h>
+#include <linux/filter.h>
 #include <linux/if.h>
 #include <linux/if_tun.h>
 
 #elif defined(__FreeBSD__)
 
+#include <sys/socket.h>
 #include <net/if.h>
 
 #elif defined(__OpenBSD__)
@@ -59,10 +63,36 @@
 
 #endif
 
-int tap_attach(const char *ifname)
+#include "tap_attach.h"
+
+#if defined(__linux__)
+/*
+ * Configure the virtio-net header size and offloads on the tap device (fd).
+ */
+static int tap_set_vnet_hdr(int fd)
+{
+    int hdr_size = TAP_VNET_HDR_SIZE;
+    unsigned offload = TUN_F_CSUM | TUN_F_TSO4 | TUN_F_TSO6 | TUN_F_TSO_ECN;
+
+    if (ioctl(fd, TUNSETVNETHDRSZ, &hdr_size) == -1)
+        return -1;
+    if (ioctl(fd, TUNSETOFFLOAD, offload) == -1)
+        return -1;
+    return 0;
+}
+#endif
+
+int tap_attach(const char *ifname, bool vnet_hdr)
 {
     int fd;
 
+#if !defined(__linux__)
+    if (vnet_hdr) {
+        errno = ENOTSUP;
+        return -1;
+    }
+#endif
+
     /*
      * Syntax @<number> indicates a pre-existing open fd, so just pass it
      * through if the supplied <number> is in range and O_NONBLOCK can be set.
@@ -81,6 +111,21 @@ int tap_attach(const char *ifname)
         fd = (int)maybe_fd;
         if (fcntl(fd, F_SETFL, O_NONBLOCK) == -1)
             return -1;
+#if defined(__linux__)
+        if (vnet_hdr) {
+            struct ifreq ifr;
+
+            memset(&ifr, 0, sizeof(ifr));
+            if (ioctl(fd, TUNGETIFF, (void *)&ifr) == -1)
+                return -1;
+            if (!(ifr.ifr_flags & IFF_VNET_HDR)) {
+                errno = EINVAL;
+                return -1;
+            }
+            if (tap_set_vnet_hdr(fd) == -1)
+                return -1;
+        }
+#endif
 
         return fd;
     }
@@ -137,6 +182,8 @@ int tap_attach(const char *ifname)
      * TODO: IFF_NO_PI may silently truncate packets on read().
      */
     ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+    if (vnet_hdr)
+        ifr.ifr_flags |= IFF_VNET_HDR;
     strncpy(ifr.ifr_name, ifname, IFNAMSIZ - 1);
 
     /*
@@ -159,6 +206,12 @@ int tap_attach(const char *ifname)
         errno = EINVAL;
         return -1;
     }
+    if (vnet_hdr && tap_set_vnet_hdr(fd) == -1) {
+        err = errno;
+        close(fd);
+        errno = err;
+        return -1;
+    }
 
 #elif defined(__FreeBSD__)
 
@@ -187,6 +240,159 @@ int tap_attach(const char *ifname)
     return fd;
 }
 
+int tap_attach_get_mtu(int fd, const char *ifname)
+{
+    struct ifreq ifr;
+    int sfd, err;
+
+    memset(&ifr, 0, sizeof(ifr));
+#if defined(__linux__)
+    /*
+     * Works for both named interfaces and pre-existing descriptors.
+     */
+    if (ioctl(fd, TUNGETIFF, (void *)&ifr) == -1)
+        return -1;
+#else
+    if (ifname[0] == '@') {
+        errno = ENOTSUP;
+        return -1;
+    }
+    strncpy(ifr.ifr_name, ifname, IFNAMSIZ - 1);
+#endif
+
+    sfd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sfd == -1)
+        return -1;
+    if (ioctl(sfd, SIOCGIFMTU, (void *)&ifr) == -1) {
+        err = errno;
+        close(sfd);
+        errno = err;
+        return -1;
+    }
+    close(sfd);
+
+    return ifr.ifr_mtu;
+}
+
+int tap_filter_add_mcast(struct tap_filter *f, const char *list)
+{
+    const char *p = list;
+
+    for (;;) {
+        uint8_t mac[6];
+        int n = 0;
+        int rc = sscanf(p, "%02"SCNx8":%02"SCNx8":%02"SCNx8":"
+                "%02"SCNx8":%02"SCNx8":%02"SCNx8"%n",
+                &mac[0], &mac[1], &mac[2], &mac[3], &mac[4], &mac[5], &n);
+        if (rc != 6 || (p[n] != '\0' && p[n] != ',')) {
+            warnx("Malformed multicast address list: '%s'", list);
+            return -1;
+        }
+        if ((mac[0] & 0x01) == 0) {
+            warnx("Not a multicast address: '%.*s'", n, p);
+            return -1;
+        }
+        if (f->nmcast == TAP_FILTER_MCAST_MAX) {
+            warnx("Too many multicast addresses (maximum %d)",
+                    TAP_FILTER_MCAST_MAX);
+            return -1;
+        }
+        memcpy(f->mcast[f->nmcast++], mac, sizeof mac);
+        if (p[n] == '\0')
+            return 0;
+        p += n + 1;
+    }
+}
+
+#if defined(__linux__)
+/*
+ * Number of BPF instructions emitted per accepted address by
+ * tap_attach_filter(), and the maximum size of the resulting program.
+ */
+#define TAP_FILTER_INSNS_PER_ADDR 4
+#define TAP_FILTER_INSNS_MAX \
+    ((2 + TAP_FILTER_MCAST_MAX) * TAP_FILTER_INSNS_PER_ADDR + 2)
+
+int tap_attach_filter(int fd, const uint8_t *mac, const struct tap_filter *f)
+{
+    static const uint8_t broadcast[6] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+    const uint8_t *addrs[2 + TAP_FILTER_MCAST_MAX];
+    struct sock_filter insns[TAP_FILTER_INSNS_MAX];
+    unsigned naddrs = 0, ninsns;
+
+    addrs[naddrs++] = mac;
+    addrs[naddrs++] = broadcast;
+    for (unsigned i = 0; i != f->nmcast; i++)
+        addrs[naddrs++] = f->mcast[i];
+
+    /*
+     * For each address, compare the last four and then the first two bytes
+     * of the destination MAC address. On a match, jump to the final "accept"
+     * instruction. If no address matches, fall through to "drop".
+     */
+    ninsns = naddrs * TAP_FILTER_INSNS_PER_ADDR + 2;
+    unsigned accept = ninsns - 1;
+    for (unsigned i = 0; i != naddrs; i++) {
+        const uint8_t *a = addrs[i];
+        struct sock_filter *insn = &insns[i * TAP_FILTER_INSNS_PER_ADDR];
+        unsigned pc = i * TAP_FILTER_INSNS_PER_ADDR;
+
+        insn[0] = (struct sock_filter)BPF_STMT(BPF_LD | BPF_W | BPF_ABS, 2);
+        insn[1] = (struct sock_filter)BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K,
+                ((uint32_t)a[2] << 24) | ((uint32_t)a[3] << 16) |
+                ((uint32_t)a[4] << 8) | a[5], 0, 2);
+        insn[2] = (struct sock_filter)BPF_STMT(BPF_LD | BPF_H | BPF_ABS, 0);
+        insn[3] = (struct sock_filter)BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K,
+                ((uint32_t)a[0] << 8) | a[1], accept - (pc + 4), 0);
+    }
+    insns[ninsns - 2] = (struct sock_filter)BPF_STMT(BPF_RET | BPF_K, 0);
+    insns[ninsns - 1] = (struct sock_filter)BPF_STMT(BPF_RET | BPF_K,
+            0xffffffff);
+
+    struct sock_fprog prog = {
+        .len = ninsns,
+        .filter = insns
+    };
+    return ioctl(fd, TUNATTACHFILTER, (void *)&prog);
+}
+
+int tap_attach_get_dropped(int fd, uint64_t *dropped)
+{
+    struct ifreq ifr;
+    char path[64 + IFNAMSIZ];
+    FILE *fp;
+    int rc;
+
+    memset(&ifr, 0, sizeof(ifr));
+    if (ioctl(fd, TUNGETIFF, (void *)&ifr) == -1)
+        return -1;
+    snprintf(path, sizeof path, "/sys/class/net/%s/statistics/tx_dropped",
+            ifr.ifr_name);
+    fp = fopen(path, "r");
+    if (fp == NULL)
+        return -1;
+    rc = fscanf(fp, "%" SCNu64, dropped);
+    fclose(fp);
+    if (rc != 1) {
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+#else /* !__linux__ */
+int tap_attach_filter(int fd, const uint8_t *mac, const struct tap_filter *f)
+{
+    errno = ENOTSUP;
+    return -1;
+}
+
+int tap_attach_get_dropped(int fd, uint64_t *dropped)
+{
+    errno = ENOTSUP;
+    return -1;
+}
+#endif /* __linux__ */
+
 void tap_attach_genmac(uint8_t *mac)
 {
     int rfd = open("/dev/urandom", O_RDONLY);
@@ -25,14 +25,66 @@
 #ifndef COMMON_TAP_ATTACH_H
 #define COMMON_TAP_ATTACH_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 /*
  * Attach to an existing TAP interface named (ifname). If ifname is "@<num>",
  * assume that a pre-existing TAP interface is open as file descriptor <num>.
  *
+ * If (vnet_hdr) is true, each packet read from or written to the returned
+ * descriptor is preceded by a TAP_VNET_HDR_SIZE byte virtio-net header, and
+ * the host accepts and delivers packets requiring checksum offload and TCP
+ * segmentation. A pre-existing descriptor must have been opened with
+ * IFF_VNET_HDR. This is only supported on Linux.
+ *
  * Returns -1 and an appropriate errno on failure (ENOENT if the interface does
  * not exist), and the tap device file descriptor on success.
  */
-int tap_attach(const char *ifname);
+int tap_attach(const char *ifname, bool vnet_hdr);
+
+#define TAP_VNET_HDR_SIZE 10
+
+/*
+ * Returns the MTU of the TAP interface (ifname) previously attached as (fd) by
+ * tap_attach(), or -1 and an appropriate errno on failure. On hosts other
+ * than Linux, the MTU cannot be determined if (ifname) is "@<num>".
+ */
+int tap_attach_get_mtu(int fd, const char *ifname);
+
+#define TAP_FILTER_MCAST_MAX 16
+
+/*
+ * Frame filter for a TAP interface. See tap_attach_filter().
+ */
+struct tap_filter {
+    bool enabled;
+    unsigned nmcast;
+    uint8_t mcast[TAP_FILTER_MCAST_MAX][6];
+};
+
+/*
+ * Parse the comma-separated list of multicast MAC addresses (list) and add
+ * them to the filter (f). Returns -1 and prints a warning on failure.
+ */
+int tap_filter_add_mcast(struct tap_filter *f, const char *list);
+
+/*
+ * Attach a classic BPF filter to the TAP interface (fd) which accepts only
+ * frames destined for (mac), the broadcast address, or one of the multicast
+ * addresses in (f). All other frames are dropped by the host kernel, and are
+ * counted in the interface's tx_dropped statistic. This is only supported on
+ * Linux.
+ *
+ * Returns -1 and an appropriate errno on failure, 0 on success.
+ */
+int tap_attach_filter(int fd, const uint8_t *mac, const struct tap_filter *f);
+
+/*
+ * Store the tx_dropped statistic of the TAP interface (fd) in (*dropped).
+ * Returns -1 and an appropriate errno on failure, 0 on success.
+ */
+int tap_attach_get_dropped(int fd, uint64_t *dropped);
 
 /*
  * Generate a random, locally-administered and unicast MAC address, and store it
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * xdp_attach.c: Common functions for attaching to network interfaces using
+ * AF_XDP.
+ */
+
+#define _GNU_SOURCE
+#include <err.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "xdp_attach.h"
+
+#if defined(__linux__)
+
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <linux/bpf.h>
+#include <linux/if_link.h>
+#include <linux/if_xdp.h>
+
+#ifndef SOL_XDP
+#define SOL_XDP 283
+#endif
+
+_Static_assert(XDP_PORT_NEED_WAKEUP == XDP_RING_NEED_WAKEUP,
+        "XDP_PORT_NEED_WAKEUP does not match XDP_RING_NEED_WAKEUP");
+_Static_assert(sizeof (struct xdp_port_desc) == sizeof (struct xdp_desc),
+        "struct xdp_port_desc does not match struct xdp_desc");
+
+static int sys_bpf(int cmd, union bpf_attr *attr)
+{
+    return syscall(SYS_bpf, cmd, attr, sizeof *attr);
+}
+
+/*
+ * Load and attach to (ifindex) an XDP program equivalent to:
+ *
+ *     return bpf_redirect_map(&xsks, ctx->rx_queue_index, XDP_PASS);
+ *
+ * where (xsks) is (map_fd). Packets received on queues with no socket in the
+ * map are passed on to the host network stack.
+ */
+static void attach_prog(const char *ifname, int ifindex, int map_fd)
+{
+    struct bpf_insn prog[] = {
+        /* r2 = ctx->rx_queue_index */
+        { .code = BPF_LDX | BPF_MEM | BPF_W, .dst_reg = BPF_REG_2,
+          .src_reg = BPF_REG_1,
+          .off = offsetof(struct xdp_md, rx_queue_index) },
+        /* r1 = map_fd (64-bit immediate, two instructions) */
+        { .code = BPF_LD | BPF_DW | BPF_IMM, .dst_reg = BPF_REG_1,
+          .src_reg = BPF_PSEUDO_MAP_FD, .imm = map_fd },
+        { 0 },
+        /* r3 = XDP_PASS */
+        { .code = BPF_ALU64 | BPF_MOV | BPF_K, .dst_reg = BPF_REG_3,
+          .imm = XDP_PASS },
+        /* r0 = bpf_redirect_map(r1, r2, r3) */
+        { .code = BPF_JMP | BPF_CALL, .imm = BPF_FUNC_redirect_map },
+        { .code = BPF_JMP | BPF_EXIT }
+    };
+    union bpf_attr attr;
+
+    memset(&attr, 0, sizeof attr);
+    attr.prog_type = BPF_PROG_TYPE_XDP;
+    attr.insns = (uint64_t)(uintptr_t)prog;
+    attr.insn_cnt = sizeof prog / sizeof prog[0];
+    attr.license = (uint64_t)(uintptr_t)"Dual BSD/GPL";
+    int prog_fd = sys_bpf(BPF_PROG_LOAD, &attr);
+    if (prog_fd == -1)
+        err(1, "%s: Could not load XDP program", ifname);
+
+    /*
+     * The link is detached by the kernel when the process exits, so there is
+     * no need to keep track of (link_fd).
+     */
+    memset(&attr, 0, sizeof attr);
+    attr.link_create.prog_fd = prog_fd;
+    attr.link_create.target_ifindex = ifindex;
+    attr.link_create.attach_type = BPF_XDP;
+    int link_fd = sys_bpf(BPF_LINK_CREATE, &attr);
+    if (link_fd == -1)
+        err(1, "%s: Could not attach XDP program", ifname);
+    close(prog_fd);
+}
+
+static void *map_ring(int fd, size_t size, off_t pgoff, const char *ifname)
+{
+    void *p = mmap(NULL, size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, fd, pgoff);
+    if (p == MAP_FAILED)
+        err(1, "%s: Could not map AF_XDP ring", ifname);
+    return p;
+}
+
+static void setup_ring(struct xdp_port_ring *r, uint8_t *map,
+        const struct xdp_ring_offset *off)
+{
+    r->producer = (uint32_t *)(map + off->producer);
+    r->consumer = (uint32_t *)(map + off->consumer);
+    r->flags = (uint32_t *)(map + off->flags);
+    r->descs = map + off->desc;
+}
+
+struct xdp_port *xdp_attach(const char *spec, uint8_t *mac)
+{
+    char ifname[IFNAMSIZ];
+    unsigned queue = 0;
+    const char *colon = strchr(spec, ':');
+    size_t len = colon ? (size_t)(colon - spec) : strlen(spec);
+
+    if (len == 0 || len >= IFNAMSIZ)
+        errx(1, "%s: Invalid interface name", spec);
+    memcpy(ifname, spec, len);
+    ifname[len] = '\0';
+    if (colon) {
+        char *endp;
+        errno = 0;
+        unsigned long q = strtoul(colon + 1, &endp, 10);
+        if (errno || *endp != '\0' || endp == colon + 1 || q >= INT_MAX)
+            errx(1, "%s: Invalid queue number", spec);
+        queue = q;
+    }
+
+    int ifindex = if_nametoindex(ifname);
+    if (ifindex == 0)
+        err(1, "%s: Could not find interface", ifname);
+
+    struct ifreq ifr;
+    int sfd = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (sfd == -1)
+        err(1, "socket");
+    memset(&ifr, 0, sizeof ifr);
+    strcpy(ifr.ifr_name, ifname);
+    if (ioctl(sfd, SIOCGIFHWADDR, &ifr) == -1)
+        err(1, "%s: Could not get MAC address", ifname);
+    memcpy(mac, ifr.ifr_hwaddr.sa_data, 6);
+    close(sfd);
+
+    struct xdp_port *port = calloc(1, sizeof *port);
+    if (port == NULL)
+        err(1, "calloc");
+    int fd = socket(AF_XDP, SOCK_RAW | SOCK_CLOEXEC, 0);
+    if (fd == -1)
+        err(1, "%s: Could not create AF_XDP socket", ifname);
+    port->fd = fd;
+
+    /*
+     * Register the UMEM and size the rings.
+     */
+    size_t umem_size = (size_t)XDP_PORT_NUM_FRAMES * XDP_PORT_FRAME_SIZE;
+    port->umem = mmap(NULL, umem_size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (port->umem == MAP_FAILED)
+        err(1, "%s: Could not allocate UMEM", ifname);
+    struct xdp_umem_reg reg = {
+        .addr = (uint64_t)(uintptr_t)port->umem,
+        .len = umem_size,
+        .chunk_size = XDP_PORT_FRAME_SIZE,
+        .headroom = 0
+    };
+    if (setsockopt(fd, SOL_XDP, XDP_UMEM_REG, &reg, sizeof reg) == -1)
+        err(1, "%s: Could not register UMEM", ifname);
+    int ring_size = XDP_PORT_RING_SIZE;
+    if (setsockopt(fd, SOL_XDP, XDP_UMEM_FILL_RING, &ring_size,
+                sizeof ring_size) == -1 ||
+        setsockopt(fd, SOL_XDP, XDP_UMEM_COMPLETION_RING, &ring_size,
+                sizeof ring_size) == -1 ||
+        setsockopt(fd, SOL_XDP, XDP_RX_RING, &ring_size,
+                sizeof ring_size) == -1 ||
+        setsockopt(fd, SOL_XDP, XDP_TX_RING, &ring_size,
+                sizeof ring_size) == -1)
+        err(1, "%s: Could not set up AF_XDP rings", ifname);
+
+    /*
+     * Map the rings.
+     */
+    struct xdp_mmap_offsets off;
+    socklen_t optlen = sizeof off;
+    if (getsockopt(fd, SOL_XDP, XDP_MMAP_OFFSETS, &off, &optlen) == -1)
+        err(1, "%s: Could not get AF_XDP ring offsets", ifname);
+    setup_ring(&port->fill, map_ring(fd, off.fr.desc + ring_size *
+                sizeof (uint64_t), XDP_UMEM_PGOFF_FILL_RING, ifname),
+            &off.fr);
+    setup_ring(&port->comp, map_ring(fd, off.cr.desc + ring_size *
+                sizeof (uint64_t), XDP_UMEM_PGOFF_COMPLETION_RING, ifname),
+            &off.cr);
+    setup_ring(&port->rx, map_ring(fd, off.rx.desc + ring_size *
+                sizeof (struct xdp_desc), XDP_PGOFF_RX_RING, ifname),
+            &off.rx);
+    setup_ring(&port->tx, map_ring(fd, off.tx.desc + ring_size *
+                sizeof (struct xdp_desc), XDP_PGOFF_TX_RING, ifname),
+            &off.tx);
+
+    /*
+     * Hand all RX frames to the kernel, and keep all TX frames on the free
+     * list.
+     */
+    for (unsigned i = 0; i < XDP_PORT_RING_SIZE; i++) {
+        ((uint64_t *)port->fill.descs)[i] = (uint64_t)i * XDP_PORT_FRAME_SIZE;
+        port->tx_free[i] =
+            (uint64_t)(XDP_PORT_RING_SIZE + i) * XDP_PORT_FRAME_SIZE;
+    }
+    port->tx_nfree = XDP_PORT_RING_SIZE;
+    __atomic_store_n(port->fill.producer, XDP_PORT_RING_SIZE,
+            __ATOMIC_RELEASE);
+
+    /*
+     * Let the kernel choose between zero-copy and copy mode, depending on
+     * driver support.
+     */
+    struct sockaddr_xdp sxdp = {
+        .sxdp_family = AF_XDP,
+        .sxdp_flags = XDP_USE_NEED_WAKEUP,
+        .sxdp_ifindex = ifindex,
+        .sxdp_queue_id = queue
+    };
+    if (bind(fd, (struct sockaddr *)&sxdp, sizeof sxdp) == -1)
+        err(1, "%s: Could not bind AF_XDP socket to queue %u", ifname, queue);
+
+    /*
+     * Create the socket map and attach the XDP program.
+     */
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof attr);
+    attr.map_type = BPF_MAP_TYPE_XSKMAP;
+    attr.key_size = sizeof (uint32_t);
+    attr.value_size = sizeof (uint32_t);
+    attr.max_entries = queue + 1;
+    int map_fd = sys_bpf(BPF_MAP_CREATE, &attr);
+    if (map_fd == -1)
+        err(1, "%s: Could not create XSKMAP", ifname);
+    uint32_t key = queue, value = fd;
+    memset(&attr, 0, sizeof attr);
+    attr.map_fd = map_fd;
+    attr.key = (uint64_t)(uintptr_t)&key;
+    attr.value = (uint64_t)(uintptr_t)&value;
+    if (sys_bpf(BPF_MAP_UPDATE_ELEM, &attr) == -1)
+        err(1, "%s: Could not update XSKMAP", ifname);
+    attach_prog(ifname, ifindex, map_fd);
+    close(map_fd);
+
+    return port;
+}
+
+#else /* !__linux__ */
+
+struct xdp_port *xdp_attach(const char *spec, uint8_t *mac)
+{
+    errx(1, "%s: AF_XDP is not supported on this host", spec);
+}
+
+#endif
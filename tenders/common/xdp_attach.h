@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * xdp_attach.h: Common functions for attaching to network interfaces using
+ * AF_XDP.
+ */
+
+#ifndef COMMON_XDP_ATTACH_H
+#define COMMON_XDP_ATTACH_H
+
+#include <stdint.h>
+
+#include "xdp_abi.h"
+
+/*
+ * Attach to queue QUEUE (default 0) of the network interface IFACE, given in
+ * (spec) as "IFACE[:QUEUE]", using an AF_XDP socket. An XDP program
+ * redirecting all packets received on the queue to the socket is attached to
+ * the interface for the lifetime of the process.
+ *
+ * Returns the port, with the socket in (port->fd). The MAC address of the
+ * interface is returned in (*mac), which must be an uint8_t[6].
+ *
+ * On failure, reports to stderr and terminates the program.
+ */
+struct xdp_port *xdp_attach(const char *spec, uint8_t *mac);
+
+#endif /* COMMON_XDP_ATTACH_H */
@@ -57,6 +57,12 @@ struct hvt {
     size_t mem_size;
     uint64_t cpu_cycle_freq;
     hvt_gpa_t cpu_boot_info_base;
+    /*
+     * The guest ELF binary. (elf_fd) is only valid during module setup, for
+     * modules which need to read additional information from the binary.
+     */
+    int elf_fd;
+    const char *elf_filename;
     struct hvt_b *b;
 };
 
@@ -114,6 +120,13 @@ void hvt_boot_info_init(struct hvt *hvt, hvt_gpa_t gpa_kend, int cmdline_argc,
 int hvt_guest_mprotect(void *t_arg, uint64_t addr_start, uint64_t addr_end,
         int prot);
 
+/*
+ * Arrange for a guest issuing hypercall (nr) with the argument (data) to
+ * signal the eventfd (fd), without the VCPU exiting to the tender. Returns 0
+ * on success, or -1 if this is not supported by the backend.
+ */
+int hvt_ioeventfd_register(struct hvt *hvt, int nr, uint32_t data, int fd);
+
 #if HVT_DROP_PRIVILEGES
 /*
  * Drop privileges. This function is called by the tender before entering the
@@ -34,6 +34,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -142,6 +143,61 @@ static void hypercall_puts(struct hvt *hvt, hvt_gpa_t gpa)
     assert(rc >= 0);
 }
 
+/*
+ * Guest memory is a MAP_SHARED anonymous mapping on Linux, for which
+ * MADV_DONTNEED only drops the page table entries; MADV_REMOVE is required to
+ * actually free the backing pages.
+ */
+#if defined(__linux__)
+#define HVT_MADV_RELEASE MADV_REMOVE
+#else
+#define HVT_MADV_RELEASE MADV_FREE
+#endif
+
+static void hypercall_mem_advise(struct hvt *hvt, hvt_gpa_t gpa)
+{
+    struct hvt_hc_mem_advise *a =
+        HVT_CHECKED_GPA_P(hvt, gpa, sizeof (struct hvt_hc_mem_advise));
+    hvt_gpa_t start, end;
+    uintptr_t host_page_mask = ~((uintptr_t)sysconf(_SC_PAGESIZE) - 1);
+
+    if ((a->addr >= hvt->mem_size) || add_overflow(a->addr, a->len, end) ||
+            (end > hvt->mem_size)) {
+        a->ret = -1;
+        return;
+    }
+    /*
+     * The host page size may be larger than the guest page size, only advise
+     * on whole host pages covered by the range.
+     */
+    start = (a->addr + ~host_page_mask) & host_page_mask;
+    end &= host_page_mask;
+    if (end <= start) {
+        a->ret = 0;
+        return;
+    }
+
+    switch (a->advice) {
+    case HVT_MEM_ADVISE_RELEASE:
+        a->ret = madvise(hvt->mem + start, end - start, HVT_MADV_RELEASE);
+        break;
+    case HVT_MEM_ADVISE_REUSE:
+        /*
+         * Released pages are re-populated on demand by the host kernel. Where
+         * available, pre-fault them here to save taking a fault per page on
+         * first access; this is best-effort only.
+         */
+#if defined(MADV_POPULATE_WRITE)
+        (void)madvise(hvt->mem + start, end - start, MADV_POPULATE_WRITE);
+#endif
+        a->ret = 0;
+        break;
+    default:
+        a->ret = -1;
+        break;
+    }
+}
+
 static int waitsetfd = -1;
 static int npollfds;
 #if defined(__linux__)
@@ -301,6 +357,8 @@ static int setup(struct hvt *hvt, struct mft *mft)
                 hypercall_puts) == 0);
     assert(hvt_core_register_hypercall(HVT_HYPERCALL_POLL,
                 hypercall_poll) == 0);
+    assert(hvt_core_register_hypercall(HVT_HYPERCALL_MEM_ADVISE,
+                hypercall_mem_advise) == 0);
 
     return 0;
 }
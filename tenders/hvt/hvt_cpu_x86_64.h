@@ -73,6 +73,8 @@
 #define X86_CR4_OSXMMEXCPT      _BITUL(X86_CR4_OSXMMEXCPT_BIT)
 #define X86_CR4_VMXE_BIT        13 /* VMX enabled */
 #define X86_CR4_VMXE            _BITUL(X86_CR4_VMXE_BIT)
+#define X86_CR4_FSGSBASE_BIT    16 /* Enable {RD,WR}{FS,GS}BASE */
+#define X86_CR4_FSGSBASE        _BITUL(X86_CR4_FSGSBASE_BIT)
 
 /*
  * Intel SDM section 23.8 "Restrictions on VMX Operation" seems to imply that
@@ -83,6 +85,12 @@
 #define X86_CR4_INIT            (X86_CR4_PAE | X86_CR4_OSFXSR | \
                                 X86_CR4_OSXMMEXCPT)
 
+/*
+ * CPUID leaf 7 (structured extended features), sub-leaf 0, EBX
+ */
+#define X86_CPUID7_EBX_FSGSBASE_BIT 0
+#define X86_CPUID7_EBX_FSGSBASE _BITUL(X86_CPUID7_EBX_FSGSBASE_BIT)
+
 /*
  * Intel CPU features in EFER
  */
@@ -221,3 +221,11 @@ int hvt_guest_mprotect(void *t_arg, uint64_t addr_start, uint64_t addr_end,
     prot &= ~(PROT_EXEC);
     return mprotect(vaddr_start, size, prot);
 }
+
+int hvt_ioeventfd_register(struct hvt *hvt, int nr, uint32_t data, int fd)
+{
+    /*
+     * Not supported by FreeBSD vmm.
+     */
+    return -1;
+}
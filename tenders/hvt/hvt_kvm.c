@@ -145,3 +145,23 @@ int hvt_guest_mprotect(void *t_arg, uint64_t addr_start, uint64_t addr_end,
     prot &= ~(PROT_EXEC);
     return mprotect(vaddr_start, size, prot);
 }
+
+int hvt_ioeventfd_register(struct hvt *hvt, int nr, uint32_t data, int fd)
+{
+    struct kvm_ioeventfd ioeventfd = {
+        .datamatch = data,
+        .len = 4,
+        .fd = fd,
+        .flags = KVM_IOEVENTFD_FLAG_DATAMATCH,
+    };
+
+#if defined(__x86_64__)
+    ioeventfd.addr = HVT_HYPERCALL_PIO_BASE + nr;
+    ioeventfd.flags |= KVM_IOEVENTFD_FLAG_PIO;
+#elif defined(__aarch64__)
+    ioeventfd.addr = HVT_HYPERCALL_ADDRESS(nr);
+#endif
+    if (ioctl(hvt->b->vmfd, KVM_CHECK_EXTENSION, KVM_CAP_IOEVENTFD) <= 0)
+        return -1;
+    return ioctl(hvt->b->vmfd, KVM_IOEVENTFD, &ioeventfd);
+}
@@ -42,8 +42,13 @@ void hvt_mem_size(size_t *mem_size) {
     hvt_x86_mem_size(mem_size);
 }
 
-static void setup_cpuid(struct hvt_b *hvb)
+/*
+ * Passes the host's supported CPUID through to the guest. Returns true if the
+ * guest may use the {RD,WR}{FS,GS}BASE instructions.
+ */
+static bool setup_cpuid(struct hvt_b *hvb)
 {
+    bool fsgsbase = false;
     struct kvm_cpuid2 *kvm_cpuid;
     int max_entries = 100;
 
@@ -58,7 +63,15 @@ static void setup_cpuid(struct hvt_b *hvb)
     if (ioctl(hvb->vcpufd, KVM_SET_CPUID2, kvm_cpuid) < 0)
         err(1, "KVM: ioctl (SET_CPUID2) failed");
 
+    for (unsigned i = 0; i < kvm_cpuid->nent; i++) {
+        struct kvm_cpuid_entry2 *e = &kvm_cpuid->entries[i];
+        if (e->function == 7 && e->index == 0 &&
+                (e->ebx & X86_CPUID7_EBX_FSGSBASE))
+            fsgsbase = true;
+    }
+
     free(kvm_cpuid);
+    return fsgsbase;
 }
 
 static struct kvm_segment sreg_to_kvm(const struct x86_sreg *sreg)
@@ -86,12 +99,16 @@ void hvt_vcpu_init(struct hvt *hvt, hvt_gpa_t gpa_ep)
     hvt_x86_setup_gdt(hvt->mem);
     hvt_x86_setup_pagetables(hvt->mem, hvt->mem_size);
 
-    setup_cpuid(hvb);
+    bool fsgsbase = setup_cpuid(hvb);
 
     struct kvm_sregs sregs = {
         .cr0 = X86_CR0_INIT,
         .cr3 = X86_CR3_INIT,
-        .cr4 = X86_CR4_INIT,
+        /*
+         * Let the guest set its TLS base with WRFSBASE, which does not cause
+         * a VM exit, rather than WRMSR.
+         */
+        .cr4 = X86_CR4_INIT | (fsgsbase ? X86_CR4_FSGSBASE : 0),
         .efer = X86_EFER_INIT,
 
         .cs = sreg_to_kvm(&hvt_x86_sreg_code),
@@ -155,8 +172,16 @@ int hvt_vcpu_loop(struct hvt *hvt)
 
     while (1) {
         ret = ioctl(hvb->vcpufd, KVM_RUN, NULL);
-        if (ret == -1 && errno == EINTR)
+        if (ret == -1 && errno == EINTR) {
+            /*
+             * Interrupted by a signal (KVM_EXIT_INTR). Give modules a chance
+             * to act on this, e.g. to sample guest state, then resume.
+             */
+            for (hvt_vmexit_fn_t *fn = hvt_core_vmexits; *fn; fn++)
+                if ((*fn)(hvt) == 0)
+                    break;
             continue;
+        }
         if (ret == -1) {
             if (errno == EFAULT) {
                 struct kvm_regs regs;
@@ -36,6 +36,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include "../common/placement.h"
 #include "hvt.h"
 #include "version.h"
 
@@ -99,6 +100,21 @@ static void handle_mem(char *cmdarg, size_t *mem_size)
     *mem_size = mem;
 }
 
+static void handle_placement(char *cmdarg, struct placement *pl)
+{
+    if (strncmp("--cpu=", cmdarg, 6) == 0) {
+        if (placement_parse_cpus(pl, cmdarg + 6) == -1)
+            errx(1, "Malformed argument to --cpu");
+        return;
+    }
+    if (strncmp("--numa-node=", cmdarg, 12) == 0) {
+        if (placement_parse_node(pl, cmdarg + 12) == -1)
+            errx(1, "Malformed argument to --numa-node");
+        return;
+    }
+    pl->prefault = true;
+}
+
 static void usage(const char *prog)
 {
     fprintf(stderr, "usage: %s [ CORE OPTIONS ] [ MODULE OPTIONS ] [ -- ] "
@@ -107,6 +123,9 @@ static void usage(const char *prog)
     fprintf(stderr, "ARGS are optional arguments passed to the unikernel.\n");
     fprintf(stderr, "Core options:\n");
     fprintf(stderr, "  [ --mem=512 ] (guest memory in MB)\n");
+    fprintf(stderr, "  [ --cpu=LIST ] (run on CPUs in LIST, e.g. 0,2-3)\n");
+    fprintf(stderr, "  [ --numa-node=N ] (bind guest memory to NUMA node N)\n");
+    fprintf(stderr, "  [ --mem-prefault ] (allocate guest memory at startup)\n");
     fprintf(stderr, "    --help (display this help)\n");
     fprintf(stderr, "    --version (display version information)\n");
     fprintf(stderr, "Compiled-in modules: ");
@@ -143,7 +162,9 @@ int main(int argc, char **argv)
     const char *elf_filename;
     int elf_fd = -1;
     int matched;
+    struct placement placement;
 
+    placement_init(&placement);
     prog = basename(*argv);
     argc--;
     argv++;
@@ -230,6 +251,14 @@ int main(int argc, char **argv)
             argc--;
             argv++;
         }
+        else if (strncmp("--cpu=", *argv, 6) == 0 ||
+                strncmp("--numa-node=", *argv, 12) == 0 ||
+                strcmp("--mem-prefault", *argv) == 0) {
+            handle_placement(*argv, &placement);
+            matched = 1;
+            argc--;
+            argv++;
+        }
         if (handle_cmdarg(*argv, mft) == 0) {
             /* Handled by module, consume and go on to next arg */
             matched = 1;
@@ -254,16 +283,29 @@ int main(int argc, char **argv)
     if (sigaction(SIGTERM, &sa, NULL) == -1)
         err(1, "Could not install signal handler");
 
+    /*
+     * Apply CPU affinity before any threads are started, so that I/O threads
+     * created by modules inherit it, and bind guest memory before it is
+     * first touched by elf_load().
+     */
+    placement_apply_cpus(&placement);
     hvt_mem_size(&mem_size);
     struct hvt *hvt = hvt_init(mem_size);
+    placement_apply_mem(&placement, hvt->mem, hvt->mem_size);
+    if (placement_enabled(&placement))
+        placement_report(&placement, hvt->mem, hvt->mem_size);
 
     elf_load(elf_fd, elf_filename, hvt->mem, hvt->mem_size, HVT_GUEST_MIN_BASE,
-            hvt_guest_mprotect, hvt, &gpa_ep, &gpa_kend);
-    close(elf_fd);                      /* Done with ELF binary */
+            !placement_mem_enabled(&placement), hvt_guest_mprotect, hvt,
+            &gpa_ep, &gpa_kend);
 
     hvt_vcpu_init(hvt, gpa_ep);
 
+    hvt->elf_fd = elf_fd;
+    hvt->elf_filename = elf_filename;
     setup_modules(hvt, mft);
+    close(elf_fd);                      /* Done with ELF binary */
+    hvt->elf_fd = -1;
 
     hvt_boot_info_init(hvt, gpa_kend, argc, argv, mft, mft_size);
 
@@ -36,11 +36,53 @@
 #endif
 
 #include "../common/block_attach.h"
+#include "../common/rate_limit.h"
 #include "hvt.h"
 #include "solo5.h"
 
 static bool module_in_use;
 static struct mft *host_mft;
+/*
+ * I/O rate limits set with --block-rate, indexed by manifest entry.
+ */
+static struct rate_limit block_rates[MFT_MAX_ENTRIES];
+/*
+ * Copy-on-write overlays attached with --block:NAME=overlay:BASE,DELTA,
+ * indexed by manifest entry.
+ */
+static struct overlay_dev *block_overlays[MFT_MAX_ENTRIES];
+/*
+ * Compressed images attached with --block:NAME=compressed:PATH.
+ */
+static struct compress_dev *block_compressed[MFT_MAX_ENTRIES];
+/*
+ * Block devices attached read-only with --block:NAME=ro:PATH or
+ * compressed:PATH.
+ */
+static bool block_readonly[MFT_MAX_ENTRIES];
+
+/*
+ * Returns true if an I/O of (len) bytes may be performed on the block device
+ * at manifest index (index) without exceeding its --block-rate limit.
+ */
+static bool block_rate_take(unsigned index, size_t len)
+{
+    struct rate_limit *rl = &block_rates[index];
+
+    return !rate_limit_enabled(rl) ||
+        rate_limit_take(rl, rate_limit_clock(), len);
+}
+
+/*
+ * Report the time throttled by --block-rate before the tender exits.
+ */
+static void block_rate_halt(struct hvt *hvt, int status, void *cookie)
+{
+    for (unsigned i = 0; i != host_mft->entries; i++) {
+        if (rate_limit_enabled(&block_rates[i]))
+            rate_limit_report(host_mft->e[i].name, &block_rates[i]);
+    }
+}
 
 static void hypercall_block_write(struct hvt *hvt, hvt_gpa_t gpa)
 {
@@ -67,6 +109,21 @@ static void hypercall_block_write(struct hvt *hvt, hvt_gpa_t gpa)
         wr->ret = SOLO5_R_EINVAL;
         return;
     }
+    if (block_readonly[wr->handle]) {
+        wr->ret = SOLO5_R_EINVAL;
+        return;
+    }
+    if (!block_rate_take(wr->handle, wr->len)) {
+        wr->ret = SOLO5_R_AGAIN;
+        return;
+    }
+
+    if (block_overlays[wr->handle] != NULL) {
+        ret = block_overlay_write(block_overlays[wr->handle],
+                HVT_CHECKED_GPA_P(hvt, wr->data, wr->len), wr->len, pos);
+        wr->ret = (ret == 0) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
+        return;
+    }
 
     ret = pwrite(e->b.hostfd, HVT_CHECKED_GPA_P(hvt, wr->data, wr->len),
             wr->len, pos);
@@ -99,6 +156,23 @@ static void hypercall_block_read(struct hvt *hvt, hvt_gpa_t gpa)
         rd->ret = SOLO5_R_EINVAL;
         return;
     }
+    if (!block_rate_take(rd->handle, rd->len)) {
+        rd->ret = SOLO5_R_AGAIN;
+        return;
+    }
+
+    if (block_compressed[rd->handle] != NULL) {
+        ret = block_compressed_read(block_compressed[rd->handle],
+                HVT_CHECKED_GPA_P(hvt, rd->data, rd->len), rd->len, pos);
+        rd->ret = (ret == 0) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
+        return;
+    }
+    if (block_overlays[rd->handle] != NULL) {
+        ret = block_overlay_read(block_overlays[rd->handle],
+                HVT_CHECKED_GPA_P(hvt, rd->data, rd->len), rd->len, pos);
+        rd->ret = (ret == 0) ? SOLO5_R_OK : SOLO5_R_EUNSPEC;
+        return;
+    }
 
     ret = pread(e->b.hostfd, HVT_CHECKED_GPA_P(hvt, rd->data, rd->len), rd->len,
             pos);
@@ -108,24 +182,74 @@ static void hypercall_block_read(struct hvt *hvt, hvt_gpa_t gpa)
 
 static int handle_cmdarg(char *cmdarg, struct mft *mft)
 {
+    char name[MFT_NAME_SIZE];
+
+    if (strncmp("--block-rate:", cmdarg, 13) == 0) {
+        char spec[64];
+        int rc = sscanf(cmdarg,
+                "--block-rate:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]=%63s", name,
+                spec);
+        if (rc != 2)
+            return -1;
+        unsigned index;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_BLOCK_BASIC,
+                &index);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        return rate_limit_parse(&block_rates[index], spec);
+    }
     if (strncmp("--block:", cmdarg, 8) != 0)
         return -1;
 
-    char name[MFT_NAME_SIZE];
     char path[PATH_MAX + 1];
     int rc = sscanf(cmdarg,
             "--block:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]="
             "%" XSTR(PATH_MAX) "s", name, path);
     if (rc != 2)
         return -1;
-    struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_BLOCK_BASIC, NULL);
+    unsigned index;
+    struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_BLOCK_BASIC,
+            &index);
     if (e == NULL) {
         warnx("Resource not declared in manifest: '%s'", name);
         return -1;
     }
 
     off_t capacity;
-    int fd = block_attach(path, &capacity);
+    int fd;
+    if (strncmp("overlay:", path, 8) == 0) {
+        char *delta = strchr(path, ',');
+        if (delta == NULL)
+            return -1;
+        *delta++ = '\0';
+        block_overlays[index] = block_attach_overlay(path + 8, delta,
+                &capacity);
+        fd = block_overlays[index]->delta_fd;
+    }
+    else if (strncmp("ro:", path, 3) == 0) {
+        fd = block_attach_ro(path + 3, &capacity);
+        block_readonly[index] = true;
+    }
+    else if (strncmp("compressed:", path, 11) == 0) {
+        unsigned nslots = BLOCK_COMPRESSED_DEFAULT_SLOTS;
+        char *slots = strchr(path, ',');
+        if (slots != NULL) {
+            *slots++ = '\0';
+            if (sscanf(slots, "%u", &nslots) != 1 || nslots == 0)
+                return -1;
+            if (nslots > BLOCK_COMPRESSED_MAX_SLOTS)
+                errx(1, "%s: Cache of %u chunks is too large (maximum %d)",
+                        name, nslots, BLOCK_COMPRESSED_MAX_SLOTS);
+        }
+        block_compressed[index] = block_attach_compressed(path + 11, nslots,
+                &capacity);
+        fd = block_compressed[index]->fd;
+        block_readonly[index] = true;
+    }
+    else
+        fd = block_attach(path, &capacity);
     e->u.block_basic.capacity = capacity;
     e->u.block_basic.block_size = 512;
     e->b.hostfd = fd;
@@ -145,6 +269,12 @@ static int setup(struct hvt *hvt, struct mft *mft)
                 hypercall_block_write) == 0);
     assert(hvt_core_register_hypercall(HVT_HYPERCALL_BLOCK_READ,
                 hypercall_block_read) == 0);
+    for (unsigned i = 0; i != mft->entries; i++) {
+        if (rate_limit_enabled(&block_rates[i])) {
+            assert(hvt_core_register_halt_hook(block_rate_halt) == 0);
+            break;
+        }
+    }
 
 #if HVT_FREEBSD_ENABLE_CAPSICUM
     cap_rights_t rights;
@@ -158,7 +288,13 @@ static int setup(struct hvt *hvt, struct mft *mft)
 
 static char *usage(void)
 {
-    return "--block:NAME=PATH (attach block device/file at PATH as block storage NAME)";
+    return "--block:NAME=PATH | ro:PATH | overlay:BASE,DELTA |\n"
+        "    compressed:PATH[,CACHE] (attach block device/file at PATH,\n"
+        "    read-only, copy-on-write overlay DELTA on top of read-only image\n"
+        "    BASE, or read-only compressed image at PATH caching CACHE chunks, as\n"
+        "    block storage NAME)\n"
+        "  [ --block-rate:NAME=SPEC ] (limit I/O rate of block storage NAME, SPEC\n"
+        "    is a list of bytes=N,ops=N,bytes-burst=N,ops-burst=N)";
 }
 
 DECLARE_MODULE(block,
@@ -37,8 +37,11 @@
 #include <stdbool.h>
 #include <unistd.h>
 #include <assert.h>
+#include <inttypes.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <sys/uio.h>
+#include <time.h>
 
 #include "hvt.h"
 
@@ -75,27 +78,303 @@ typedef unsigned char *host_mvec_t;
 
 #endif
 
+/*
+ * Guest memory is scanned and written by up to DUMPCORE_MAX_THREADS threads,
+ * each handling an equal slice.
+ */
+#define DUMPCORE_MAX_THREADS 8
+
+/*
+ * When streaming the core to a pipe, gaps of up to DUMPCORE_MERGE_GAP bytes
+ * between dumped runs of memory are written out in full rather than starting
+ * a new PT_LOAD segment.
+ */
+#define DUMPCORE_MERGE_GAP (64 * 1024)
+
 static char *dumpcoredir;
-static int dir;
+static int dir = -1;
+static int dumpcore_fd = -1;
+
+/*
+ * A run of guest memory (start .. start + len) to be dumped, i.e. pages which
+ * are resident on the host and not all zero. All other guest memory is zero.
+ */
+struct dump_run {
+    uint64_t start;
+    uint64_t len;
+};
+
+/*
+ * Work for a single dump thread: scans guest pages (first_pg .. last_pg),
+ * and either writes each run found to (fd) at (data_offset) + the guest
+ * address, or, if (fd) is -1, records it in (runs).
+ */
+struct dump_slice {
+    struct hvt *hvt;
+    host_mvec_t mvec;
+    size_t page_size;
+    size_t first_pg;
+    size_t last_pg;
+    int fd;
+    off_t data_offset;
+    struct dump_run *runs;
+    size_t nruns;
+    size_t runs_size;
+    size_t ndumped;
+    bool failed;
+};
+
+static bool page_is_zero(const uint8_t *page, size_t page_size)
+{
+    const uint64_t *p = (const uint64_t *)page;
+    const uint64_t *end = (const uint64_t *)(page + page_size);
+
+    for (; p < end; p += 8) {
+        if (p[0] | p[1] | p[2] | p[3] | p[4] | p[5] | p[6] | p[7])
+            return false;
+    }
+    return true;
+}
+
+/*
+ * Write all of (count) bytes at (buf) to (fd), at (offset) or, if (offset)
+ * is -1, at the current position. Returns 0 on success, -1 on error.
+ */
+static int write_in_full(int fd, const void *buf, size_t count, off_t offset)
+{
+    const uint8_t *p = buf;
+
+    while (count > 0) {
+        ssize_t nbytes;
+
+        if (offset == -1)
+            nbytes = write(fd, p, count);
+        else
+            nbytes = pwrite(fd, p, count, offset);
+        if (nbytes == -1 && errno == EINTR)
+            continue;
+        else if (nbytes == -1)
+            return -1;
+        else if (nbytes == 0) {
+            errno = EIO;
+            return -1;
+        }
+        count -= nbytes;
+        p += nbytes;
+        if (offset != -1)
+            offset += nbytes;
+    }
+    return 0;
+}
+
+static bool slice_add_run(struct dump_slice *s, uint64_t start, uint64_t len)
+{
+    s->ndumped += len / s->page_size;
+    if (s->fd != -1) {
+        if (write_in_full(s->fd, s->hvt->mem + start, len,
+                    s->data_offset + start) == -1) {
+            warn("dumpcore: Error dumping guest memory at 0x%" PRIx64, start);
+            return false;
+        }
+        return true;
+    }
+    if (s->nruns == s->runs_size) {
+        size_t size = s->runs_size ? s->runs_size * 2 : 64;
+        struct dump_run *runs = realloc(s->runs, size * sizeof *runs);
+        if (runs == NULL) {
+            warn("dumpcore: realloc");
+            return false;
+        }
+        s->runs = runs;
+        s->runs_size = size;
+    }
+    s->runs[s->nruns].start = start;
+    s->runs[s->nruns].len = len;
+    s->nruns++;
+    return true;
+}
+
+static void *dump_slice_thread(void *arg)
+{
+    struct dump_slice *s = arg;
+    size_t run_first = 0;
+    bool in_run = false;
+
+    for (size_t pg = s->first_pg; pg <= s->last_pg; pg++) {
+        bool dump = pg < s->last_pg && (s->mvec[pg] & 1) &&
+            !page_is_zero(s->hvt->mem + pg * s->page_size, s->page_size);
+
+        if (dump && !in_run) {
+            run_first = pg;
+            in_run = true;
+        }
+        else if (!dump && in_run) {
+            in_run = false;
+            if (!slice_add_run(s, run_first * s->page_size,
+                        (pg - run_first) * s->page_size)) {
+                s->failed = true;
+                return NULL;
+            }
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Scan guest memory for runs to dump, splitting the work across (nslices)
+ * threads, and write them out as they are found if slices[].fd is set.
+ * Returns 0 on success, -1 on failure.
+ */
+static int dump_slices(struct dump_slice *slices, unsigned nslices)
+{
+    pthread_t threads[DUMPCORE_MAX_THREADS];
+    bool started[DUMPCORE_MAX_THREADS] = { false };
+    int rc = 0;
+
+    /*
+     * If a thread cannot be created, its slice is handled by the calling
+     * thread instead.
+     */
+    for (unsigned i = 1; i < nslices; i++)
+        started[i] = pthread_create(&threads[i], NULL, dump_slice_thread,
+                &slices[i]) == 0;
+    dump_slice_thread(&slices[0]);
+    for (unsigned i = 1; i < nslices; i++) {
+        if (started[i])
+            pthread_join(threads[i], NULL);
+        else
+            dump_slice_thread(&slices[i]);
+    }
+    for (unsigned i = 0; i < nslices; i++) {
+        if (slices[i].failed)
+            rc = -1;
+    }
+    return rc;
+}
+
+/*
+ * Concatenate the runs recorded by (slices), merging runs separated by gaps
+ * of up to (merge_gap) bytes. Returns the number of runs in (*out_runs), or
+ * -1 on failure.
+ */
+static ssize_t merge_runs(const struct dump_slice *slices, unsigned nslices,
+        uint64_t merge_gap, struct dump_run **out_runs)
+{
+    size_t total = 0, n = 0;
+
+    for (unsigned i = 0; i < nslices; i++)
+        total += slices[i].nruns;
+    struct dump_run *runs = malloc((total ? total : 1) * sizeof *runs);
+    if (runs == NULL)
+        return -1;
+    for (unsigned i = 0; i < nslices; i++) {
+        for (size_t j = 0; j < slices[i].nruns; j++) {
+            const struct dump_run *r = &slices[i].runs[j];
+
+            if (n > 0 &&
+                    r->start - (runs[n - 1].start + runs[n - 1].len)
+                    <= merge_gap)
+                runs[n - 1].len = r->start + r->len - runs[n - 1].start;
+            else
+                runs[n++] = *r;
+        }
+    }
+    *out_runs = runs;
+    return n;
+}
 
 void hvt_dumpcore_hook(struct hvt *hvt, int status, void *cookie)
 {
     if (status != 255) /* SOLO5_EXIT_ABORT */
         return;
 
-    char *filename;
-    assert(asprintf(&filename, "core.solo5-hvt.%d", getpid()) != -1);
+    char *filename = NULL;
+    int fd;
+    if (dumpcore_fd != -1) {
+        fd = dumpcore_fd;
+        warnx("dumpcore: dumping guest core to fd %d", fd);
+    }
+    else {
+        assert(asprintf(&filename, "core.solo5-hvt.%d", getpid()) != -1);
+        /*
+         * Note that O_APPEND must not be set as this modifies the behaviour
+         * of pwrite() on Linux.
+         */
+        fd = openat(dir, filename, O_WRONLY | O_CREAT | O_EXCL,
+                S_IRUSR | S_IWUSR);
+        close(dir);
+        if (fd < 0) {
+            warn("dumpcore: open(%s)", filename);
+            free(filename);
+            return;
+        }
+        warnx("dumpcore: dumping guest core to: %s/%s", dumpcoredir, filename);
+        free(filename);
+    }
+
+    struct timespec ts_start, ts_end;
+    clock_gettime(CLOCK_MONOTONIC, &ts_start);
+
     /*
-     * Note that O_APPEND must not be set as this modifies the behaviour of
-     * pwrite() on Linux.
+     * A core file is written sparsely with a single PT_LOAD segment covering
+     * all of guest memory, only writing out the runs of guest memory which
+     * are not known to be zero. A pipe cannot be written sparsely, so in that
+     * case each run gets its own PT_LOAD segment, with the zero memory up to
+     * the next run covered by (p_memsz), and the runs must be found before
+     * the headers can be written.
      */
-    int fd = openat(dir, filename, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
-    close(dir);
-    if (fd < 0) {
-        warn("dumpcore: open(%s)", filename);
+    bool stream = lseek(fd, 0, SEEK_CUR) == -1;
+
+    /*
+     * We use mincore() to get the host kernel's view of which pages have
+     * actually been touched by the guest, and skip those which have not, and
+     * those which are all zero. This speeds up the process of writing out the
+     * core file significantly by reducing memory pressure on the host and
+     * writing out a sparse file.
+     *
+     * Note that mincore() is definitely not portable, but the "mvec[pg] & 1"
+     * construct should be portable across at least Linux and FreeBSD.
+     */
+    struct dump_slice slices[DUMPCORE_MAX_THREADS] = { 0 };
+    struct dump_run *runs = NULL;
+    host_mvec_t mvec = NULL;
+    unsigned nslices = 0;
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (page_size == -1) {
+        warn("dumpcore: Could not determine _SC_PAGESIZE");
+        goto failure;
+    }
+    assert (hvt->mem_size % page_size == 0);
+    size_t npages = hvt->mem_size / page_size;
+    mvec = malloc(npages);
+    assert (mvec);
+    if (mincore(hvt->mem, hvt->mem_size, mvec) == -1) {
+        warn("dumpcore: mincore() failed");
+        goto failure;
+    }
+    long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+    nslices = (ncpus < 1) ? 1 :
+        (ncpus > DUMPCORE_MAX_THREADS) ? DUMPCORE_MAX_THREADS : ncpus;
+    if (nslices > npages)
+        nslices = 1;
+    for (unsigned i = 0; i < nslices; i++) {
+        slices[i].hvt = hvt;
+        slices[i].mvec = mvec;
+        slices[i].page_size = page_size;
+        slices[i].first_pg = npages * i / nslices;
+        slices[i].last_pg = npages * (i + 1) / nslices;
+        slices[i].fd = -1;
+    }
+
+    /*
+     * Guest memory is written with pwrite() at offsets relative to the start
+     * of the file, so if given a seekable fd write the headers there too,
+     * discarding anything it already contains.
+     */
+    if (!stream && (ftruncate(fd, 0) == -1 || lseek(fd, 0, SEEK_SET) == -1)) {
+        warn("dumpcore: Could not truncate core file");
         goto failure;
     }
-    warnx("dumpcore: dumping guest core to: %s/%s", dumpcoredir, filename);
 
     /*
      * Core file structure:
@@ -112,14 +391,42 @@ void hvt_dumpcore_hook(struct hvt *hvt, int status, void *cookie)
         .e_version = EV_CURRENT,
         .e_machine = EM_HOST,
         .e_ehsize = sizeof (Elf64_Ehdr),
-        .e_phnum = 2, /* PT_NOTE, PT_LOAD */
         .e_phentsize = sizeof (Elf64_Phdr),
         .e_phoff = offset,
     };
+
+    /*
+     * (2) PT_LOAD segments pointing to the guest memory dump: one per run if
+     * streaming, preceded by one covering any zero memory before the first
+     * run, otherwise a single segment.
+     */
+    ssize_t nruns = 0;
+    size_t nloads = 1;
+    if (stream) {
+        if (dump_slices(slices, nslices) == -1)
+            goto failure;
+        uint64_t merge_gap = DUMPCORE_MERGE_GAP;
+        for (;;) {
+            nruns = merge_runs(slices, nslices, merge_gap, &runs);
+            if (nruns == -1) {
+                warn("dumpcore: malloc");
+                goto failure;
+            }
+            nloads = nruns + (nruns == 0 || runs[0].start != 0);
+            /*
+             * e_phnum is 16 bits, and we need one more for PT_NOTE.
+             */
+            if (nloads < PN_XNUM - 1)
+                break;
+            free(runs);
+            merge_gap *= 2;
+        }
+    }
+    ehdr.e_phnum = 1 + nloads;
     offset += ehdr.e_phnum * sizeof (Elf64_Phdr);
 
     /*
-     * (2) PT_NOTE pointing to NT_PRSTATUS descriptor
+     * (3) PT_NOTE pointing to NT_PRSTATUS descriptor
      * name[] must be a multiple of the ELF word size, SVR4 uses "CORE".
      */
     const char name[8] = "CORE";
@@ -133,17 +440,41 @@ void hvt_dumpcore_hook(struct hvt *hvt, int status, void *cookie)
     };
     offset += pnote_size;
 
-    /*
-     * (3) PT_LOAD pointing to guest memory dump
-     */
-    Elf64_Phdr pload = {
-        .p_type = PT_LOAD,
-        .p_align = 0, .p_paddr = 0, .p_vaddr = 0,
-        .p_memsz = hvt->mem_size,
-        .p_filesz = hvt->mem_size,
-        .p_flags = 0,
-        .p_offset = offset
-    };
+    Elf64_Phdr *pload = calloc(nloads, sizeof (Elf64_Phdr));
+    assert (pload);
+    if (!stream) {
+        pload[0] = (Elf64_Phdr) {
+            .p_type = PT_LOAD,
+            .p_align = 0, .p_paddr = 0, .p_vaddr = 0,
+            .p_memsz = hvt->mem_size,
+            .p_filesz = hvt->mem_size,
+            .p_flags = 0,
+            .p_offset = offset
+        };
+    }
+    else {
+        size_t i = 0;
+        uint64_t data_offset = offset;
+        if (nruns == 0 || runs[0].start != 0) {
+            pload[i++] = (Elf64_Phdr) {
+                .p_type = PT_LOAD,
+                .p_memsz = nruns ? runs[0].start : hvt->mem_size,
+                .p_offset = data_offset
+            };
+        }
+        for (ssize_t r = 0; r < nruns; r++, i++) {
+            uint64_t next = (r + 1 < nruns) ? runs[r + 1].start :
+                hvt->mem_size;
+            pload[i] = (Elf64_Phdr) {
+                .p_type = PT_LOAD,
+                .p_paddr = runs[r].start, .p_vaddr = runs[r].start,
+                .p_memsz = next - runs[r].start,
+                .p_filesz = runs[r].len,
+                .p_offset = data_offset
+            };
+            data_offset += runs[r].len;
+        }
+    }
 
     /*
      * (4) NT_PRSTATUS descriptor
@@ -157,13 +488,16 @@ void hvt_dumpcore_hook(struct hvt *hvt, int status, void *cookie)
     struct iovec iov[] = {
         { .iov_base = &ehdr, .iov_len = sizeof ehdr },
         { .iov_base = &pnote, .iov_len = sizeof pnote },
-        { .iov_base = &pload, .iov_len = sizeof pload },
+        { .iov_base = pload, .iov_len = nloads * sizeof (Elf64_Phdr) },
         { .iov_base = &nhdr, .iov_len = sizeof nhdr },
         { .iov_base = (void *)name, .iov_len = nhdr.n_namesz }
     };
-    size_t iovlen = sizeof ehdr + sizeof pnote + sizeof pload + sizeof nhdr \
+    size_t iovlen = sizeof ehdr + sizeof pnote \
+                    + nloads * sizeof (Elf64_Phdr) + sizeof nhdr \
                     + nhdr.n_namesz;
-    if (writev(fd, iov, 5) != iovlen) {
+    ssize_t nbytes = writev(fd, iov, 5);
+    free(pload);
+    if (nbytes != iovlen) {
         warn("dumpcore: Error writing ELF headers");
         goto failure;
     }
@@ -178,84 +512,110 @@ void hvt_dumpcore_hook(struct hvt *hvt, int status, void *cookie)
 
     /*
      * (6) guest memory dump
-     *
-     * We use mincore() to get the host kernel's view of which pages have
-     * actually been touched by the guest. This speeds up the process of writing
-     * out the core file significantly by reducing memory pressure on the host
-     * and writing out a sparse file.
-     *
-     * Note that mincore() is definitely not portable, but the "mvec[pg] & 1"
-     * construct should be portable across at least Linux and FreeBSD.
      */
-    long page_size = sysconf(_SC_PAGESIZE);
-    if (page_size == -1) {
-        warn("dumpcore: Could not determine _SC_PAGESIZE");
-        goto failure;
-    }
-    assert (hvt->mem_size % page_size == 0);
-    size_t npages = hvt->mem_size / page_size;
     size_t ndumped = 0;
-    host_mvec_t mvec = malloc(npages);
-    assert (mvec);
-    if (mincore(hvt->mem, hvt->mem_size, mvec) == -1) {
-        warn("dumpcore: mincore() failed");
-        goto failure;
-    }
-    off_t start = lseek(fd, 0, SEEK_CUR);
-    for (size_t pg = 0; pg < npages; pg++) {
-        if (mvec[pg] & 1) {
-            off_t pgoff = (pg * page_size);
-            ssize_t nbytes =
-                pwrite(fd, hvt->mem + pgoff, page_size, start + pgoff);
-            if (nbytes == -1) {
-                warn("dumpcore: Error dumping guest memory page %zd", pg);
-                free(mvec);
-                goto failure;
-            }
-            else if (nbytes != page_size) {
-                warnx("dumpcore: Short write dumping guest memory page"
-                        "%zd: %zd bytes", pg, nbytes);
-                free(mvec);
+    if (stream) {
+        for (ssize_t r = 0; r < nruns; r++) {
+            if (write_in_full(fd, hvt->mem + runs[r].start, runs[r].len, -1)
+                    == -1) {
+                warn("dumpcore: Error dumping guest memory at 0x%" PRIx64,
+                        runs[r].start);
                 goto failure;
             }
-            ndumped++;
+            ndumped += runs[r].len / page_size;
+        }
+    }
+    else {
+        for (unsigned i = 0; i < nslices; i++) {
+            slices[i].fd = fd;
+            slices[i].data_offset = offset;
+        }
+        if (dump_slices(slices, nslices) == -1)
+            goto failure;
+        for (unsigned i = 0; i < nslices; i++)
+            ndumped += slices[i].ndumped;
+        /*
+         * Extend the file to its full size, leaving a hole after the last
+         * run dumped.
+         */
+        if (ftruncate(fd, offset + hvt->mem_size) == -1) {
+            warn("dumpcore: ftruncate() failed");
+            goto failure;
         }
     }
+
+    clock_gettime(CLOCK_MONOTONIC, &ts_end);
+    uint64_t elapsed_ms = (ts_end.tv_sec - ts_start.tv_sec) * 1000
+        + (ts_end.tv_nsec - ts_start.tv_nsec) / 1000000;
+    warnx("dumpcore: dumped %zu pages of total %zu pages in %" PRIu64
+            " ms using %u thread(s)", ndumped, npages, elapsed_ms, nslices);
+    for (unsigned i = 0; i < nslices; i++)
+        free(slices[i].runs);
+    free(runs);
     free(mvec);
-    warnx("dumpcore: dumped %zd pages of total %zd pages", ndumped, npages);
     close(fd);
     return;
 
 failure:
     warnx("dumpcore: error(s) dumping core, file may be incomplete");
+    for (unsigned i = 0; i < nslices; i++)
+        free(slices[i].runs);
+    free(runs);
+    free(mvec);
     close(fd);
 }
 
 static int handle_cmdarg(char *cmdarg, struct mft *mft)
 {
-    if (strncmp("--dumpcore=", cmdarg, 11))
-	return -1;
-    dumpcoredir = cmdarg + 11;
-
-    return 0;
+    if (strncmp("--dumpcore=", cmdarg, 11) == 0) {
+        dumpcoredir = cmdarg + 11;
+        return 0;
+    }
+    else if (strncmp("--dumpcore-fd=", cmdarg, 14) == 0) {
+        char *endp;
+        long fd = strtol(cmdarg + 14, &endp, 10);
+        if (*endp != '\0' || endp == cmdarg + 14 || fd < 0 || fd > INT_MAX)
+            errx(1, "dumpcore: invalid file descriptor: %s", cmdarg + 14);
+        dumpcore_fd = fd;
+        return 0;
+    }
+    else
+        return -1;
 }
 
 static char *usage(void)
 {
-    return "--dumpcore=DIR (enable guest core dump on abort/trap)";
+    return "--dumpcore=DIR (enable guest core dump on abort/trap)\n"
+        "  [ --dumpcore-fd=FD ] (dump guest core on abort/trap to already open\n"
+        "    file descriptor FD instead, e.g. a pipe to a collector)";
 }
 
 static int setup(struct hvt *hvt, struct mft *mft)
 {
-    if (dumpcoredir == NULL)
+    if (dumpcoredir == NULL && dumpcore_fd == -1)
         return 0; /* Not present */
+    if (dumpcoredir != NULL && dumpcore_fd != -1)
+        errx(1, "dumpcore: --dumpcore and --dumpcore-fd are mutually "
+                "exclusive");
+
+    if (dumpcore_fd != -1) {
+        int flags = fcntl(dumpcore_fd, F_GETFL);
+        if (flags == -1)
+            errx(1, "dumpcore: fd %d is not open", dumpcore_fd);
+        if ((flags & O_ACCMODE) == O_RDONLY)
+            errx(1, "dumpcore: fd %d is not writable", dumpcore_fd);
+        if (flags & O_APPEND)
+            errx(1, "dumpcore: fd %d must not be opened with O_APPEND",
+                    dumpcore_fd);
+    }
+    else {
+        dir = open(dumpcoredir, O_RDONLY | O_DIRECTORY);
+        if (dir == -1)
+            errx(1, "dumpcore: cannot open dir");
 
-    dir = open(dumpcoredir, O_RDONLY | O_DIRECTORY);
-    if (dir == -1)
-        errx(1, "dumpcore: cannot open dir");
-
-    if (access(dumpcoredir, W_OK) == -1)
-        errx(1, "dumpcore: dir not writable");
+        if (access(dumpcoredir, W_OK) == -1)
+            errx(1, "dumpcore: dir not writable");
+    }
 
     if (hvt_core_register_halt_hook(hvt_dumpcore_hook) == -1)
         return -1;
@@ -265,8 +625,9 @@ static int setup(struct hvt *hvt, struct mft *mft)
 
 #if HVT_FREEBSD_ENABLE_CAPSICUM
     cap_rights_t rights;
-    cap_rights_init(&rights, CAP_CREATE, CAP_WRITE, CAP_LOOKUP, CAP_SEEK);
-    if (cap_rights_limit(dir, &rights) == -1)
+    cap_rights_init(&rights, CAP_CREATE, CAP_WRITE, CAP_LOOKUP, CAP_SEEK,
+            CAP_FTRUNCATE);
+    if (cap_rights_limit(dumpcore_fd != -1 ? dumpcore_fd : dir, &rights) == -1)
         err(1, "cap_rights_limit() failed");
 #endif
 
@@ -29,6 +29,7 @@
  */
 
 #define _GNU_SOURCE
+#include <errno.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -44,7 +45,6 @@
 #include <netdb.h>
 #include <assert.h>
 #include <stdbool.h>
-#include <ctype.h>
 
 #include "hvt.h"
 #include "hvt_gdb.h"
@@ -76,10 +76,33 @@ static int socket_fd = 0;
 static int portno = 1234; /* Default port number */
 static const char hexchars[] = "0123456789abcdef";
 
+/*
+ * Set once the debugger has agreed to QStartNoAckMode, after which packets
+ * are neither acknowledged nor retransmitted.
+ */
+static bool no_ack_mode = false;
+
 #define BUFMAX                         4096
-static char in_buffer[BUFMAX];
 static unsigned char registers[BUFMAX];
 
+/*
+ * Maximum packet size (excluding framing) advertised to the debugger in the
+ * qSupported reply, which determines how much memory GDB will read or write
+ * per packet.
+ */
+#define PACKET_SIZE                    (128 * 1024)
+static char in_buffer[PACKET_SIZE + 1];
+static char out_buffer[PACKET_SIZE + 1];
+/* '$' <packet> '#' <checksum> */
+static char tx_buffer[PACKET_SIZE + 4];
+
+/*
+ * Data received from the debugger is buffered in rx_buffer[rx_head ..
+ * rx_tail).
+ */
+static unsigned char rx_buffer[64 * 1024];
+static size_t rx_head, rx_tail;
+
 /* The actual error code is ignored by GDB, so any number will do. */
 #define GDB_ERROR_MSG                  "E01"
 
@@ -196,46 +219,68 @@ static int wait_for_connect()
     return 0;
 }
 
+/*
+ * Send all of (count) bytes at (buf) to the debugger. Returns 0 on success,
+ * -1 on error.
+ */
+static int send_all(const char *buf, size_t count)
+{
+    while (count > 0) {
+        ssize_t ret = send(socket_fd, buf, count, 0);
+        if (ret == -1 && errno == EINTR)
+            continue;
+        else if (ret == -1)
+            return -1;
+        buf += ret;
+        count -= ret;
+    }
+    return 0;
+}
+
 static int send_char(char ch)
 {
-    /* TCP is already buffering, so no need to buffer here as well. */
-    return send(socket_fd, &ch, 1, 0);
+    return send_all(&ch, 1);
 }
 
-static char recv_char(void)
+/*
+ * Returns the next character received from the debugger, or -1 on error.
+ * Packets carrying binary data ('X') may contain any byte value.
+ */
+static int recv_char(void)
 {
-    unsigned char ch;
-    int ret;
+    if (rx_head == rx_tail) {
+        ssize_t ret;
 
-    ret = recv(socket_fd, &ch, 1, 0);
-    if (ret < 0) {
-        return -1;
-    } else if (ret == 0) {
-        /* The peer has performed an orderly shutdown (from "man recv"). */
-        close(socket_fd);
-        socket_fd = -1;
-        return -1;
-    } else {
-        assert(ret == 1);
+        do {
+            ret = recv(socket_fd, rx_buffer, sizeof rx_buffer, 0);
+        } while (ret == -1 && errno == EINTR);
+        if (ret < 0) {
+            return -1;
+        } else if (ret == 0) {
+            /* The peer has performed an orderly shutdown (from "man recv"). */
+            close(socket_fd);
+            socket_fd = -1;
+            return -1;
+        }
+        rx_head = 0;
+        rx_tail = ret;
     }
 
-    /* All GDB remote packets are encoded in ASCII. */
-    assert(isascii(ch));
-
-    return (char)ch;
+    return rx_buffer[rx_head++];
 }
 
 /*
  * Scan for the sequence $<data>#<checksum>
- * Returns a null terminated string.
+ * Returns a null terminated string, with its length (which may be larger than
+ * its strlen() for binary packets) in (*out_len).
  */
-static char *recv_packet(void)
+static char *recv_packet(size_t *out_len)
 {
     char *buffer = &in_buffer[0];
     unsigned char checksum;
     unsigned char xmitcsum;
-    char ch;
-    int count;
+    int ch;
+    size_t count;
 
     while (1) {
         /* wait around for the start character, ignore all other characters */
@@ -251,7 +296,7 @@ retry:
         count = 0;
 
         /* now, read until a # or end of buffer is found */
-        while (count < BUFMAX - 1) {
+        while (count < PACKET_SIZE) {
             ch = recv_char();
             if (ch == -1)
                 return NULL;
@@ -280,11 +325,11 @@ retry:
                 warnx("Failed checksum from GDB. "
                       "My count = 0x%x, sent=0x%x. buf=%s",
                       checksum, xmitcsum, buffer);
-                if (send_char('-') == -1)
+                if (!no_ack_mode && send_char('-') == -1)
                     /* Unsuccessful reply to a failed checksum */
                     err(1, "GDB: Could not send an ACK to the debugger.");
             } else {
-                if (send_char('+') == -1)
+                if (!no_ack_mode && send_char('+') == -1)
                     /* Unsuccessful reply to a successful transfer */
                     err(1, "GDB: Could not send an ACK to the debugger.");
 
@@ -293,9 +338,11 @@ retry:
                     send_char(buffer[0]);
                     send_char(buffer[1]);
 
+                    *out_len = count - 3;
                     return &buffer[3];
                 }
 
+                *out_len = count;
                 return &buffer[0];
             }
         }
@@ -303,49 +350,49 @@ retry:
 }
 
 /*
- * Send packet of the form $<packet info>#<checksum> without waiting for an ACK
- * from the debugger. Only send_response
+ * Send packet of the form $<packet info>#<checksum> with (len) bytes of packet
+ * info at (buffer), without waiting for an ACK from the debugger.
  */
-static void send_packet_no_ack(char *buffer)
+static void send_packet_no_ack_len(const char *buffer, size_t len)
 {
-    unsigned char checksum;
-    int count;
-    char ch;
+    unsigned char checksum = 0;
+
+    assert(len <= PACKET_SIZE);
+    tx_buffer[0] = '$';
+    for (size_t i = 0; i < len; i++) {
+        tx_buffer[i + 1] = buffer[i];
+        checksum += (unsigned char)buffer[i];
+    }
+    tx_buffer[len + 1] = '#';
+    tx_buffer[len + 2] = hexchars[checksum >> 4];
+    tx_buffer[len + 3] = hexchars[checksum % 16];
 
     /*
-     * We ignore all send_char errors as we either: (1) care about sending our
-     * packet and we will keep sending it until we get a good ACK from the
-     * debugger, or (2) not care and just send it as a best-effort notification
-     * when dying (see handle_hvt_exit).
+     * We ignore send errors as we either: (1) care about sending our packet
+     * and we will keep sending it until we get a good ACK from the debugger,
+     * or (2) not care and just send it as a best-effort notification when
+     * dying (see handle_hvt_exit).
      */
+    send_all(tx_buffer, len + 4);
+}
 
-    send_char('$');
-    checksum = 0;
-    count = 0;
-
-    ch = buffer[count];
-    while (ch) {
-        send_char(ch);
-        checksum += ch;
-        count += 1;
-        ch = buffer[count];
-    }
-
-    send_char('#');
-    send_char(hexchars[checksum >> 4]);
-    send_char(hexchars[checksum % 16]);
+static void send_packet_no_ack(const char *buffer)
+{
+    send_packet_no_ack_len(buffer, strlen(buffer));
 }
 
 /*
  * Send a packet and wait for a successful ACK of '+' from the debugger.
  * An ACK of '-' means that we have to resend.
  */
-static void send_packet(char *buffer)
+static void send_packet_len(const char *buffer, size_t len)
 {
-    char ch;
+    int ch;
 
     for (;;) {
-        send_packet_no_ack(buffer);
+        send_packet_no_ack_len(buffer, len);
+        if (no_ack_mode)
+            return;
         ch = recv_char();
         if (ch == -1)
             return;
@@ -354,6 +401,111 @@ static void send_packet(char *buffer)
     }
 }
 
+static void send_packet(const char *buffer)
+{
+    send_packet_len(buffer, strlen(buffer));
+}
+
+/*
+ * Binary data in packets escapes '#', '$', '}' and '*' as '}' followed by the
+ * original byte XORed with 0x20.
+ */
+#define ESCAPE_CHAR                    '}'
+
+/*
+ * Escapes up to (count) bytes of memory at (mem) into (buf) of (buf_size)
+ * bytes. Returns the number of bytes of memory escaped, and the number of
+ * bytes written to (buf) in (*out_len).
+ */
+static size_t mem2bin(const unsigned char *mem, size_t count, char *buf,
+                      size_t buf_size, size_t *out_len)
+{
+    size_t i, j = 0;
+
+    for (i = 0; i < count; i++) {
+        unsigned char ch = mem[i];
+
+        if (ch == '#' || ch == '$' || ch == ESCAPE_CHAR || ch == '*') {
+            if (j + 2 > buf_size)
+                break;
+            buf[j++] = ESCAPE_CHAR;
+            buf[j++] = ch ^ 0x20;
+        } else {
+            if (j + 1 > buf_size)
+                break;
+            buf[j++] = ch;
+        }
+    }
+    *out_len = j;
+    return i;
+}
+
+/*
+ * Unescapes (len) bytes of binary data at (buf) in place. Returns the length
+ * of the unescaped data, or -1 if the data is malformed.
+ */
+static ssize_t bin2mem(char *buf, size_t len)
+{
+    size_t i, j = 0;
+
+    for (i = 0; i < len; i++) {
+        if (buf[i] == ESCAPE_CHAR) {
+            if (++i == len)
+                return -1;
+            buf[j++] = buf[i] ^ 0x20;
+        } else
+            buf[j++] = buf[i];
+    }
+    return j;
+}
+
+/*
+ * Returns true if guest memory (addr .. addr + len) is valid.
+ */
+static bool guest_range_is_valid(struct hvt *hvt, hvt_gpa_t addr, size_t len)
+{
+    hvt_gpa_t result;
+
+    return !((addr > hvt->mem_size) ||
+             add_overflow(addr, len, result) ||
+             (result > hvt->mem_size));
+}
+
+/*
+ * Handle a qXfer:memory-map:read::OFFSET,LENGTH request in (annex), by
+ * sending the requested part of a memory map describing guest memory as a
+ * single RAM region.
+ */
+static void send_memory_map(struct hvt *hvt, const char *annex)
+{
+    char map[512];
+    size_t offset, len, map_len, out_len;
+
+    if (sscanf(annex, "%zx,%zx", &offset, &len) != 2) {
+        send_packet("E00");
+        return;
+    }
+    map_len = snprintf(map, sizeof map,
+            "<?xml version=\"1.0\"?>\n"
+            "<!DOCTYPE memory-map PUBLIC \"+//IDN gnu.org//DTD GDB Memory Map "
+            "V1.0//EN\" \"http://sourceware.org/gdb/gdb-memory-map.dtd\">\n"
+            "<memory-map>\n"
+            "  <memory type=\"ram\" start=\"0x0\" length=\"0x%zx\"/>\n"
+            "</memory-map>\n", hvt->mem_size);
+    assert(map_len < sizeof map);
+    if (offset > map_len) {
+        send_packet("E00");
+        return;
+    }
+    if (len > map_len - offset)
+        len = map_len - offset;
+    size_t n = mem2bin((unsigned char *)map + offset, len, out_buffer + 1,
+            PACKET_SIZE - 1, &out_len);
+    /* 'l': this is the last part, 'm': there is more. */
+    out_buffer[0] = (offset + n == map_len) ? 'l' : 'm';
+    send_packet_len(out_buffer, out_len + 1);
+}
+
 #define send_error_msg()   do { send_packet(GDB_ERROR_MSG); } while (0)
 
 #define send_not_supported_msg()   do { send_packet(""); } while (0)
@@ -372,7 +524,7 @@ static void send_packet(char *buffer)
  */
 static void send_response(char code, int sigval, bool wait_for_ack)
 {
-    char obuf[BUFMAX];
+    char obuf[8];
     snprintf(obuf, sizeof(obuf), "%c%02x", code, sigval);
     if (wait_for_ack)
         send_packet(obuf);
@@ -383,18 +535,18 @@ static void send_response(char code, int sigval, bool wait_for_ack)
 static void gdb_handle_exception(struct hvt *hvt, int sigval)
 {
     char *packet;
-    char obuf[BUFMAX];
+    size_t packet_len;
 
     /* Notify the debugger of our last signal */
     send_response('S', sigval, true);
 
     for (;;) {
-        hvt_gpa_t addr = 0, result;
+        hvt_gpa_t addr = 0;
         gdb_breakpoint_type type;
         size_t len;
         int command, ret;
 
-        packet = recv_packet();
+        packet = recv_packet(&packet_len);
         if (packet == NULL)
             /* Without a packet with instructions with what to do next there is
              * really nothing we can do to recover. So, dying. */
@@ -449,48 +601,112 @@ static void gdb_handle_exception(struct hvt *hvt, int sigval)
                 break;
             }
 
-            if ((addr > hvt->mem_size) ||
-                add_overflow(addr, len, result) ||
-                (result > hvt->mem_size)) {
+            if (!guest_range_is_valid(hvt, addr, len)) {
                 /* Don't panic about this, just return error so the debugger
                  * tries again. */
                 send_error_msg();
             } else {
-                mem2hex(hvt->mem + addr, obuf, len);
-                send_packet(obuf);
+                /* A short read is allowed if the reply would not fit. */
+                if (len > PACKET_SIZE / 2)
+                    len = PACKET_SIZE / 2;
+                mem2hex(hvt->mem + addr, out_buffer, len);
+                send_packet_len(out_buffer, 2 * len);
+            }
+            break; /* Wait for another command. */
+        }
+
+        case 'x': {
+            /* Read memory content, as binary data */
+            if (sscanf(packet, "x%"PRIx64",%zx",
+                       &addr, &len) != 2) {
+                send_error_msg();
+                break;
+            }
+
+            if (!guest_range_is_valid(hvt, addr, len)) {
+                send_error_msg();
+            } else {
+                /* A short read is allowed if the reply would not fit. */
+                size_t out_len;
+                out_buffer[0] = 'b';
+                mem2bin(hvt->mem + addr, len, out_buffer + 1, PACKET_SIZE - 1,
+                        &out_len);
+                send_packet_len(out_buffer, out_len + 1);
             }
             break; /* Wait for another command. */
         }
 
-        case 'M': {
+        case 'M':
             /* Write memory content */
-            assert(strlen(packet) <= sizeof(obuf));
-            if (sscanf(packet, "M%"PRIx64",%zx:%s", &addr, &len, obuf) != 3) {
+        case 'X': {
+            /* Write memory content, as binary data */
+            int data = -1;
+            if (sscanf(packet + 1, "%"PRIx64",%zx:%n", &addr, &len, &data)
+                    != 2 || data == -1) {
                 send_error_msg();
                 break;
             }
+            char *buf = packet + 1 + data;
+            size_t buf_len = packet_len - 1 - data;
 
-            if ((addr > hvt->mem_size) ||
-                add_overflow(addr, len, result) ||
-                (result > hvt->mem_size)) {
+            if (!guest_range_is_valid(hvt, addr, len)) {
                 /* Don't panic about this, just return error so the debugger
                  * tries again. */
                 send_error_msg();
+            } else if (command == 'M') {
+                if (buf_len != 2 * len) {
+                    send_error_msg();
+                    break;
+                }
+                hex2mem(buf, hvt->mem + addr, len);
+                send_okay_msg();
             } else {
-                hex2mem(obuf, hvt->mem + addr, len);
+                ssize_t n = bin2mem(buf, buf_len);
+                if (n == -1 || (size_t)n != len) {
+                    send_error_msg();
+                    break;
+                }
+                memcpy(hvt->mem + addr, buf, len);
                 send_okay_msg();
             }
             break; /* Wait for another command. */
         }
 
+        case 'q': {
+            /* General query */
+            if (strncmp(packet, "qSupported", 10) == 0) {
+                snprintf(out_buffer, sizeof out_buffer,
+                        "PacketSize=%x;QStartNoAckMode+;"
+                        "qXfer:memory-map:read+;binary-upload+",
+                        PACKET_SIZE);
+                send_packet(out_buffer);
+            } else if (strncmp(packet, "qXfer:memory-map:read::", 23) == 0) {
+                send_memory_map(hvt, packet + 23);
+            } else {
+                send_not_supported_msg();
+            }
+            break; /* Wait for another command. */
+        }
+
+        case 'Q': {
+            /* General set */
+            if (strcmp(packet, "QStartNoAckMode") == 0) {
+                send_okay_msg();
+                no_ack_mode = true;
+            } else {
+                send_not_supported_msg();
+            }
+            break; /* Wait for another command. */
+        }
+
         case 'g': {
             /* Read general registers */
             len = BUFMAX;
             if (hvt_gdb_read_registers(hvt, registers, &len) == -1) {
                 send_error_msg();
             } else {
-                mem2hex(registers, obuf, len);
-                send_packet(obuf);
+                mem2hex(registers, out_buffer, len);
+                send_packet(out_buffer);
             }
             break; /* Wait for another command. */
         }
@@ -530,9 +746,7 @@ static void gdb_handle_exception(struct hvt *hvt, int sigval)
                 break;
             }
 
-            if ((addr > hvt->mem_size) ||
-                add_overflow(addr, len, result) ||
-                (result > hvt->mem_size)) {
+            if (!guest_range_is_valid(hvt, addr, len)) {
                 /* Don't panic about this, just return error so the debugger
                  * tries again. */
                 send_error_msg();
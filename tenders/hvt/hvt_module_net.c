@@ -22,25 +22,459 @@
  * hvt_module_net.c: Network device module.
  */
 
+#define _GNU_SOURCE
 #include <assert.h>
 #include <err.h>
 #include <errno.h>
 #include <inttypes.h>
+#include <limits.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#endif
+
 #if HVT_FREEBSD_ENABLE_CAPSICUM
 #include <sys/capsicum.h>
 #endif
 
+#include "../common/shm_attach.h"
+#include "../common/net_capture.h"
+#include "../common/rate_limit.h"
 #include "../common/tap_attach.h"
+#include "../common/xdp_attach.h"
 #include "hvt.h"
 #include "solo5.h"
 
 static bool module_in_use;
 static struct mft *host_mft;
+/*
+ * AF_XDP and shared memory ports, indexed by manifest entry. NULL for tap
+ * devices.
+ */
+static struct xdp_port *xdp_ports[MFT_MAX_ENTRIES];
+static struct shm_net_port *shm_ports[MFT_MAX_ENTRIES];
+/*
+ * TAP interfaces, indexed by manifest entry. These are attached by setup(),
+ * once it is known whether offload has been requested with --net-offload.
+ */
+static char *tap_ifnames[MFT_MAX_ENTRIES];
+/*
+ * MTUs set with --net-mtu, indexed by manifest entry. 0 if not set.
+ */
+static uint16_t net_mtus[MFT_MAX_ENTRIES];
+/*
+ * Frame filters set with --net-filter, indexed by manifest entry.
+ */
+static struct tap_filter net_filters[MFT_MAX_ENTRIES];
+/*
+ * tx_dropped statistic of each filtered TAP interface at the time its filter
+ * was attached.
+ */
+static uint64_t net_filter_dropped[MFT_MAX_ENTRIES];
+/*
+ * Transmit rate limits set with --net-rate, indexed by manifest entry.
+ */
+static struct rate_limit net_rates[MFT_MAX_ENTRIES];
+/*
+ * Packet capture set with --net-capture, indexed by manifest entry. The
+ * capture is started by setup() once the MTU is known.
+ */
+static char *net_capture_paths[MFT_MAX_ENTRIES];
+static uint32_t net_capture_snaplens[MFT_MAX_ENTRIES];
+static uint32_t net_capture_nslots[MFT_MAX_ENTRIES];
+static struct net_capture *net_captures[MFT_MAX_ENTRIES];
+
+#define NET_DEFAULT_MTU 1500
+#define NET_MIN_MTU     68
+
+/*
+ * Determine the MTU of the network device (e) at manifest index (index):
+ * either as set with --net-mtu, or that of the attached TAP interface.
+ */
+static uint16_t net_mtu(struct mft_entry *e, unsigned index)
+{
+    unsigned max_mtu = UINT16_MAX;
+    if (xdp_ports[index] != NULL)
+        max_mtu = XDP_PORT_FRAME_SIZE - SOLO5_NET_HLEN;
+    else if (shm_ports[index] != NULL)
+        max_mtu = SHM_NET_MAX_PACKET - SOLO5_NET_HLEN;
+
+    unsigned mtu = net_mtus[index];
+    if (mtu != 0) {
+        if (mtu > max_mtu)
+            errx(1, "%s: MTU %u exceeds maximum of %u for this device",
+                    e->name, mtu, max_mtu);
+        return mtu;
+    }
+
+    mtu = NET_DEFAULT_MTU;
+    if (tap_ifnames[index] != NULL) {
+        int tap_mtu = tap_attach_get_mtu(e->b.hostfd, tap_ifnames[index]);
+        if (tap_mtu > 0)
+            mtu = tap_mtu;
+        else if (errno != ENOTSUP)
+            warn("%s: Could not determine MTU of %s, using %u", e->name,
+                    tap_ifnames[index], mtu);
+    }
+    return (mtu > max_mtu) ? max_mtu : mtu;
+}
+
+/*
+ * Transmit the frame (data, len) on the network device (e) at manifest index
+ * (index). If offload is enabled for (e), (hdr) points to its offload
+ * metadata, or is NULL if there is none.
+ */
+static solo5_result_t net_backend_write(struct mft_entry *e, unsigned index,
+        const uint8_t *hdr, const uint8_t *data, size_t len)
+{
+    struct xdp_port *port = xdp_ports[index];
+    if (port != NULL) {
+        if (len > XDP_PORT_FRAME_SIZE)
+            return SOLO5_R_EINVAL;
+        /*
+         * If no TX frames are available the packet is dropped.
+         */
+        if (xdp_port_write(port, data, len) == 0 &&
+                xdp_port_tx_need_wakeup(port))
+            (void)sendto(port->fd, NULL, 0, MSG_DONTWAIT, NULL, 0);
+        return SOLO5_R_OK;
+    }
+    struct shm_net_port *shm = shm_ports[index];
+    if (shm != NULL) {
+        if (len > SHM_NET_MAX_PACKET)
+            return SOLO5_R_EINVAL;
+        /*
+         * If the ring is full the packet is dropped.
+         */
+        if (shm_net_write(shm, data, len) == 1) {
+            uint64_t one = 1;
+            (void)write(shm->tx_fd, &one, sizeof one);
+        }
+        return SOLO5_R_OK;
+    }
+
+    if (e->u.net_basic.offload) {
+        static const uint8_t no_hdr[TAP_VNET_HDR_SIZE];
+        struct iovec iov[2] = {
+            { .iov_base = (void *)(hdr ? hdr : no_hdr),
+              .iov_len = TAP_VNET_HDR_SIZE },
+            { .iov_base = (void *)data, .iov_len = len }
+        };
+        /*
+         * The host rejects invalid offload metadata.
+         */
+        ssize_t ret = writev(e->b.hostfd, iov, 2);
+        return (ret == (ssize_t)(len + TAP_VNET_HDR_SIZE)) ?
+            SOLO5_R_OK : SOLO5_R_EINVAL;
+    }
+
+    int ret;
+
+    ret = write(e->b.hostfd, data, len);
+    assert(len == ret);
+    return SOLO5_R_OK;
+}
+
+/*
+ * As net_backend_write(), capturing the frame if enabled with --net-capture.
+ */
+static solo5_result_t net_write_frame(struct mft_entry *e, unsigned index,
+        const uint8_t *hdr, const uint8_t *data, size_t len)
+{
+    solo5_result_t rc = net_backend_write(e, index, hdr, data, len);
+
+    if (rc == SOLO5_R_OK && net_captures[index] != NULL)
+        net_capture_put(net_captures[index], CAPTURE_DIR_OUT, data, len);
+    return rc;
+}
+
+/*
+ * Returns true if a frame of (len) bytes may be transmitted on the network
+ * device at manifest index (index) without exceeding its --net-rate limit.
+ */
+static bool net_rate_take(unsigned index, size_t len)
+{
+    struct rate_limit *rl = &net_rates[index];
+
+    return !rate_limit_enabled(rl) ||
+        rate_limit_take(rl, rate_limit_clock(), len);
+}
+
+#if defined(__linux__)
+/*
+ * Asynchronous transmit state, indexed by manifest entry. If enabled with
+ * --net-async-tx, guest notifications are delivered to (efd) by the
+ * hypervisor, and a dedicated I/O thread transmits frames queued on the guest
+ * TX ring (ring). (lock) serialises the I/O thread against synchronous
+ * transmits from the VCPU thread.
+ */
+struct net_txring {
+    bool enabled;
+    int efd;
+    struct mft_entry *e;
+    unsigned index;
+    struct hvt_net_txring *ring;
+    uint32_t cons;
+    pthread_mutex_t lock;
+    pthread_t thread;
+};
+static struct net_txring txrings[MFT_MAX_ENTRIES];
+
+/*
+ * What txring_drain() does when the --net-rate limit is reached.
+ */
+enum txring_limit {
+    TXRING_LIMIT_FAIL,          /* Return false */
+    TXRING_LIMIT_WAIT,          /* Wait for it with (t->lock) released */
+    TXRING_LIMIT_IGNORE         /* Transmit regardless, e.g. at exit */
+};
+
+/*
+ * Transmit all frames queued on the guest TX ring of (t). Must be called with
+ * (t->lock) held. If the --net-rate limit is reached, act as per (limit).
+ */
+static bool txring_drain(struct net_txring *t, enum txring_limit limit)
+{
+    struct hvt_net_txring *r = t->ring;
+
+    for (;;) {
+        uint32_t prod = __atomic_load_n(&r->prod, __ATOMIC_ACQUIRE);
+        if (prod - t->cons > HVT_NET_TXRING_SLOTS)
+            errx(1, "%s: Invalid TX ring state: prod=%" PRIu32
+                    ", cons=%" PRIu32, t->e->name, prod, t->cons);
+        if (t->cons == prod)
+            return true;
+
+        unsigned slot = t->cons % HVT_NET_TXRING_SLOTS;
+        uint32_t len = r->len[slot];
+        if (len > HVT_NET_TXRING_FRAME_SIZE)
+            errx(1, "%s: Invalid TX ring frame length: %" PRIu32,
+                    t->e->name, len);
+        if (limit != TXRING_LIMIT_IGNORE && !net_rate_take(t->index, len)) {
+            if (limit == TXRING_LIMIT_FAIL)
+                return false;
+            uint64_t wait_ns = rate_limit_wait_ns(&net_rates[t->index]);
+            pthread_mutex_unlock(&t->lock);
+            rate_limit_sleep(wait_ns);
+            pthread_mutex_lock(&t->lock);
+            continue;
+        }
+        (void)net_write_frame(t->e, t->index, NULL, r->frame[slot], len);
+        t->cons++;
+        __atomic_store_n(&r->cons, t->cons, __ATOMIC_RELEASE);
+    }
+}
+
+static void *txring_thread(void *arg)
+{
+    struct net_txring *t = arg;
+    struct hvt_net_txring *r = t->ring;
+    uint64_t count;
+
+    for (;;) {
+        pthread_mutex_lock(&t->lock);
+        txring_drain(t, TXRING_LIMIT_WAIT);
+        /*
+         * Ask the guest for a notification before going to sleep, then check
+         * the ring once more so as not to miss a frame queued in between.
+         */
+        __atomic_store_n(&r->kick, 1, __ATOMIC_SEQ_CST);
+        bool idle = (__atomic_load_n(&r->prod, __ATOMIC_SEQ_CST) == t->cons);
+        pthread_mutex_unlock(&t->lock);
+
+        if (idle && read(t->efd, &count, sizeof count) == -1 &&
+                errno != EINTR)
+            err(1, "%s: read(eventfd) failed", t->e->name);
+        __atomic_store_n(&r->kick, 0, __ATOMIC_RELAXED);
+    }
+    return NULL;
+}
+
+static void hypercall_net_txring(struct hvt *hvt, hvt_gpa_t gpa)
+{
+    struct hvt_hc_net_txring *tr =
+        HVT_CHECKED_GPA_P(hvt, gpa, sizeof (struct hvt_hc_net_txring));
+    struct mft_entry *e = mft_get_by_index(host_mft, tr->handle,
+            MFT_DEV_NET_BASIC);
+    if (e == NULL) {
+        tr->ret = SOLO5_R_EINVAL;
+        return;
+    }
+
+    struct net_txring *t = &txrings[tr->handle];
+    if (!t->enabled) {
+        tr->ret = SOLO5_R_EUNSPEC;
+        return;
+    }
+    if (tr->ring == 0) {
+        tr->ret = SOLO5_R_OK;
+        return;
+    }
+    if (t->ring != NULL) {
+        tr->ret = SOLO5_R_EINVAL;
+        return;
+    }
+
+    t->ring = HVT_CHECKED_GPA_P(hvt, tr->ring,
+            sizeof (struct hvt_net_txring));
+    t->ring->prod = 0;
+    t->ring->cons = 0;
+    t->ring->kick = 1;
+    t->cons = 0;
+
+    /*
+     * Signals are handled by the VCPU thread only.
+     */
+    sigset_t all, saved;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &saved);
+    int rc = pthread_create(&t->thread, NULL, txring_thread, t);
+    if (rc != 0)
+        errx(1, "%s: Could not create I/O thread: %s", e->name, strerror(rc));
+    pthread_sigmask(SIG_SETMASK, &saved, NULL);
+    tr->ret = SOLO5_R_OK;
+}
+
+/*
+ * HVT_HYPERCALL_NET_NOTIFY is normally handled by the hypervisor, see
+ * hvt_ioeventfd_register(). If a notification reaches the tender
+ * nevertheless, forward it to the I/O thread.
+ */
+static void hypercall_net_notify(struct hvt *hvt, hvt_gpa_t gpa)
+{
+    if (gpa < MFT_MAX_ENTRIES && txrings[gpa].ring != NULL) {
+        uint64_t one = 1;
+        (void)write(txrings[gpa].efd, &one, sizeof one);
+    }
+}
+
+/*
+ * Transmit any frames still queued on guest TX rings before the tender exits.
+ * The --net-rate limit is not applied, so as not to delay exit for as long as
+ * the backlog would take to drain.
+ */
+static void txring_halt(struct hvt *hvt, int status, void *cookie)
+{
+    for (unsigned i = 0; i != MFT_MAX_ENTRIES; i++) {
+        struct net_txring *t = &txrings[i];
+        if (t->ring == NULL)
+            continue;
+        pthread_mutex_lock(&t->lock);
+        txring_drain(t, TXRING_LIMIT_IGNORE);
+        pthread_mutex_unlock(&t->lock);
+    }
+}
+
+static void txring_setup(struct hvt *hvt, struct mft *mft)
+{
+    assert(hvt_core_register_hypercall(HVT_HYPERCALL_NET_TXRING,
+                hypercall_net_txring) == 0);
+    assert(hvt_core_register_hypercall(HVT_HYPERCALL_NET_NOTIFY,
+                hypercall_net_notify) == 0);
+
+    bool in_use = false;
+    for (unsigned i = 0; i != mft->entries; i++) {
+        struct net_txring *t = &txrings[i];
+        if (!t->enabled)
+            continue;
+        t->efd = eventfd(0, EFD_CLOEXEC);
+        if (t->efd == -1)
+            err(1, "%s: eventfd() failed", mft->e[i].name);
+        if (hvt_ioeventfd_register(hvt, HVT_HYPERCALL_NET_NOTIFY, i,
+                    t->efd) == -1) {
+            warnx("%s: Asynchronous transmit not supported by hypervisor, "
+                    "disabled", mft->e[i].name);
+            close(t->efd);
+            t->enabled = false;
+            continue;
+        }
+        t->e = &mft->e[i];
+        t->index = i;
+        pthread_mutex_init(&t->lock, NULL);
+        in_use = true;
+    }
+    if (in_use)
+        assert(hvt_core_register_halt_hook(txring_halt) == 0);
+}
+#else /* !__linux__ */
+/*
+ * Asynchronous transmit is not supported on this host. The bindings ask for a
+ * TX ring for every network device at boot, so fail the request to have them
+ * fall back to HVT_HYPERCALL_NET_WRITE.
+ */
+static void hypercall_net_txring(struct hvt *hvt, hvt_gpa_t gpa)
+{
+    struct hvt_hc_net_txring *tr =
+        HVT_CHECKED_GPA_P(hvt, gpa, sizeof (struct hvt_hc_net_txring));
+
+    tr->ret = SOLO5_R_EUNSPEC;
+}
+
+/*
+ * No TX ring is ever registered, so there is nothing to notify.
+ */
+static void hypercall_net_notify(struct hvt *hvt, hvt_gpa_t gpa)
+{
+}
+
+static void txring_setup(struct hvt *hvt, struct mft *mft)
+{
+    assert(hvt_core_register_hypercall(HVT_HYPERCALL_NET_TXRING,
+                hypercall_net_txring) == 0);
+    assert(hvt_core_register_hypercall(HVT_HYPERCALL_NET_NOTIFY,
+                hypercall_net_notify) == 0);
+}
+#endif /* __linux__ */
+
+/*
+ * Report the number of frames dropped by interfaces with --net-filter since
+ * they were attached, before the tender exits. The host kernel counts frames
+ * rejected by the filter together with those dropped for other reasons, such
+ * as a full queue, so this is not reported as the filter's count alone.
+ */
+static void net_filter_halt(struct hvt *hvt, int status, void *cookie)
+{
+    for (unsigned i = 0; i != host_mft->entries; i++) {
+        uint64_t dropped;
+        if (!net_filters[i].enabled ||
+                tap_attach_get_dropped(host_mft->e[i].b.hostfd, &dropped) == -1)
+            continue;
+        warnx("%s: %" PRIu64 " frames dropped by interface (tx_dropped, "
+                "including --net-filter)", host_mft->e[i].name,
+                dropped - net_filter_dropped[i]);
+    }
+}
+
+/*
+ * Write out frames captured with --net-capture before the tender exits.
+ */
+static void net_capture_halt(struct hvt *hvt, int status, void *cookie)
+{
+    for (unsigned i = 0; i != host_mft->entries; i++) {
+        if (net_captures[i] != NULL)
+            net_capture_stop(net_captures[i], host_mft->e[i].name);
+    }
+}
+
+/*
+ * Report the time throttled by --net-rate before the tender exits.
+ */
+static void net_rate_halt(struct hvt *hvt, int status, void *cookie)
+{
+    for (unsigned i = 0; i != host_mft->entries; i++) {
+        if (rate_limit_enabled(&net_rates[i]))
+            rate_limit_report(host_mft->e[i].name, &net_rates[i]);
+    }
+}
 
 static void hypercall_net_write(struct hvt *hvt, hvt_gpa_t gpa)
 {
@@ -53,18 +487,43 @@ static void hypercall_net_write(struct hvt *hvt, hvt_gpa_t gpa)
         return;
     }
 
-    int ret;
-
-    ret = write(e->b.hostfd, HVT_CHECKED_GPA_P(hvt, wr->data, wr->len),
-            wr->len);
-    assert(wr->len == ret);
-    wr->ret = SOLO5_R_OK;
+    const uint8_t *data = HVT_CHECKED_GPA_P(hvt, wr->data, wr->len);
+    const uint8_t *hdr = NULL;
+    if (wr->offload != 0) {
+        if (!e->u.net_basic.offload) {
+            wr->ret = SOLO5_R_EINVAL;
+            return;
+        }
+        hdr = HVT_CHECKED_GPA_P(hvt, wr->offload, HVT_NET_OFFLOAD_SIZE);
+    }
+#if defined(__linux__)
+    /*
+     * Frames queued on the TX ring must go out first, to preserve ordering.
+     */
+    struct net_txring *t = &txrings[wr->handle];
+    if (t->ring != NULL) {
+        pthread_mutex_lock(&t->lock);
+        if (txring_drain(t, TXRING_LIMIT_FAIL) &&
+                net_rate_take(wr->handle, wr->len))
+            wr->ret = net_write_frame(e, wr->handle, hdr, data, wr->len);
+        else
+            wr->ret = SOLO5_R_AGAIN;
+        pthread_mutex_unlock(&t->lock);
+        return;
+    }
+#endif
+    if (!net_rate_take(wr->handle, wr->len)) {
+        wr->ret = SOLO5_R_AGAIN;
+        return;
+    }
+    wr->ret = net_write_frame(e, wr->handle, hdr, data, wr->len);
 }
 
-static void hypercall_net_read(struct hvt *hvt, hvt_gpa_t gpa)
+/*
+ * Receive a frame on the network device requested by the guest in (rd).
+ */
+static void net_read_frame(struct hvt *hvt, struct hvt_hc_net_read *rd)
 {
-    struct hvt_hc_net_read *rd =
-        HVT_CHECKED_GPA_P(hvt, gpa, sizeof (struct hvt_hc_net_read));
     struct mft_entry *e = mft_get_by_index(host_mft, rd->handle,
             MFT_DEV_NET_BASIC);
     if (e == NULL) {
@@ -72,6 +531,64 @@ static void hypercall_net_read(struct hvt *hvt, hvt_gpa_t gpa)
         return;
     }
 
+    struct xdp_port *port = xdp_ports[rd->handle];
+    if (port != NULL) {
+        size_t len = xdp_port_read(port,
+                HVT_CHECKED_GPA_P(hvt, rd->data, rd->len), rd->len);
+        if (len == 0) {
+            rd->ret = SOLO5_R_AGAIN;
+            return;
+        }
+        rd->len = len;
+        rd->ret = SOLO5_R_OK;
+        return;
+    }
+    struct shm_net_port *shm = shm_ports[rd->handle];
+    if (shm != NULL) {
+        uint8_t *data = HVT_CHECKED_GPA_P(hvt, rd->data, rd->len);
+        size_t len = shm_net_read(shm, data, rd->len);
+        if (len == 0) {
+            uint64_t count;
+            (void)read(shm->rx_fd, &count, sizeof count);
+            len = shm_net_read(shm, data, rd->len);
+        }
+        if (len == 0) {
+            rd->ret = SOLO5_R_AGAIN;
+            return;
+        }
+        rd->len = len;
+        rd->ret = SOLO5_R_OK;
+        return;
+    }
+
+    if (e->u.net_basic.offload != (rd->offload != 0)) {
+        rd->ret = SOLO5_R_EINVAL;
+        return;
+    }
+    if (e->u.net_basic.offload) {
+        struct iovec iov[2] = {
+            { .iov_base = HVT_CHECKED_GPA_P(hvt, rd->offload,
+                    HVT_NET_OFFLOAD_SIZE),
+              .iov_len = TAP_VNET_HDR_SIZE },
+            { .iov_base = HVT_CHECKED_GPA_P(hvt, rd->data, rd->len),
+              .iov_len = rd->len }
+        };
+        ssize_t ret = readv(e->b.hostfd, iov, 2);
+        /*
+         * The host returns the full length of a packet which has been
+         * truncated to fit, drop such packets.
+         */
+        if (ret == 0 || (ret == -1 && errno == EAGAIN) ||
+                (ret > 0 && (size_t)ret - TAP_VNET_HDR_SIZE > rd->len)) {
+            rd->ret = SOLO5_R_AGAIN;
+            return;
+        }
+        assert(ret >= TAP_VNET_HDR_SIZE);
+        rd->len = ret - TAP_VNET_HDR_SIZE;
+        rd->ret = SOLO5_R_OK;
+        return;
+    }
+
     int ret;
 
     ret = read(e->b.hostfd, HVT_CHECKED_GPA_P(hvt, rd->data, rd->len), rd->len);
@@ -85,45 +602,91 @@ static void hypercall_net_read(struct hvt *hvt, hvt_gpa_t gpa)
     rd->ret = SOLO5_R_OK;
 }
 
+static void hypercall_net_read(struct hvt *hvt, hvt_gpa_t gpa)
+{
+    struct hvt_hc_net_read *rd =
+        HVT_CHECKED_GPA_P(hvt, gpa, sizeof (struct hvt_hc_net_read));
+
+    net_read_frame(hvt, rd);
+    if (rd->ret == SOLO5_R_OK && net_captures[rd->handle] != NULL)
+        net_capture_put(net_captures[rd->handle], CAPTURE_DIR_IN,
+                HVT_CHECKED_GPA_P(hvt, rd->data, rd->len), rd->len);
+}
+
 static int handle_cmdarg(char *cmdarg, struct mft *mft)
 {
     enum {
         opt_net,
-        opt_net_mac
+        opt_net_mac,
+        opt_net_async_tx,
+        opt_net_offload,
+        opt_net_mtu,
+        opt_net_filter,
+        opt_net_rate,
+        opt_net_capture
     } which;
 
     if (strncmp("--net:", cmdarg, 6) == 0)
         which = opt_net;
     else if (strncmp("--net-mac:", cmdarg, 10) == 0)
         which = opt_net_mac;
+    else if (strncmp("--net-async-tx:", cmdarg, 15) == 0)
+        which = opt_net_async_tx;
+    else if (strncmp("--net-offload:", cmdarg, 14) == 0)
+        which = opt_net_offload;
+    else if (strncmp("--net-mtu:", cmdarg, 10) == 0)
+        which = opt_net_mtu;
+    else if (strncmp("--net-filter:", cmdarg, 13) == 0)
+        which = opt_net_filter;
+    else if (strncmp("--net-rate:", cmdarg, 11) == 0)
+        which = opt_net_rate;
+    else if (strncmp("--net-capture:", cmdarg, 14) == 0)
+        which = opt_net_capture;
     else
         return -1;
 
     char name[MFT_NAME_SIZE];
-    char iface[20]; /* XXX should be IFNAMSIZ, needs extra header here */
+    char iface[PATH_MAX + 1]; /* Also holds "shm:" PATH */
     int rc;
     if (which == opt_net) {
         rc = sscanf(cmdarg,
                 "--net:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]="
-                "%19s", name, iface);
+                "%" XSTR(PATH_MAX) "s", name, iface);
         if (rc != 2)
             return -1;
+        unsigned index;
         struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
-                NULL);
+                &index);
         if (e == NULL) {
             warnx("Resource not declared in manifest: '%s'", name);
             return -1;
         }
-        int fd = tap_attach(iface);
-        if (fd < 0) {
-            warnx("Could not attach interface: %s", iface);
-            return -1;
+        int fd;
+        if (strncmp("xdp:", iface, 4) == 0) {
+            uint8_t mac[6], no_mac[6] = { 0 };
+            xdp_ports[index] = xdp_attach(iface + 4, mac);
+            fd = xdp_ports[index]->fd;
+            /*
+             * Default to the MAC address of the interface, unless one has
+             * already been set by --net-mac.
+             */
+            if (memcmp(e->u.net_basic.mac, no_mac, sizeof no_mac) == 0)
+                memcpy(e->u.net_basic.mac, mac, sizeof mac);
+        }
+        else if (strncmp("shm:", iface, 4) == 0) {
+            shm_ports[index] = shm_attach(iface + 4);
+            fd = shm_ports[index]->rx_fd;
+        }
+        else {
+            tap_ifnames[index] = strdup(iface);
+            if (tap_ifnames[index] == NULL)
+                err(1, "strdup");
+            fd = -1;
         }
 
         /* e->u.net_basic.mac[] is set either by option or generated later by
-         * setup().
+         * setup(), as is e->u.net_basic.mtu.
          */
-        e->u.net_basic.mtu = 1500; /* TODO */
         e->b.hostfd = fd;
         e->attached = true;
         module_in_use = true;
@@ -146,6 +709,111 @@ static int handle_cmdarg(char *cmdarg, struct mft *mft)
         }
         memcpy(e->u.net_basic.mac, mac, sizeof mac);
     }
+    else if (which == opt_net_async_tx) {
+        rc = sscanf(cmdarg,
+                "--net-async-tx:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]", name);
+        if (rc != 1)
+            return -1;
+        unsigned index;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
+                &index);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+#if defined(__linux__)
+        txrings[index].enabled = true;
+#else
+        warnx("%s: Asynchronous transmit is not supported on this host", name);
+        return -1;
+#endif
+    }
+    else if (which == opt_net_offload) {
+        rc = sscanf(cmdarg,
+                "--net-offload:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]", name);
+        if (rc != 1)
+            return -1;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
+                NULL);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        e->u.net_basic.offload = true;
+    }
+    else if (which == opt_net_mtu) {
+        unsigned mtu;
+        rc = sscanf(cmdarg,
+                "--net-mtu:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]=%u", name, &mtu);
+        if (rc != 2)
+            return -1;
+        unsigned index;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
+                &index);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        if (mtu < NET_MIN_MTU || mtu > UINT16_MAX) {
+            warnx("%s: Invalid MTU: %u", name, mtu);
+            return -1;
+        }
+        net_mtus[index] = mtu;
+    }
+    else if (which == opt_net_filter) {
+        int n = 0;
+        rc = sscanf(cmdarg,
+                "--net-filter:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]%n", name, &n);
+        if (rc != 1 || (cmdarg[n] != '\0' && cmdarg[n] != '='))
+            return -1;
+        unsigned index;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
+                &index);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        if (cmdarg[n] == '=' &&
+                tap_filter_add_mcast(&net_filters[index], &cmdarg[n + 1]) == -1)
+            return -1;
+        net_filters[index].enabled = true;
+    }
+    else if (which == opt_net_rate) {
+        char spec[64];
+        rc = sscanf(cmdarg,
+                "--net-rate:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]=%63s", name,
+                spec);
+        if (rc != 2)
+            return -1;
+        unsigned index;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
+                &index);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        if (rate_limit_parse(&net_rates[index], spec) == -1)
+            return -1;
+    }
+    else if (which == opt_net_capture) {
+        char spec[PATH_MAX + 1];
+        rc = sscanf(cmdarg,
+                "--net-capture:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]="
+                "%" XSTR(PATH_MAX) "s", name, spec);
+        if (rc != 2)
+            return -1;
+        unsigned index;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
+                &index);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        if (net_capture_parse(spec, &net_capture_paths[index],
+                    &net_capture_snaplens[index],
+                    &net_capture_nslots[index]) == -1)
+            return -1;
+    }
 
     return 0;
 }
@@ -160,14 +828,57 @@ static int setup(struct hvt *hvt, struct mft *mft)
                 hypercall_net_write) == 0);
     assert(hvt_core_register_hypercall(HVT_HYPERCALL_NET_READ,
                 hypercall_net_read) == 0);
+    txring_setup(hvt, mft);
+
+    bool filter_in_use = false, rate_in_use = false, capture_in_use = false;
 
     for (unsigned i = 0; i != mft->entries; i++) {
         if (mft->e[i].type != MFT_DEV_NET_BASIC || !mft->e[i].attached)
             continue;
+        if (tap_ifnames[i] != NULL) {
+            mft->e[i].b.hostfd = tap_attach(tap_ifnames[i],
+                    mft->e[i].u.net_basic.offload);
+            if (mft->e[i].b.hostfd < 0)
+                err(1, "Could not attach interface: %s", tap_ifnames[i]);
+        }
+        else if (mft->e[i].u.net_basic.offload)
+            errx(1, "%s: Offload is only supported on tap interfaces",
+                    mft->e[i].name);
+        mft->e[i].u.net_basic.mtu = net_mtu(&mft->e[i], i);
         char no_mac[6] = { 0 };
         if (memcmp(mft->e[i].u.net_basic.mac, no_mac, sizeof no_mac) == 0)
             tap_attach_genmac(mft->e[i].u.net_basic.mac);
+        if (net_filters[i].enabled) {
+            if (tap_ifnames[i] == NULL)
+                errx(1, "%s: Filtering is only supported on tap interfaces",
+                        mft->e[i].name);
+            if (tap_attach_filter(mft->e[i].b.hostfd,
+                        mft->e[i].u.net_basic.mac, &net_filters[i]) == -1)
+                err(1, "%s: Could not attach filter", mft->e[i].name);
+            if (tap_attach_get_dropped(mft->e[i].b.hostfd,
+                        &net_filter_dropped[i]) == 0 && !filter_in_use) {
+                assert(hvt_core_register_halt_hook(net_filter_halt) == 0);
+                filter_in_use = true;
+            }
+        }
         assert(hvt_core_register_pollfd(mft->e[i].b.hostfd, i) == 0);
+        if (rate_limit_enabled(&net_rates[i]) && !rate_in_use) {
+            assert(hvt_core_register_halt_hook(net_rate_halt) == 0);
+            rate_in_use = true;
+        }
+        if (net_capture_paths[i] != NULL) {
+            uint32_t snaplen = net_capture_snaplens[i];
+            if (snaplen == 0)
+                snaplen = mft->e[i].u.net_basic.offload ?
+                    SOLO5_NET_OFFLOAD_MAX_PACKET :
+                    mft->e[i].u.net_basic.mtu + SOLO5_NET_HLEN;
+            net_captures[i] = net_capture_open(net_capture_paths[i],
+                    mft->e[i].name, snaplen, net_capture_nslots[i]);
+            if (!capture_in_use) {
+                assert(hvt_core_register_halt_hook(net_capture_halt) == 0);
+                capture_in_use = true;
+            }
+        }
     }
 
 #if HVT_FREEBSD_ENABLE_CAPSICUM
@@ -182,8 +893,22 @@ static int setup(struct hvt *hvt, struct mft *mft)
 
 static char *usage(void)
 {
-    return "--net:NAME=IFACE | @NN (attach tap at IFACE or at fd @NN as network NAME)\n"
-        "  [ --net-mac:NAME=HWADDR ] (set HWADDR for network NAME)";
+    return "--net:NAME=IFACE | @NN | xdp:IFACE[:QUEUE] | shm:PATH (attach tap at IFACE,\n"
+        "    at fd @NN, queue QUEUE of IFACE using AF_XDP, or shared memory link\n"
+        "    with rendezvous socket PATH as network NAME)\n"
+        "  [ --net-mac:NAME=HWADDR ] (set HWADDR for network NAME)\n"
+        "  [ --net-async-tx:NAME ] (transmit on network NAME from a host I/O\n"
+        "    thread)\n"
+        "  [ --net-offload:NAME ] (enable checksum and segmentation offload for\n"
+        "    network NAME)\n"
+        "  [ --net-mtu:NAME=MTU ] (set MTU for network NAME, default is the MTU\n"
+        "    of IFACE for tap)\n"
+        "  [ --net-filter:NAME[=HWADDR,...] ] (drop frames on network NAME not\n"
+        "    addressed to it, broadcast, or multicast group HWADDR)\n"
+        "  [ --net-rate:NAME=SPEC ] (limit transmit rate of network NAME, SPEC is\n"
+        "    a list of bytes=N,ops=N,bytes-burst=N,ops-burst=N)\n"
+        "  [ --net-capture:NAME=FILE[,SNAPLEN[,RINGSIZE]] ] (capture frames on\n"
+        "    network NAME to pcapng FILE)";
 }
 
 DECLARE_MODULE(net,
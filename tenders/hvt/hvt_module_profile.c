@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * hvt_module_profile.c: Sampling guest profiler.
+ *
+ * At a fixed frequency of VCPU thread CPU time, the guest is interrupted and
+ * the program counter and frame pointer chain are sampled from guest state.
+ * Samples are symbolized against the guest ELF symbol table and aggregated;
+ * on exit, they are written out in "collapsed stack" format as used by
+ * flamegraph.pl and similar tools.
+ *
+ * Full stacks require the guest to be built with -fno-omit-frame-pointer;
+ * otherwise, only the function containing the program counter is reliable.
+ */
+
+#define _GNU_SOURCE
+#include <assert.h>
+#include <err.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hvt.h"
+
+#if defined(__linux__) && defined(__x86_64__)
+
+#include "hvt_profile_kvm_x86_64.c"
+
+#else
+
+int hvt_profile_supported(void)
+{
+    return -1;
+}
+
+int hvt_profile_start(struct hvt *hvt, int signo, unsigned hz)
+{
+    return -1;
+}
+
+int hvt_profile_read_regs(struct hvt *hvt, uint64_t *pc, uint64_t *fp)
+{
+    return -1;
+}
+
+#endif
+
+#define PROFILE_DEFAULT_HZ 99
+#define PROFILE_MAX_HZ 10000
+#define PROFILE_MAX_DEPTH 64
+
+/*
+ * A unique stack, identified by the list of (frames) from leaf to root. Each
+ * frame is the start address of the containing function if known, otherwise
+ * the raw sampled address.
+ */
+struct profile_stack {
+    uint64_t count;
+    unsigned depth;
+    uint64_t frames[];
+};
+
+static const char *profile_file;
+static unsigned profile_hz = PROFILE_DEFAULT_HZ;
+static FILE *profile_fp;
+static struct elf_symtab symtab;
+static bool have_symtab;
+
+/*
+ * Open-addressed hash table of unique stacks, (table_size) is a power of 2.
+ */
+static struct profile_stack **table;
+static size_t table_size;
+static size_t table_used;
+static uint64_t nsamples;
+
+static uint64_t hash_frames(const uint64_t *frames, unsigned depth)
+{
+    uint64_t h = 0xcbf29ce484222325ULL; /* FNV-1a */
+
+    for (unsigned i = 0; i < depth; i++) {
+        h ^= frames[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+static void table_insert(struct profile_stack *s)
+{
+    size_t mask = table_size - 1;
+    size_t i = hash_frames(s->frames, s->depth) & mask;
+
+    while (table[i] != NULL)
+        i = (i + 1) & mask;
+    table[i] = s;
+}
+
+static void table_grow(void)
+{
+    struct profile_stack **old = table;
+    size_t old_size = table_size;
+
+    table_size = old_size ? old_size * 2 : 1024;
+    table = calloc(table_size, sizeof (struct profile_stack *));
+    if (table == NULL)
+        err(1, "profile: calloc");
+    for (size_t i = 0; i < old_size; i++)
+        if (old[i] != NULL)
+            table_insert(old[i]);
+    free(old);
+}
+
+static void record(const uint64_t *frames, unsigned depth)
+{
+    if (table_used * 4 >= table_size * 3)
+        table_grow();
+
+    size_t mask = table_size - 1;
+    size_t i = hash_frames(frames, depth) & mask;
+    while (table[i] != NULL) {
+        if (table[i]->depth == depth &&
+                memcmp(table[i]->frames, frames, depth * sizeof *frames) == 0) {
+            table[i]->count++;
+            return;
+        }
+        i = (i + 1) & mask;
+    }
+
+    struct profile_stack *s = malloc(sizeof (struct profile_stack) +
+            depth * sizeof *frames);
+    if (s == NULL)
+        err(1, "profile: malloc");
+    s->count = 1;
+    s->depth = depth;
+    memcpy(s->frames, frames, depth * sizeof *frames);
+    table[i] = s;
+    table_used++;
+}
+
+static uint64_t frame_key(uint64_t addr)
+{
+    const struct elf_sym *sym;
+
+    if (have_symtab && (sym = elf_symtab_lookup(&symtab, addr)) != NULL)
+        return sym->addr;
+    return addr;
+}
+
+static void sample(struct hvt *hvt, uint64_t pc, uint64_t fp)
+{
+    uint64_t frames[PROFILE_MAX_DEPTH];
+    unsigned depth = 0;
+
+    frames[depth++] = frame_key(pc);
+    /*
+     * Walk the frame pointer chain. Guest virtual addresses are identical to
+     * guest physical addresses, so we can read guest memory directly. Each
+     * frame record is (saved frame pointer, return address); stop at the
+     * first record which is not within guest memory, is misaligned, or does
+     * not move towards the root of the stack.
+     */
+    while (depth < PROFILE_MAX_DEPTH) {
+        uint64_t *record_p, next_fp, ret;
+
+        if (fp == 0 || (fp & 7) || fp >= hvt->mem_size ||
+                hvt->mem_size - fp < 2 * sizeof (uint64_t))
+            break;
+        record_p = (uint64_t *)(hvt->mem + fp);
+        next_fp = record_p[0];
+        ret = record_p[1];
+        if (ret == 0)
+            break;
+        /*
+         * Use (ret - 1) to attribute the frame to the call instruction, which
+         * may be the last instruction of the calling function.
+         */
+        frames[depth++] = frame_key(ret - 1);
+        if (next_fp <= fp)
+            break;
+        fp = next_fp;
+    }
+
+    record(frames, depth);
+    nsamples++;
+}
+
+static void write_frame(uint64_t key, bool last)
+{
+    const struct elf_sym *sym = NULL;
+
+    if (have_symtab)
+        sym = elf_symtab_lookup(&symtab, key);
+    if (sym != NULL && sym->addr == key)
+        fprintf(profile_fp, "%s", sym->name);
+    else
+        fprintf(profile_fp, "0x%" PRIx64, key);
+    if (!last)
+        fputc(';', profile_fp);
+}
+
+static void write_profile(void)
+{
+    if (profile_fp == NULL)
+        return;
+
+    for (size_t i = 0; i < table_size; i++) {
+        struct profile_stack *s = table[i];
+
+        if (s == NULL)
+            continue;
+        /*
+         * Collapsed stack format lists frames from the root to the leaf.
+         */
+        for (unsigned f = s->depth; f > 0; f--)
+            write_frame(s->frames[f - 1], f == 1);
+        fprintf(profile_fp, " %" PRIu64 "\n", s->count);
+    }
+    if (fclose(profile_fp) != 0)
+        warn("profile: %s", profile_file);
+    else
+        warnx("profile: wrote %" PRIu64 " samples (%zu unique stacks) to %s",
+                nsamples, table_used, profile_file);
+    profile_fp = NULL;
+}
+
+static int handle_exit(struct hvt *hvt)
+{
+    uint64_t pc, fp;
+
+    if (hvt_profile_read_regs(hvt, &pc, &fp) == -1)
+        return -1;
+    sample(hvt, pc, fp);
+    return 0;
+}
+
+static void handle_signal(int signo)
+{
+    /*
+     * Nothing to do, the purpose of the signal is to interrupt KVM_RUN.
+     */
+}
+
+static int handle_cmdarg(char *cmdarg, struct mft *mft)
+{
+    if (strncmp("--x-profile=", cmdarg, 12))
+        return -1;
+
+    char *file = strdup(cmdarg + 12);
+    if (file == NULL)
+        err(1, "profile: strdup");
+    char *hz = strchr(file, ',');
+    if (hz != NULL) {
+        char *end;
+
+        *hz++ = '\0';
+        errno = 0;
+        unsigned long v = strtoul(hz, &end, 10);
+        if (errno || *end != '\0' || v < 1 || v > PROFILE_MAX_HZ) {
+            warnx("profile: HZ must be between 1 and %d", PROFILE_MAX_HZ);
+            free(file);
+            return -1;
+        }
+        profile_hz = v;
+    }
+    if (*file == '\0') {
+        free(file);
+        return -1;
+    }
+    profile_file = file;
+
+    return 0;
+}
+
+static int setup(struct hvt *hvt, struct mft *mft)
+{
+    if (profile_file == NULL)
+        return 0; /* Not present */
+
+    if (hvt_profile_supported() == -1)
+        errx(1, "profile: not implemented for this backend/architecture");
+
+    profile_fp = fopen(profile_file, "w");
+    if (profile_fp == NULL)
+        err(1, "profile: %s", profile_file);
+
+    assert(hvt->elf_fd != -1);
+    if (elf_load_symtab(hvt->elf_fd, hvt->elf_filename, &symtab) == 0)
+        have_symtab = true;
+    else
+        warnx("profile: %s: No symbol table found, samples will not be"
+                " symbolized", hvt->elf_filename);
+
+    if (hvt_core_register_vmexit(handle_exit) == -1)
+        return -1;
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof sa);
+    sa.sa_handler = handle_signal;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(SIGPROF, &sa, NULL) == -1)
+        err(1, "profile: sigaction");
+
+    /*
+     * The profile is written on any exit of the tender, including on
+     * termination by a signal.
+     */
+    atexit(write_profile);
+
+    if (hvt_profile_start(hvt, SIGPROF, profile_hz) == -1)
+        errx(1, "profile: could not start sampling");
+
+    return 0;
+}
+
+static char *usage(void)
+{
+    return "--x-profile=FILE[,HZ] (sample guest stacks at HZ, default 99,"
+        " writing a collapsed stack profile to FILE on exit)";
+}
+
+DECLARE_MODULE(profile,
+    .setup = setup,
+    .handle_cmdarg = handle_cmdarg,
+    .usage = usage
+)
@@ -216,3 +216,11 @@ int hvt_guest_mprotect(void *t_arg, uint64_t addr_start, uint64_t addr_end,
 #endif
     return ret;
 }
+
+int hvt_ioeventfd_register(struct hvt *hvt, int nr, uint32_t data, int fd)
+{
+    /*
+     * Not supported by OpenBSD vmm.
+     */
+    return -1;
+}
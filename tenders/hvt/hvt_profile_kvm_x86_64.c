@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * hvt_profile_kvm_x86_64.c: Glue between the profile module and KVM.
+ */
+
+#include <signal.h>
+#include <time.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/kvm.h>
+
+#include "hvt.h"
+#include "hvt_kvm.h"
+
+int hvt_profile_supported(void)
+{
+    return 0;
+}
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+static int profile_signo;
+
+int hvt_profile_start(struct hvt *hvt, int signo, unsigned hz)
+{
+    sigset_t set;
+    struct sigevent sev;
+    struct itimerspec its;
+    timer_t timer;
+    /*
+     * struct kvm_signal_mask is followed by the kernel sigset_t, which is
+     * 64 bits on x86_64 (and not the same size as the libc sigset_t).
+     */
+    struct {
+        struct kvm_signal_mask hdr;
+        uint64_t sigset;
+    } kmask;
+
+    /*
+     * Block (signo) while running tender code, but unblock it while running
+     * the guest. This ensures that the profiling signal is only ever
+     * delivered during KVM_RUN (causing it to return EINTR), and that a
+     * signal arriving while we are servicing an exit is delivered at the next
+     * KVM_RUN, before the guest is resumed.
+     *
+     * As the signal is blocked again when KVM_RUN returns, it is never
+     * actually delivered; hvt_profile_read_regs() consumes it.
+     */
+    profile_signo = signo;
+    sigemptyset(&set);
+    sigaddset(&set, signo);
+    if (sigprocmask(SIG_BLOCK, &set, NULL) == -1) {
+        warn("profile: sigprocmask() failed");
+        return -1;
+    }
+    if (sigprocmask(SIG_SETMASK, NULL, &set) == -1) {
+        warn("profile: sigprocmask() failed");
+        return -1;
+    }
+    sigdelset(&set, signo);
+    kmask.hdr.len = sizeof kmask.sigset;
+    memcpy(&kmask.sigset, &set, sizeof kmask.sigset);
+    if (ioctl(hvt->b->vcpufd, KVM_SET_SIGNAL_MASK, &kmask) == -1) {
+        warn("profile: KVM: ioctl(KVM_SET_SIGNAL_MASK) failed");
+        return -1;
+    }
+
+    /*
+     * Sample based on the CPU time consumed by this (the VCPU) thread, which
+     * includes time spent running the guest.
+     */
+    memset(&sev, 0, sizeof sev);
+    sev.sigev_notify = SIGEV_THREAD_ID;
+    sev.sigev_signo = signo;
+    sev.sigev_notify_thread_id = syscall(SYS_gettid);
+    if (timer_create(CLOCK_THREAD_CPUTIME_ID, &sev, &timer) == -1) {
+        warn("profile: timer_create() failed");
+        return -1;
+    }
+    its.it_interval.tv_sec = (1000000000ULL / hz) / 1000000000ULL;
+    its.it_interval.tv_nsec = (1000000000ULL / hz) % 1000000000ULL;
+    its.it_value = its.it_interval;
+    if (timer_settime(timer, 0, &its, NULL) == -1) {
+        warn("profile: timer_settime() failed");
+        return -1;
+    }
+    return 0;
+}
+
+int hvt_profile_read_regs(struct hvt *hvt, uint64_t *pc, uint64_t *fp)
+{
+    struct kvm_regs regs;
+
+    if (hvt->b->vcpurun->exit_reason != KVM_EXIT_INTR)
+        return -1;
+    if (ioctl(hvt->b->vcpufd, KVM_GET_REGS, &regs) == -1) {
+        warn("profile: KVM: ioctl(KVM_GET_REGS) failed");
+        return -1;
+    }
+    *pc = regs.rip;
+    *fp = regs.rbp;
+
+    /*
+     * Consume the pending signal, otherwise the next KVM_RUN would return
+     * EINTR immediately.
+     */
+    sigset_t set;
+    struct timespec ts = { 0, 0 };
+    sigemptyset(&set);
+    sigaddset(&set, profile_signo);
+    while (sigtimedwait(&set, NULL, &ts) == profile_signo)
+        ;
+    return 0;
+}
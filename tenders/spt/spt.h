@@ -41,6 +41,20 @@ struct spt {
     int epollfd;
     int timerfd;
     void *sc_ctx;
+    struct xdp_port **net_xdp;
+    struct shm_net_port **net_shm;
+    struct rate_limit *net_rate;
+    struct rate_limit *block_rate;
+    struct capture_ring **net_capture;
+    struct overlay_dev **block_overlay;
+    const uint8_t **block_map;
+    struct compress_dev **block_compressed;
+    /*
+     * The guest ELF binary. (elf_fd) is only valid during module setup, for
+     * modules which need to read additional information from the binary.
+     */
+    int elf_fd;
+    const char *elf_filename;
 };
 
 struct spt *spt_init(size_t mem_size);
@@ -53,6 +67,21 @@ void spt_boot_info_init(struct spt *spt, uint64_t p_end, int cmdline_argc,
 
 void spt_run(struct spt *spt, uint64_t p_entry);
 
+/*
+ * Renumber the (count) device file descriptors in (fds) to a contiguous,
+ * naturally aligned block of descriptors, so that a seccomp rule can match
+ * all of them with a single SCMP_CMP_MASKED_EQ comparison of (*mask) and
+ * (*base), rather than with one rule per descriptor. Any unused descriptors
+ * at the end of the block are duplicates of the last one in (fds), so such a
+ * rule grants no additional access.
+ *
+ * Returns 0 and updates (fds) in place on success. Returns -1 if no block of
+ * descriptors could be allocated, in which case (fds) are unchanged and the
+ * caller should match each descriptor individually.
+ */
+int spt_fd_block_alloc(int *fds, unsigned count, uint64_t *mask,
+        uint64_t *base);
+
 /*
  * Operations provided by a module. (setup) is required, all other functions
  * are optional.
@@ -25,6 +25,8 @@
 #define _GNU_SOURCE
 #include <assert.h>
 #include <err.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <libgen.h>
 #include <signal.h>
 #include <stdint.h>
@@ -41,6 +43,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/prctl.h>
+#include <sys/resource.h>
 #include <sys/syscall.h>
 #include <unistd.h>
 #include <limits.h>
@@ -67,6 +70,38 @@ extern long __executable_start;
 
 static bool use_exec_heap = false;
 
+/*
+ * Smallest chunk released by the bindings with MADV_DONTNEED (one 4kB page).
+ */
+#define SPT_MADV_MIN_SHIFT 12
+
+/*
+ * Device file descriptors renumbered by spt_fd_block_alloc() are allocated
+ * upwards from SPT_FD_BLOCK_BASE, which is well above those the tender opens
+ * itself.
+ */
+#define SPT_FD_BLOCK_BASE 256
+static int fd_block_next = SPT_FD_BLOCK_BASE;
+
+/*
+ * System calls used on the guest I/O and timekeeping paths, in decreasing
+ * order of priority. libseccomp emits the checks for each system call in
+ * order of priority, so giving these the highest priority ensures that they
+ * are not preceded by checks for rarely used system calls.
+ */
+static const int hot_syscalls[] = {
+    SCMP_SYS(read),
+    SCMP_SYS(write),
+    SCMP_SYS(pread64),
+    SCMP_SYS(pwrite64),
+    SCMP_SYS(clock_gettime),
+    SCMP_SYS(epoll_pwait),
+    SCMP_SYS(timerfd_settime),
+    SCMP_SYS(readv),
+    SCMP_SYS(writev),
+    SCMP_SYS(sendto)
+};
+
 struct spt *spt_init(size_t mem_size)
 {
     struct spt *spt = malloc(sizeof (struct spt));
@@ -208,6 +243,14 @@ void spt_boot_info_init(struct spt *spt, uint64_t p_end, int cmdline_argc,
     bi->kernel_end = p_end;
     bi->epollfd = spt->epollfd;
     bi->timerfd = spt->timerfd;
+    bi->net_xdp = spt->net_xdp;
+    bi->net_shm = spt->net_shm;
+    bi->net_rate = spt->net_rate;
+    bi->block_rate = spt->block_rate;
+    bi->net_capture = spt->net_capture;
+    bi->block_overlay = spt->block_overlay;
+    bi->block_map = spt->block_map;
+    bi->block_compressed = spt->block_compressed;
 
     bi->mft = (void *)lowmem_pos;
     memcpy(spt->mem + lowmem_pos, mft, mft_size);
@@ -218,6 +261,39 @@ void spt_boot_info_init(struct spt *spt, uint64_t p_end, int cmdline_argc,
     lowmem_pos += SPT_CMDLINE_SIZE;
 }
 
+int spt_fd_block_alloc(int *fds, unsigned count, uint64_t *mask,
+        uint64_t *base)
+{
+    assert(count > 0);
+    unsigned size = 1;
+    while (size < count)
+        size <<= 1;
+    int start = (fd_block_next + size - 1) & ~(size - 1);
+
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_NOFILE, &rl) == -1 ||
+            (rl.rlim_cur != RLIM_INFINITY && rl.rlim_cur < (rlim_t)start + size))
+        return -1;
+    for (unsigned i = 0; i != size; i++) {
+        if (fcntl(start + i, F_GETFD) != -1 || errno != EBADF)
+            return -1;
+    }
+
+    for (unsigned i = 0; i != size; i++) {
+        int fd = (i < count) ? fds[i] : fds[count - 1];
+        if (dup2(fd, start + i) == -1)
+            err(1, "dup2(%d, %d) failed", fd, start + i);
+    }
+    for (unsigned i = 0; i != count; i++) {
+        close(fds[i]);
+        fds[i] = start + i;
+    }
+    fd_block_next = start + size;
+    *mask = ~(uint64_t)(size - 1);
+    *base = start;
+    return 0;
+}
+
 /*
  * Defined in spt_lauch_<arch>.S.
  */
@@ -258,10 +334,17 @@ void spt_run(struct spt *spt, uint64_t p_entry)
      * Instead, we export the BPF program via an anonymous memfd, release all
      * resources from the libseccomp context and load the filter manually.
      */
+    int rc = -1;
+    for (unsigned i = 0; i != sizeof hot_syscalls / sizeof hot_syscalls[0];
+            i++) {
+        rc = seccomp_syscall_priority(spt->sc_ctx, hot_syscalls[i], 255 - i);
+        if (rc != 0)
+            errx(1, "seccomp_syscall_priority(%d) failed: %s",
+                    hot_syscalls[i], strerror(-rc));
+    }
     int bpf_fd = _memfd_create("bpf_filter", 0);
     if (bpf_fd < 0)
         err(1, "memfd_create() failed");
-    int rc = -1;
     rc = seccomp_export_bpf(spt->sc_ctx, bpf_fd);
     if (rc != 0)
         errx(1, "seccomp_export_bpf() failed: %s", strerror(-rc));
@@ -344,6 +427,35 @@ static int setup(struct spt *spt, struct mft *mft)
     if (rc != 0)
         errx(1, "seccomp_rule_add(clock_gettime, CLOCK_REALTIME) failed: %s",
                 strerror(-rc));
+    /*
+     * solo5_mem_release(): The bindings issue MADV_DONTNEED in naturally
+     * aligned power-of-two chunks. libseccomp allows one comparison per
+     * argument, so a range check on (start, len) cannot be expressed
+     * directly. Instead, split guest memory into naturally aligned
+     * power-of-two regions, one for each bit set in mem_size, and for each
+     * region and chunk size allow only those starts which, once masked,
+     * are aligned to the chunk size and lie within the region. Such a chunk
+     * cannot extend past the end of its region, and hence of guest memory.
+     */
+    uint64_t region_base = 0;
+    for (int bit = 63; bit >= SPT_MADV_MIN_SHIFT; bit--) {
+        uint64_t region = 1ULL << bit;
+        if ((spt->mem_size & region) == 0)
+            continue;
+        for (uint64_t len = 1ULL << SPT_MADV_MIN_SHIFT; len <= region;
+                len <<= 1) {
+            rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+                    SCMP_SYS(madvise), 3,
+                    SCMP_A0(SCMP_CMP_MASKED_EQ, ~(region - 1) | (len - 1),
+                        region_base),
+                    SCMP_A1(SCMP_CMP_EQ, len),
+                    SCMP_A2(SCMP_CMP_EQ, MADV_DONTNEED));
+            if (rc != 0)
+                errx(1, "seccomp_rule_add(madvise, MADV_DONTNEED) failed: %s",
+                        strerror(-rc));
+        }
+        region_base += region;
+    }
 #if defined(__x86_64__)
     rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW, SCMP_SYS(arch_prctl),
             1, SCMP_A0(SCMP_CMP_EQ, ARCH_SET_FS));
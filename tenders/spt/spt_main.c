@@ -35,6 +35,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include "../common/placement.h"
 #include "spt.h"
 #include "version.h"
 
@@ -93,6 +94,21 @@ static void handle_mem(char *cmdarg, size_t *mem_size)
     *mem_size = mem;
 }
 
+static void handle_placement(char *cmdarg, struct placement *pl)
+{
+    if (strncmp("--cpu=", cmdarg, 6) == 0) {
+        if (placement_parse_cpus(pl, cmdarg + 6) == -1)
+            errx(1, "Malformed argument to --cpu");
+        return;
+    }
+    if (strncmp("--numa-node=", cmdarg, 12) == 0) {
+        if (placement_parse_node(pl, cmdarg + 12) == -1)
+            errx(1, "Malformed argument to --numa-node");
+        return;
+    }
+    pl->prefault = true;
+}
+
 static void usage(const char *prog)
 {
     fprintf(stderr, "usage: %s [ CORE OPTIONS ] [ -- ] "
@@ -101,6 +117,9 @@ static void usage(const char *prog)
     fprintf(stderr, "ARGS are optional arguments passed to the unikernel.\n");
     fprintf(stderr, "Core options:\n");
     fprintf(stderr, "  [ --mem=512 ] (guest memory in MB)\n");
+    fprintf(stderr, "  [ --cpu=LIST ] (run on CPUs in LIST, e.g. 0,2-3)\n");
+    fprintf(stderr, "  [ --numa-node=N ] (bind guest memory to NUMA node N)\n");
+    fprintf(stderr, "  [ --mem-prefault ] (allocate guest memory at startup)\n");
     fprintf(stderr, "    --help (display this help)\n");
     fprintf(stderr, "Compiled-in modules: ");
     for (struct spt_module *m = &__start_modules; m < &__stop_modules; m++) {
@@ -136,7 +155,9 @@ int main(int argc, char **argv)
     const char *elf_filename;
     int elf_fd = -1;
     int matched;
+    struct placement placement;
 
+    placement_init(&placement);
     prog = basename(*argv);
     argc--;
     argv++;
@@ -223,6 +244,14 @@ int main(int argc, char **argv)
             argc--;
             argv++;
         }
+        else if (strncmp("--cpu=", *argv, 6) == 0 ||
+                strncmp("--numa-node=", *argv, 12) == 0 ||
+                strcmp("--mem-prefault", *argv) == 0) {
+            handle_placement(*argv, &placement);
+            matched = 1;
+            argc--;
+            argv++;
+        }
         if (handle_cmdarg(*argv, mft) == 0) {
             /* Handled by module, consume and go on to next arg */
             matched = 1;
@@ -243,13 +272,29 @@ int main(int argc, char **argv)
      * seccomp policy.
      */
 
+    /*
+     * Apply CPU affinity before any threads are started, so that I/O threads
+     * created by modules inherit it, and bind guest memory before it is
+     * first touched by elf_load(). The first SPT_HOST_MEM_BASE bytes of
+     * spt->mem are not mapped.
+     */
+    placement_apply_cpus(&placement);
     struct spt *spt = spt_init(mem_size);
+    placement_apply_mem(&placement, spt->mem + SPT_HOST_MEM_BASE,
+            spt->mem_size - SPT_HOST_MEM_BASE);
+    if (placement_enabled(&placement))
+        placement_report(&placement, spt->mem + SPT_HOST_MEM_BASE,
+                spt->mem_size - SPT_HOST_MEM_BASE);
 
     elf_load(elf_fd, elf_filename, spt->mem, spt->mem_size, SPT_GUEST_MIN_BASE,
-            spt_guest_mprotect, spt, &p_entry, &p_end);
-    close(elf_fd);
+            !placement_mem_enabled(&placement), spt_guest_mprotect, spt,
+            &p_entry, &p_end);
 
+    spt->elf_fd = elf_fd;
+    spt->elf_filename = elf_filename;
     setup_modules(spt, mft);
+    close(elf_fd);                      /* Done with ELF binary */
+    spt->elf_fd = -1;
 
     spt_boot_info_init(spt, p_end, argc, argv, mft, mft_size);
 
@@ -33,30 +33,111 @@
 #include <seccomp.h>
 
 #include "../common/block_attach.h"
+#include "../common/rate_limit.h"
 #include "spt.h"
 
 static bool module_in_use;
+/*
+ * I/O rate limits set with --block-rate, indexed by manifest entry. These are
+ * enforced by the bindings.
+ */
+static struct rate_limit block_rates[MFT_MAX_ENTRIES];
+static bool rate_in_use;
+/*
+ * Copy-on-write overlays attached with --block:NAME=overlay:BASE,DELTA,
+ * indexed by manifest entry. These are accessed directly by the bindings.
+ */
+static struct overlay_dev *block_overlays[MFT_MAX_ENTRIES];
+static bool overlay_in_use;
+/*
+ * Read-only mappings of block devices attached with --block:NAME=ro:PATH,
+ * indexed by manifest entry. The guest reads these directly, without system
+ * calls.
+ */
+static const uint8_t *block_maps[MFT_MAX_ENTRIES];
+static bool map_in_use;
+/*
+ * Compressed images attached with --block:NAME=compressed:PATH, indexed by
+ * manifest entry. The bindings read and decompress chunks themselves.
+ */
+static struct compress_dev *block_compressed[MFT_MAX_ENTRIES];
+static bool compressed_in_use;
 
 static int handle_cmdarg(char *cmdarg, struct mft *mft)
 {
+    char name[MFT_NAME_SIZE];
+
+    if (strncmp("--block-rate:", cmdarg, 13) == 0) {
+        char spec[64];
+        int rc = sscanf(cmdarg,
+                "--block-rate:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]=%63s", name,
+                spec);
+        if (rc != 2)
+            return -1;
+        unsigned index;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_BLOCK_BASIC,
+                &index);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        if (rate_limit_parse(&block_rates[index], spec) == -1)
+            return -1;
+        rate_in_use = true;
+        return 0;
+    }
     if (strncmp("--block:", cmdarg, 8) != 0)
         return -1;
 
-    char name[MFT_NAME_SIZE];
     char path[PATH_MAX + 1];
     int rc = sscanf(cmdarg,
             "--block:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]="
             "%" XSTR(PATH_MAX) "s", name, path);
     if (rc != 2)
         return -1;
-    struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_BLOCK_BASIC, NULL);
+    unsigned index;
+    struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_BLOCK_BASIC,
+            &index);
     if (e == NULL) {
         warnx("Resource not declared in manifest: '%s'", name);
         return -1;
     }
 
     off_t capacity;
-    int fd = block_attach(path, &capacity);
+    int fd;
+    if (strncmp("overlay:", path, 8) == 0) {
+        char *delta = strchr(path, ',');
+        if (delta == NULL)
+            return -1;
+        *delta++ = '\0';
+        block_overlays[index] = block_attach_overlay(path + 8, delta,
+                &capacity);
+        fd = block_overlays[index]->delta_fd;
+        overlay_in_use = true;
+    }
+    else if (strncmp("ro:", path, 3) == 0) {
+        block_maps[index] = block_attach_map(path + 3, &capacity);
+        fd = -1;
+        map_in_use = true;
+    }
+    else if (strncmp("compressed:", path, 11) == 0) {
+        unsigned nslots = BLOCK_COMPRESSED_DEFAULT_SLOTS;
+        char *slots = strchr(path, ',');
+        if (slots != NULL) {
+            *slots++ = '\0';
+            if (sscanf(slots, "%u", &nslots) != 1 || nslots == 0)
+                return -1;
+            if (nslots > BLOCK_COMPRESSED_MAX_SLOTS)
+                errx(1, "%s: Cache of %u chunks is too large (maximum %d)",
+                        name, nslots, BLOCK_COMPRESSED_MAX_SLOTS);
+        }
+        block_compressed[index] = block_attach_compressed(path + 11, nslots,
+                &capacity);
+        fd = block_compressed[index]->fd;
+        compressed_in_use = true;
+    }
+    else
+        fd = block_attach(path, &capacity);
     e->u.block_basic.capacity = capacity;
     e->u.block_basic.block_size = 512;
     e->b.hostfd = fd;
@@ -66,6 +147,90 @@ static int handle_cmdarg(char *cmdarg, struct mft *mft)
     return 0;
 }
 
+/*
+ * Allow the guest to read single blocks from the base image of overlay (o),
+ * and read or write single blocks in the data area of its delta. As for
+ * plain block devices, the guest can not grow the delta. Note that the guest
+ * may corrupt the header or bitmap of its own delta; it can write to the
+ * latter directly through the shared mapping anyway.
+ */
+static void overlay_rules(struct spt *spt, struct overlay_dev *o)
+{
+    int rc;
+
+    rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+            SCMP_SYS(pread64), 3,
+            SCMP_A0(SCMP_CMP_EQ, o->base_fd),
+            SCMP_A2(SCMP_CMP_EQ, o->block_size),
+            SCMP_A3(SCMP_CMP_LE, o->capacity - o->block_size));
+    if (rc != 0)
+        errx(1, "seccomp_rule_add(pread64, fd=%d) failed: %s",
+                o->base_fd, strerror(-rc));
+    rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+            SCMP_SYS(pread64), 3,
+            SCMP_A0(SCMP_CMP_EQ, o->delta_fd),
+            SCMP_A2(SCMP_CMP_EQ, o->block_size),
+            SCMP_A3(SCMP_CMP_LE,
+                o->data_offset + o->capacity - o->block_size));
+    if (rc != 0)
+        errx(1, "seccomp_rule_add(pread64, fd=%d) failed: %s",
+                o->delta_fd, strerror(-rc));
+    rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+            SCMP_SYS(pwrite64), 3,
+            SCMP_A0(SCMP_CMP_EQ, o->delta_fd),
+            SCMP_A2(SCMP_CMP_EQ, o->block_size),
+            SCMP_A3(SCMP_CMP_LE,
+                o->data_offset + o->capacity - o->block_size));
+    if (rc != 0)
+        errx(1, "seccomp_rule_add(pwrite64, fd=%d) failed: %s",
+                o->delta_fd, strerror(-rc));
+}
+
+/*
+ * Returns true if manifest entry (i) is an attached block device backed
+ * directly by a file descriptor.
+ */
+static bool is_plain(struct mft *mft, unsigned i)
+{
+    return mft->e[i].type == MFT_DEV_BLOCK_BASIC && mft->e[i].attached &&
+        block_overlays[i] == NULL && block_maps[i] == NULL &&
+        block_compressed[i] == NULL;
+}
+
+/*
+ * Allow the guest to read and write single blocks on the plain block devices
+ * with descriptors matching (fd_cmp), of which (fd) is the first, and the
+ * given (block_size) and (capacity).
+ *
+ * When reading or writing to the file descriptor, enforce that the operation
+ * cannot be performed beyond the (detected) capacity, otherwise, when backed
+ * by a regular file, the guest could grow the file size arbitrarily.
+ *
+ * The Solo5 API mandates that reads/writes must be equal to block_size, so we
+ * implement the above by ensuring that (A2 == block_size) && (A3 <= (capacity
+ * - block_size) holds.
+ */
+static void block_rules(struct spt *spt, struct scmp_arg_cmp fd_cmp, int fd,
+        uint64_t block_size, uint64_t capacity)
+{
+    int rc;
+
+    rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+            SCMP_SYS(pread64), 3, fd_cmp,
+            SCMP_A2(SCMP_CMP_EQ, block_size),
+            SCMP_A3(SCMP_CMP_LE, capacity - block_size));
+    if (rc != 0)
+        errx(1, "seccomp_rule_add(pread64, fd=%d) failed: %s",
+                fd, strerror(-rc));
+    rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+            SCMP_SYS(pwrite64), 3, fd_cmp,
+            SCMP_A2(SCMP_CMP_EQ, block_size),
+            SCMP_A3(SCMP_CMP_LE, capacity - block_size));
+    if (rc != 0)
+        errx(1, "seccomp_rule_add(pwrite64, fd=%d) failed: %s",
+                fd, strerror(-rc));
+}
+
 static int setup(struct spt *spt, struct mft *mft)
 {
     if (!module_in_use)
@@ -77,42 +242,88 @@ static int setup(struct spt *spt, struct mft *mft)
 
         int rc = -1;
 
-        /*
-         * When reading or writing to the file descriptor, enforce that the
-         * operation cannot be performed beyond the (detected) capacity,
-         * otherwise, when backed by a regular file, the guest could grow the
-         * file size arbitrarily.
-         *
-         * The Solo5 API mandates that reads/writes must be equal to
-         * block_size, so we implement the above by ensuring that (A2 ==
-         * block_size) && (A3 <= (capacity - block_size) holds.
-         */
-        rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
-                SCMP_SYS(pread64), 3,
-                SCMP_A0(SCMP_CMP_EQ, mft->e[i].b.hostfd),
-                SCMP_A2(SCMP_CMP_EQ, mft->e[i].u.block_basic.block_size),
-                SCMP_A3(SCMP_CMP_LE,
-                    (mft->e[i].u.block_basic.capacity - mft->e[i].u.block_basic.block_size)));
-        if (rc != 0)
-            errx(1, "seccomp_rule_add(pread64, fd=%d) failed: %s",
-                    mft->e[i].b.hostfd, strerror(-rc));
-        rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
-                SCMP_SYS(pwrite64), 3,
-                SCMP_A0(SCMP_CMP_EQ, mft->e[i].b.hostfd),
-                SCMP_A2(SCMP_CMP_EQ, mft->e[i].u.block_basic.block_size),
-                SCMP_A3(SCMP_CMP_LE,
-                    (mft->e[i].u.block_basic.capacity - mft->e[i].u.block_basic.block_size)));
-        if (rc != 0)
-            errx(1, "seccomp_rule_add(pwrite64, fd=%d) failed: %s",
-                    mft->e[i].b.hostfd, strerror(-rc));
+        if (block_overlays[i] != NULL) {
+            overlay_rules(spt, block_overlays[i]);
+            continue;
+        }
+        if (block_maps[i] != NULL)
+            continue;
+        if (block_compressed[i] != NULL) {
+            /*
+             * The guest only reads stored chunks, of at most max_csize bytes.
+             */
+            struct compress_dev *d = block_compressed[i];
+            rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+                    SCMP_SYS(pread64), 2,
+                    SCMP_A0(SCMP_CMP_EQ, d->fd),
+                    SCMP_A2(SCMP_CMP_LE, d->max_csize));
+            if (rc != 0)
+                errx(1, "seccomp_rule_add(pread64, fd=%d) failed: %s",
+                        d->fd, strerror(-rc));
+        }
     }
 
+    /*
+     * Plain block devices with the same geometry are subject to the same
+     * rules, so renumber their descriptors into a single block which can be
+     * matched by one rule, rather than checking each descriptor in turn.
+     */
+    bool grouped[MFT_MAX_ENTRIES] = { false };
+    for (unsigned i = 0; i != mft->entries; i++) {
+        if (!is_plain(mft, i) || grouped[i])
+            continue;
+
+        struct mft_block_basic *b = &mft->e[i].u.block_basic;
+        unsigned index[MFT_MAX_ENTRIES];
+        int fds[MFT_MAX_ENTRIES];
+        unsigned count = 0;
+        for (unsigned j = i; j != mft->entries; j++) {
+            if (!is_plain(mft, j) ||
+                    mft->e[j].u.block_basic.block_size != b->block_size ||
+                    mft->e[j].u.block_basic.capacity != b->capacity)
+                continue;
+            grouped[j] = true;
+            index[count] = j;
+            fds[count] = mft->e[j].b.hostfd;
+            count++;
+        }
+
+        uint64_t mask, base;
+        if (count > 1 && spt_fd_block_alloc(fds, count, &mask, &base) == 0) {
+            for (unsigned k = 0; k != count; k++)
+                mft->e[index[k]].b.hostfd = fds[k];
+            block_rules(spt, SCMP_A0(SCMP_CMP_MASKED_EQ, mask, base), fds[0],
+                    b->block_size, b->capacity);
+        }
+        else {
+            for (unsigned k = 0; k != count; k++)
+                block_rules(spt, SCMP_A0(SCMP_CMP_EQ, fds[k]), fds[k],
+                        b->block_size, b->capacity);
+        }
+    }
+
+    if (rate_in_use)
+        spt->block_rate = block_rates;
+    if (overlay_in_use)
+        spt->block_overlay = block_overlays;
+    if (map_in_use)
+        spt->block_map = block_maps;
+    if (compressed_in_use)
+        spt->block_compressed = block_compressed;
+
     return 0;
 }
 
 static char *usage(void)
 {
-    return "--block:NAME=PATH (attach block device/file at PATH as block storage NAME)";
+    return "--block:NAME=PATH | ro:PATH | overlay:BASE,DELTA |\n"
+        "    compressed:PATH[,CACHE] (attach block device/file at PATH,\n"
+        "    read-only and mapped into the guest, copy-on-write overlay DELTA on\n"
+        "    top of read-only image BASE, or read-only compressed image at PATH\n"
+        "    caching CACHE chunks, as block storage NAME)\n"
+        "  [ --block-rate:NAME=SPEC ] (limit I/O rate of block storage NAME, SPEC\n"
+        "    is a list of bytes=N,ops=N,bytes-burst=N,ops-burst=N; cooperative,\n"
+        "    enforced by the unikernel and not a security boundary)";
 }
 
 DECLARE_MODULE(block,
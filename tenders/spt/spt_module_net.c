@@ -22,59 +22,174 @@
  * spt_module_net.c: Network device module.
  */
 
+#define _GNU_SOURCE
 #include <assert.h>
 #include <err.h>
+#include <errno.h>
 #include <inttypes.h>
+#include <limits.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <seccomp.h>
 #include <sys/epoll.h>
 
+#include "../common/net_capture.h"
+#include "../common/rate_limit.h"
+#include "../common/shm_attach.h"
 #include "../common/tap_attach.h"
+#include "../common/xdp_attach.h"
 #include "spt.h"
+#include "solo5.h"
 
 static bool module_in_use;
+/*
+ * AF_XDP and shared memory ports, indexed by manifest entry. NULL for tap
+ * devices. Passed to the guest, which operates the rings directly.
+ */
+static struct xdp_port *xdp_ports[MFT_MAX_ENTRIES];
+static bool xdp_in_use;
+static struct shm_net_port *shm_ports[MFT_MAX_ENTRIES];
+static bool shm_in_use;
+/*
+ * TAP interfaces, indexed by manifest entry. These are attached by setup(),
+ * once it is known whether offload has been requested with --net-offload.
+ */
+static char *tap_ifnames[MFT_MAX_ENTRIES];
+/*
+ * MTUs set with --net-mtu, indexed by manifest entry. 0 if not set.
+ */
+static uint16_t net_mtus[MFT_MAX_ENTRIES];
+/*
+ * Frame filters set with --net-filter, indexed by manifest entry.
+ */
+static struct tap_filter net_filters[MFT_MAX_ENTRIES];
+/*
+ * Transmit rate limits set with --net-rate, indexed by manifest entry. These
+ * are enforced by the bindings.
+ */
+static struct rate_limit net_rates[MFT_MAX_ENTRIES];
+static bool rate_in_use;
+/*
+ * Packet capture set with --net-capture, indexed by manifest entry. The
+ * bindings capture frames into the ring, which is written out by a helper
+ * process outside of the seccomp sandbox.
+ */
+static char *net_capture_paths[MFT_MAX_ENTRIES];
+static uint32_t net_capture_snaplens[MFT_MAX_ENTRIES];
+static uint32_t net_capture_nslots[MFT_MAX_ENTRIES];
+static struct capture_ring *net_capture_rings[MFT_MAX_ENTRIES];
+static bool capture_in_use;
+
+#define NET_DEFAULT_MTU 1500
+#define NET_MIN_MTU     68
+
+/*
+ * Determine the MTU of the network device (e) at manifest index (index):
+ * either as set with --net-mtu, or that of the attached TAP interface.
+ */
+static uint16_t net_mtu(struct mft_entry *e, unsigned index)
+{
+    unsigned max_mtu = UINT16_MAX;
+    if (xdp_ports[index] != NULL)
+        max_mtu = XDP_PORT_FRAME_SIZE - SOLO5_NET_HLEN;
+    else if (shm_ports[index] != NULL)
+        max_mtu = SHM_NET_MAX_PACKET - SOLO5_NET_HLEN;
+
+    unsigned mtu = net_mtus[index];
+    if (mtu != 0) {
+        if (mtu > max_mtu)
+            errx(1, "%s: MTU %u exceeds maximum of %u for this device",
+                    e->name, mtu, max_mtu);
+        return mtu;
+    }
+
+    mtu = NET_DEFAULT_MTU;
+    if (tap_ifnames[index] != NULL) {
+        int tap_mtu = tap_attach_get_mtu(e->b.hostfd, tap_ifnames[index]);
+        if (tap_mtu > 0)
+            mtu = tap_mtu;
+        else if (errno != ENOTSUP)
+            warn("%s: Could not determine MTU of %s, using %u", e->name,
+                    tap_ifnames[index], mtu);
+    }
+    return (mtu > max_mtu) ? max_mtu : mtu;
+}
 
 static int handle_cmdarg(char *cmdarg, struct mft *mft)
 {
     enum {
         opt_net,
-        opt_net_mac
+        opt_net_mac,
+        opt_net_offload,
+        opt_net_mtu,
+        opt_net_filter,
+        opt_net_rate,
+        opt_net_capture
     } which;
 
     if (strncmp("--net:", cmdarg, 6) == 0)
         which = opt_net;
     else if (strncmp("--net-mac:", cmdarg, 10) == 0)
         which = opt_net_mac;
+    else if (strncmp("--net-offload:", cmdarg, 14) == 0)
+        which = opt_net_offload;
+    else if (strncmp("--net-mtu:", cmdarg, 10) == 0)
+        which = opt_net_mtu;
+    else if (strncmp("--net-filter:", cmdarg, 13) == 0)
+        which = opt_net_filter;
+    else if (strncmp("--net-rate:", cmdarg, 11) == 0)
+        which = opt_net_rate;
+    else if (strncmp("--net-capture:", cmdarg, 14) == 0)
+        which = opt_net_capture;
     else
         return -1;
 
     char name[MFT_NAME_SIZE];
-    char iface[20]; /* XXX should be IFNAMSIZ, needs extra header here */
+    char iface[PATH_MAX + 1]; /* Also holds "shm:" PATH */
     int rc;
     if (which == opt_net) {
         rc = sscanf(cmdarg,
                 "--net:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]="
-                "%19s", name, iface);
+                "%" XSTR(PATH_MAX) "s", name, iface);
         if (rc != 2)
             return -1;
+        unsigned index;
         struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
-                NULL);
+                &index);
         if (e == NULL) {
             warnx("Resource not declared in manifest: '%s'", name);
             return -1;
         }
-        int fd = tap_attach(iface);
-        if (fd < 0) {
-            warnx("Could not attach interface: %s", iface);
-            return -1;
+        int fd;
+        if (strncmp("xdp:", iface, 4) == 0) {
+            uint8_t mac[6], no_mac[6] = { 0 };
+            xdp_ports[index] = xdp_attach(iface + 4, mac);
+            xdp_in_use = true;
+            fd = xdp_ports[index]->fd;
+            /*
+             * Default to the MAC address of the interface, unless one has
+             * already been set by --net-mac.
+             */
+            if (memcmp(e->u.net_basic.mac, no_mac, sizeof no_mac) == 0)
+                memcpy(e->u.net_basic.mac, mac, sizeof mac);
+        }
+        else if (strncmp("shm:", iface, 4) == 0) {
+            shm_ports[index] = shm_attach(iface + 4);
+            shm_in_use = true;
+            fd = shm_ports[index]->rx_fd;
+        }
+        else {
+            tap_ifnames[index] = strdup(iface);
+            if (tap_ifnames[index] == NULL)
+                err(1, "strdup");
+            fd = -1;
         }
 
         /* e->u.net_basic.mac[] is set either by option or generated later by
-         * setup().
+         * setup(), as is e->u.net_basic.mtu.
          */
-        e->u.net_basic.mtu = 1500; /* TODO */
         e->b.hostfd = fd;
         e->attached = true;
         module_in_use = true;
@@ -97,10 +212,129 @@ static int handle_cmdarg(char *cmdarg, struct mft *mft)
         }
         memcpy(e->u.net_basic.mac, mac, sizeof mac);
     }
+    else if (which == opt_net_offload) {
+        rc = sscanf(cmdarg,
+                "--net-offload:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]", name);
+        if (rc != 1)
+            return -1;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
+                NULL);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        e->u.net_basic.offload = true;
+    }
+    else if (which == opt_net_mtu) {
+        unsigned mtu;
+        rc = sscanf(cmdarg,
+                "--net-mtu:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]=%u", name, &mtu);
+        if (rc != 2)
+            return -1;
+        unsigned index;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
+                &index);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        if (mtu < NET_MIN_MTU || mtu > UINT16_MAX) {
+            warnx("%s: Invalid MTU: %u", name, mtu);
+            return -1;
+        }
+        net_mtus[index] = mtu;
+    }
+    else if (which == opt_net_filter) {
+        int n = 0;
+        rc = sscanf(cmdarg,
+                "--net-filter:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]%n", name, &n);
+        if (rc != 1 || (cmdarg[n] != '\0' && cmdarg[n] != '='))
+            return -1;
+        unsigned index;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
+                &index);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        if (cmdarg[n] == '=' &&
+                tap_filter_add_mcast(&net_filters[index], &cmdarg[n + 1]) == -1)
+            return -1;
+        net_filters[index].enabled = true;
+    }
+    else if (which == opt_net_rate) {
+        char spec[64];
+        rc = sscanf(cmdarg,
+                "--net-rate:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]=%63s", name,
+                spec);
+        if (rc != 2)
+            return -1;
+        unsigned index;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
+                &index);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        if (rate_limit_parse(&net_rates[index], spec) == -1)
+            return -1;
+        rate_in_use = true;
+    }
+    else if (which == opt_net_capture) {
+        char spec[PATH_MAX + 1];
+        rc = sscanf(cmdarg,
+                "--net-capture:%" XSTR(MFT_NAME_MAX) "[A-Za-z0-9]="
+                "%" XSTR(PATH_MAX) "s", name, spec);
+        if (rc != 2)
+            return -1;
+        unsigned index;
+        struct mft_entry *e = mft_get_by_name(mft, name, MFT_DEV_NET_BASIC,
+                &index);
+        if (e == NULL) {
+            warnx("Resource not declared in manifest: '%s'", name);
+            return -1;
+        }
+        if (net_capture_parse(spec, &net_capture_paths[index],
+                    &net_capture_snaplens[index],
+                    &net_capture_nslots[index]) == -1)
+            return -1;
+        capture_in_use = true;
+    }
 
     return 0;
 }
 
+/*
+ * Returns true if manifest entry (i) is an attached tap device without
+ * offload, which the guest reads and writes directly.
+ */
+static bool is_plain(struct mft *mft, unsigned i)
+{
+    return mft->e[i].type == MFT_DEV_NET_BASIC && mft->e[i].attached &&
+        xdp_ports[i] == NULL && shm_ports[i] == NULL &&
+        !mft->e[i].u.net_basic.offload;
+}
+
+/*
+ * Allow the guest to read and write the tap devices with descriptors matching
+ * (fd_cmp), of which (fd) is the first.
+ */
+static void tap_rules(struct spt *spt, struct scmp_arg_cmp fd_cmp, int fd)
+{
+    int rc;
+
+    rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW, SCMP_SYS(read), 1,
+            fd_cmp);
+    if (rc != 0)
+        errx(1, "seccomp_rule_add(read, fd=%d) failed: %s", fd,
+                strerror(-rc));
+    rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW, SCMP_SYS(write), 1,
+            fd_cmp);
+    if (rc != 0)
+        errx(1, "seccomp_rule_add(write, fd=%d) failed: %s", fd,
+                strerror(-rc));
+}
+
 static int setup(struct spt *spt, struct mft *mft)
 {
     if (!module_in_use)
@@ -109,11 +343,67 @@ static int setup(struct spt *spt, struct mft *mft)
     for (unsigned i = 0; i != mft->entries; i++) {
         if (mft->e[i].type != MFT_DEV_NET_BASIC || !mft->e[i].attached)
             continue;
+        if (tap_ifnames[i] != NULL) {
+            mft->e[i].b.hostfd = tap_attach(tap_ifnames[i],
+                    mft->e[i].u.net_basic.offload);
+            if (mft->e[i].b.hostfd < 0)
+                err(1, "Could not attach interface: %s", tap_ifnames[i]);
+        }
+        else if (mft->e[i].u.net_basic.offload)
+            errx(1, "%s: Offload is only supported on tap interfaces",
+                    mft->e[i].name);
+        mft->e[i].u.net_basic.mtu = net_mtu(&mft->e[i], i);
         char no_mac[6] = { 0 };
         if (memcmp(mft->e[i].u.net_basic.mac, no_mac, sizeof no_mac) == 0)
             tap_attach_genmac(mft->e[i].u.net_basic.mac);
+        if (net_filters[i].enabled) {
+            if (tap_ifnames[i] == NULL)
+                errx(1, "%s: Filtering is only supported on tap interfaces",
+                        mft->e[i].name);
+            if (tap_attach_filter(mft->e[i].b.hostfd,
+                        mft->e[i].u.net_basic.mac, &net_filters[i]) == -1)
+                err(1, "%s: Could not attach filter", mft->e[i].name);
+        }
+    }
+
+    /*
+     * All tap devices without offload are subject to the same rules, so
+     * renumber their descriptors into a single block which can be matched by
+     * one rule, rather than checking each descriptor in turn.
+     */
+    unsigned index[MFT_MAX_ENTRIES];
+    int fds[MFT_MAX_ENTRIES];
+    unsigned count = 0;
+    for (unsigned i = 0; i != mft->entries; i++) {
+        if (is_plain(mft, i)) {
+            index[count] = i;
+            fds[count] = mft->e[i].b.hostfd;
+            count++;
+        }
+    }
+    uint64_t mask, base;
+    bool grouped = count > 1 &&
+        spt_fd_block_alloc(fds, count, &mask, &base) == 0;
+    if (grouped) {
+        for (unsigned k = 0; k != count; k++)
+            mft->e[index[k]].b.hostfd = fds[k];
+    }
+
+    for (unsigned i = 0; i != mft->entries; i++) {
+        if (mft->e[i].type != MFT_DEV_NET_BASIC || !mft->e[i].attached)
+            continue;
 
         int rc;
+        if (net_capture_paths[i] != NULL) {
+            uint32_t snaplen = net_capture_snaplens[i];
+            if (snaplen == 0)
+                snaplen = mft->e[i].u.net_basic.offload ?
+                    SOLO5_NET_OFFLOAD_MAX_PACKET :
+                    mft->e[i].u.net_basic.mtu + SOLO5_NET_HLEN;
+            struct net_capture *c = net_capture_open(net_capture_paths[i],
+                    mft->e[i].name, snaplen, net_capture_nslots[i]);
+            net_capture_rings[i] = c->ring;
+        }
         struct epoll_event ev;
         ev.events = EPOLLIN;
         /*
@@ -126,25 +416,96 @@ static int setup(struct spt *spt, struct mft *mft)
             err(1, "epoll_ctl(EPOLL_CTL_ADD, hostfd=%d) failed",
                     mft->e[i].b.hostfd);
 
-        rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW, SCMP_SYS(read), 1,
-                SCMP_A0(SCMP_CMP_EQ, mft->e[i].b.hostfd));
-        if (rc != 0)
-            errx(1, "seccomp_rule_add(read, fd=%d) failed: %s",
-                    mft->e[i].b.hostfd, strerror(-rc));
-        rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW, SCMP_SYS(write), 1,
-                SCMP_A0(SCMP_CMP_EQ, mft->e[i].b.hostfd));
-        if (rc != 0)
-            errx(1, "seccomp_rule_add(write, fd=%d) failed: %s",
-                    mft->e[i].b.hostfd, strerror(-rc));
+        if (xdp_ports[i] != NULL) {
+            /*
+             * The guest only needs sendto() to kick transmission.
+             */
+            rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+                    SCMP_SYS(sendto), 1,
+                    SCMP_A0(SCMP_CMP_EQ, mft->e[i].b.hostfd));
+            if (rc != 0)
+                errx(1, "seccomp_rule_add(sendto, fd=%d) failed: %s",
+                        mft->e[i].b.hostfd, strerror(-rc));
+            continue;
+        }
+        if (shm_ports[i] != NULL) {
+            /*
+             * The guest only needs to ring the peer's doorbell, in addition
+             * to clearing its own (hostfd) below.
+             */
+            rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+                    SCMP_SYS(write), 1,
+                    SCMP_A0(SCMP_CMP_EQ, shm_ports[i]->tx_fd));
+            if (rc != 0)
+                errx(1, "seccomp_rule_add(write, fd=%d) failed: %s",
+                        shm_ports[i]->tx_fd, strerror(-rc));
+            rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+                    SCMP_SYS(read), 1,
+                    SCMP_A0(SCMP_CMP_EQ, mft->e[i].b.hostfd));
+            if (rc != 0)
+                errx(1, "seccomp_rule_add(read, fd=%d) failed: %s",
+                        mft->e[i].b.hostfd, strerror(-rc));
+            continue;
+        }
+
+        if (mft->e[i].u.net_basic.offload) {
+            /*
+             * The guest sends and receives the offload metadata and packet
+             * as separate buffers.
+             */
+            rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+                    SCMP_SYS(readv), 2,
+                    SCMP_A0(SCMP_CMP_EQ, mft->e[i].b.hostfd),
+                    SCMP_A2(SCMP_CMP_EQ, 2));
+            if (rc != 0)
+                errx(1, "seccomp_rule_add(readv, fd=%d) failed: %s",
+                        mft->e[i].b.hostfd, strerror(-rc));
+            rc = seccomp_rule_add(spt->sc_ctx, SCMP_ACT_ALLOW,
+                    SCMP_SYS(writev), 2,
+                    SCMP_A0(SCMP_CMP_EQ, mft->e[i].b.hostfd),
+                    SCMP_A2(SCMP_CMP_EQ, 2));
+            if (rc != 0)
+                errx(1, "seccomp_rule_add(writev, fd=%d) failed: %s",
+                        mft->e[i].b.hostfd, strerror(-rc));
+            continue;
+        }
+
+        if (!grouped)
+            tap_rules(spt, SCMP_A0(SCMP_CMP_EQ, mft->e[i].b.hostfd),
+                    mft->e[i].b.hostfd);
     }
+    if (grouped)
+        tap_rules(spt, SCMP_A0(SCMP_CMP_MASKED_EQ, mask, base), fds[0]);
+
+    if (xdp_in_use)
+        spt->net_xdp = xdp_ports;
+    if (shm_in_use)
+        spt->net_shm = shm_ports;
+    if (rate_in_use)
+        spt->net_rate = net_rates;
+    if (capture_in_use)
+        spt->net_capture = net_capture_rings;
 
     return 0;
 }
 
 static char *usage(void)
 {
-    return "--net:NAME=IFACE | @NN (attach tap at IFACE or at fd @NN as network NAME)\n"
-        "  [ --net-mac:NAME=HWADDR ] (set HWADDR for network NAME)";
+    return "--net:NAME=IFACE | @NN | xdp:IFACE[:QUEUE] | shm:PATH (attach tap at IFACE,\n"
+        "    at fd @NN, queue QUEUE of IFACE using AF_XDP, or shared memory link\n"
+        "    with rendezvous socket PATH as network NAME)\n"
+        "  [ --net-mac:NAME=HWADDR ] (set HWADDR for network NAME)\n"
+        "  [ --net-offload:NAME ] (enable checksum and segmentation offload for\n"
+        "    network NAME)\n"
+        "  [ --net-mtu:NAME=MTU ] (set MTU for network NAME, default is the MTU\n"
+        "    of IFACE for tap)\n"
+        "  [ --net-filter:NAME[=HWADDR,...] ] (drop frames on network NAME not\n"
+        "    addressed to it, broadcast, or multicast group HWADDR)\n"
+        "  [ --net-rate:NAME=SPEC ] (limit transmit rate of network NAME, SPEC is\n"
+        "    a list of bytes=N,ops=N,bytes-burst=N,ops-burst=N; cooperative,\n"
+        "    enforced by the unikernel and not a security boundary)\n"
+        "  [ --net-capture:NAME=FILE[,SNAPLEN[,RINGSIZE]] ] (capture frames on\n"
+        "    network NAME to pcapng FILE)";
 }
 
 DECLARE_MODULE(net,
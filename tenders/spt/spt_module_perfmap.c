@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * spt_module_perfmap.c: Guest symbol map for Linux perf.
+ *
+ * The guest is loaded into the tender's address space at its link-time
+ * addresses, but from the point of view of perf(1) it is anonymous memory, so
+ * samples in guest code cannot be symbolized. This module writes the guest
+ * function symbols to /tmp/perf-PID.map, which perf consults for addresses
+ * not covered by any mapped file. As this happens once at load time, there is
+ * no run-time overhead.
+ */
+
+#define _GNU_SOURCE
+#include <assert.h>
+#include <err.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "spt.h"
+
+static bool module_in_use;
+
+static int handle_cmdarg(char *cmdarg, struct mft *mft)
+{
+    if (strcmp("--x-perf-map", cmdarg) != 0)
+        return -1;
+
+    module_in_use = true;
+    return 0;
+}
+
+static int setup(struct spt *spt, struct mft *mft)
+{
+    if (!module_in_use)
+        return 0;
+
+    struct elf_symtab symtab;
+    assert(spt->elf_fd != -1);
+    if (elf_load_symtab(spt->elf_fd, spt->elf_filename, &symtab) == -1) {
+        warnx("perf-map: %s: No symbol table found", spt->elf_filename);
+        return 0;
+    }
+
+    char path[64];
+    snprintf(path, sizeof path, "/tmp/perf-%d.map", (int)getpid());
+    FILE *fp = fopen(path, "w");
+    if (fp == NULL)
+        err(1, "perf-map: %s", path);
+
+    for (size_t i = 0; i < symtab.nsyms; i++) {
+        const struct elf_sym *sym = &symtab.syms[i];
+        uint64_t size = sym->size;
+
+        /*
+         * perf requires a size; symbols of unknown size extend to the next
+         * symbol.
+         */
+        if (size == 0 && i + 1 < symtab.nsyms)
+            size = symtab.syms[i + 1].addr - sym->addr;
+        if (size == 0)
+            continue;
+        fprintf(fp, "%" PRIx64 " %" PRIx64 " %s\n", sym->addr, size,
+                sym->name);
+    }
+    if (fclose(fp) != 0)
+        err(1, "perf-map: %s", path);
+
+    elf_symtab_free(&symtab);
+    return 0;
+}
+
+static char *usage(void)
+{
+    return "--x-perf-map (write guest symbols to /tmp/perf-PID.map for perf)";
+}
+
+DECLARE_MODULE(perfmap,
+    .setup = setup,
+    .handle_cmdarg = handle_cmdarg,
+    .usage = usage
+)
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * bench.h: Console output and result reporting for guests which report
+ * timings, such as the benchmarks in bench/. Include after solo5.h and
+ * bindings/lib.c.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+static inline void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+/*
+ * Format (v) in decimal into (buf), which must hold at least 21 characters.
+ */
+static inline char *fmt_u64(uint64_t v, char *buf)
+{
+    char *p = buf + 20;
+
+    *p = '\0';
+    do {
+        *--p = '0' + v % 10;
+        v /= 10;
+    } while (v != 0);
+    return p;
+}
+
+static inline void put_u64(uint64_t v)
+{
+    char buf[21];
+
+    puts(fmt_u64(v, buf));
+}
+
+/*
+ * Report a result as a "BENCH metric value unit" line, the format parsed by
+ * bench/run-bench.sh.
+ */
+static inline void bench_report(const char *metric, uint64_t value,
+        const char *unit)
+{
+    puts("BENCH ");
+    puts(metric);
+    puts(" ");
+    put_u64(value);
+    puts(" ");
+    puts(unit);
+    puts("\n");
+}
+
+#endif /* BENCH_H */
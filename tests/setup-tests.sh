@@ -25,6 +25,9 @@
 # tap interface named 'tap100', host address of 10.0.0.1/24.
 # tap interface named 'tap101', host address of 10.1.0.1/24.
 #
+# On Linux, for AF_XDP tests: veth interface named 'xdp100', with its peer in
+# the network namespace 'solo5-xdp100' with an address of 10.0.0.1/24.
+#
 
 if [ $(id -u) -ne 0 ]; then
     echo "$0: must be root" 1>&2
@@ -40,6 +43,11 @@ Linux)
     ip tuntap add tap101 mode tap
     ip addr add 10.1.0.1/24 dev tap101
     ip link set dev tap101 up
+    ip netns add solo5-xdp100
+    ip link add xdp100 type veth peer name xdp100p netns solo5-xdp100
+    ip link set dev xdp100 up
+    ip -n solo5-xdp100 addr add 10.0.0.1/24 dev xdp100p
+    ip -n solo5-xdp100 link set dev xdp100p up
     ;;
 FreeBSD)
     kldload vmm
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+#define NREQS     32
+#define REQ_SIZE  (16 * 512)
+
+static struct solo5_block_request reqs[NREQS];
+static uint8_t bufs[NREQS][REQ_SIZE];
+
+static uint8_t pattern(unsigned r, size_t i)
+{
+    return (uint8_t)((r * 31) + i);
+}
+
+/*
+ * Waits for and collects one completed request, returning false if it
+ * failed.
+ */
+static bool collect_one(solo5_handle_t h, unsigned *done)
+{
+    struct solo5_block_request *req;
+    solo5_result_t rv;
+
+    while ((rv = solo5_block_complete(h, &req)) == SOLO5_R_AGAIN) {
+        solo5_handle_set_t ready = 0;
+        solo5_yield(solo5_clock_monotonic() + 1000000000ULL, &ready);
+    }
+    if (rv != SOLO5_R_OK || req->result != SOLO5_R_OK)
+        return false;
+    (*done)++;
+    return true;
+}
+
+/*
+ * Submits all requests, keeping as many in flight as the device allows, and
+ * waits for them to complete.
+ */
+static bool run_all(solo5_handle_t h, bool write)
+{
+    unsigned submitted = 0, done = 0;
+
+    while (submitted < NREQS) {
+        reqs[submitted].offset = (solo5_off_t)submitted * REQ_SIZE;
+        reqs[submitted].buf = bufs[submitted];
+        reqs[submitted].size = REQ_SIZE;
+        reqs[submitted].write = write;
+
+        solo5_result_t rv = solo5_block_submit(h, &reqs[submitted]);
+        if (rv == SOLO5_R_OK)
+            submitted++;
+        else if (rv != SOLO5_R_AGAIN || !collect_one(h, &done))
+            return false;
+    }
+    while (done < NREQS) {
+        if (!collect_one(h, &done))
+            return false;
+    }
+
+    return true;
+}
+
+int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
+{
+    puts("\n**** Solo5 standalone test_blk_async ****\n\n");
+
+    solo5_handle_t h;
+    struct solo5_block_info bi;
+    if (solo5_block_acquire("storage", &h, &bi) != SOLO5_R_OK) {
+        puts("Could not acquire 'storage' block device\n");
+        return 99;
+    }
+    if (bi.capacity < NREQS * REQ_SIZE) {
+        puts("Block device too small\n");
+        return 99;
+    }
+
+    /*
+     * Check invalid arguments: requests past the end of the device or not
+     * aligned to the block size must be rejected.
+     */
+    struct solo5_block_request bad = {
+        .offset = bi.capacity, .buf = bufs[0], .size = bi.block_size
+    };
+    solo5_result_t rv = solo5_block_submit(h, &bad);
+    if (rv == SOLO5_R_EUNSPEC) {
+        puts("Asynchronous block I/O not supported\n");
+        return 99;
+    }
+    if (rv != SOLO5_R_EINVAL)
+        return 1;
+    bad.offset = bi.capacity - bi.block_size;
+    bad.size = 2 * bi.block_size;
+    if (solo5_block_submit(h, &bad) != SOLO5_R_EINVAL)
+        return 2;
+    bad.offset = 0;
+    bad.size = bi.block_size - 1;
+    if (solo5_block_submit(h, &bad) != SOLO5_R_EINVAL)
+        return 3;
+
+    for (unsigned r = 0; r < NREQS; r++)
+        for (size_t i = 0; i < REQ_SIZE; i++)
+            bufs[r][i] = pattern(r, i);
+    if (!run_all(h, true))
+        return 4;
+
+    memset(bufs, 0, sizeof bufs);
+    if (!run_all(h, false))
+        return 5;
+    for (unsigned r = 0; r < NREQS; r++)
+        for (size_t i = 0; i < REQ_SIZE; i++)
+            if (bufs[r][i] != pattern(r, i))
+                return 6;
+
+    /*
+     * Synchronous and asynchronous I/O can be mixed.
+     */
+    uint8_t buf[bi.block_size];
+    if (solo5_block_read(h, REQ_SIZE, buf, bi.block_size) != SOLO5_R_OK)
+        return 7;
+    for (size_t i = 0; i < bi.block_size; i++)
+        if (buf[i] != pattern(1, i))
+            return 8;
+
+    puts("SUCCESS\n");
+
+    return SOLO5_EXIT_SUCCESS;
+}
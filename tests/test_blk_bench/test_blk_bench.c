@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+
+/*
+ * Block read throughput benchmark. "storage" and "reference" must be attached
+ * to images with the same contents, e.g. a compressed image and the original.
+ * Checks that the contents of both devices match, then measures sequential
+ * and random read throughput of each device.
+ */
+#define SEQ_PASSES 4
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+static void put_u64(uint64_t v)
+{
+    char buf[21];
+    char *p = buf + sizeof buf - 1;
+
+    *p = '\0';
+    do {
+        *--p = '0' + v % 10;
+        v /= 10;
+    } while (v != 0);
+    puts(p);
+}
+
+static bool acquire(const char *name, solo5_handle_t *h,
+        struct solo5_block_info *bi)
+{
+    if (solo5_block_acquire(name, h, bi) != SOLO5_R_OK) {
+        puts("Could not acquire '");
+        puts(name);
+        puts("' block device\n");
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Report throughput of reading (nblocks) of (block_size) in (elapsed) ns.
+ */
+static void report(const char *name, const char *what, uint64_t nblocks,
+        uint64_t block_size, solo5_time_t elapsed)
+{
+    if (elapsed == 0)
+        elapsed = 1;
+    puts(name);
+    puts(": ");
+    puts(what);
+    puts(": ");
+    put_u64(nblocks * block_size * 1000 / elapsed);
+    puts(" MB/s\n");
+}
+
+static bool bench(const char *name, solo5_handle_t h,
+        const struct solo5_block_info *bi)
+{
+    uint8_t buf[bi->block_size];
+    uint64_t nblocks = bi->capacity / bi->block_size;
+
+    solo5_time_t start = solo5_clock_monotonic();
+    for (unsigned pass = 0; pass != SEQ_PASSES; pass++) {
+        for (uint64_t i = 0; i != nblocks; i++) {
+            if (solo5_block_read(h, i * bi->block_size, buf, bi->block_size)
+                    != SOLO5_R_OK)
+                return false;
+        }
+    }
+    report(name, "sequential", SEQ_PASSES * nblocks, bi->block_size,
+            solo5_clock_monotonic() - start);
+
+    uint64_t x = 1;
+    start = solo5_clock_monotonic();
+    for (uint64_t i = 0; i != nblocks; i++) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint64_t block = (x >> 33) % nblocks;
+        if (solo5_block_read(h, block * bi->block_size, buf, bi->block_size)
+                != SOLO5_R_OK)
+            return false;
+    }
+    report(name, "random", nblocks, bi->block_size,
+            solo5_clock_monotonic() - start);
+    return true;
+}
+
+int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
+{
+    puts("\n**** Solo5 standalone test_blk_bench ****\n\n");
+
+    solo5_handle_t sh, rh;
+    struct solo5_block_info sbi, rbi;
+    if (!acquire("storage", &sh, &sbi) || !acquire("reference", &rh, &rbi))
+        return 99;
+    if (sbi.capacity != rbi.capacity || sbi.block_size != rbi.block_size) {
+        puts("Devices differ in size\n");
+        return 1;
+    }
+
+    uint8_t sbuf[sbi.block_size], rbuf[rbi.block_size];
+    for (solo5_off_t offset = 0; offset < sbi.capacity;
+            offset += sbi.block_size) {
+        if (solo5_block_read(sh, offset, sbuf, sbi.block_size) != SOLO5_R_OK ||
+                solo5_block_read(rh, offset, rbuf, rbi.block_size) !=
+                SOLO5_R_OK) {
+            puts("Read failed\n");
+            return 2;
+        }
+        if (memcmp(sbuf, rbuf, sbi.block_size) != 0) {
+            puts("Contents differ\n");
+            return 3;
+        }
+    }
+
+    if (!bench("storage", sh, &sbi) || !bench("reference", rh, &rbi)) {
+        puts("Read failed\n");
+        return 4;
+    }
+
+    puts("SUCCESS\n");
+
+    return SOLO5_EXIT_SUCCESS;
+}
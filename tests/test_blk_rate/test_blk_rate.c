@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+
+/*
+ * The tender is expected to be run with --block-rate:storage=ops=100, giving
+ * a burst of 10 operations. Reading NUM_READS blocks must then be throttled
+ * and take at least MIN_ELAPSED.
+ */
+#define NUM_READS   50
+#define MIN_ELAPSED 300000000ULL
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
+{
+    puts("\n**** Solo5 standalone test_blk_rate ****\n\n");
+
+    solo5_handle_t h;
+    struct solo5_block_info bi;
+    if (solo5_block_acquire("storage", &h, &bi) != SOLO5_R_OK) {
+        puts("Could not acquire 'storage' block device\n");
+        return 99;
+    }
+
+    uint8_t buf[bi.block_size];
+    unsigned again = 0;
+    solo5_time_t start = solo5_clock_monotonic();
+
+    for (unsigned i = 0; i != NUM_READS; ) {
+        solo5_result_t rc = solo5_block_read(h, 0, buf, bi.block_size);
+        if (rc == SOLO5_R_AGAIN) {
+            again++;
+            solo5_yield(solo5_clock_monotonic() + 1000000ULL, NULL);
+            continue;
+        }
+        if (rc != SOLO5_R_OK) {
+            puts("Read failed\n");
+            return 1;
+        }
+        i++;
+    }
+
+    if (again == 0 || solo5_clock_monotonic() - start < MIN_ELAPSED) {
+        puts("Rate limit not enforced\n");
+        return 2;
+    }
+
+    puts("SUCCESS\n");
+
+    return SOLO5_EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+
+/*
+ * The tender is expected to be run with --block:storage=ro:PATH, where PATH
+ * is not all zeroes. If the command line is "map", the device must also be
+ * mappable with solo5_block_map().
+ */
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+int solo5_app_main(const struct solo5_start_info *si)
+{
+    puts("\n**** Solo5 standalone test_blk_ro ****\n\n");
+
+    solo5_handle_t h;
+    struct solo5_block_info bi;
+    if (solo5_block_acquire("storage", &h, &bi) != SOLO5_R_OK) {
+        puts("Could not acquire 'storage' block device\n");
+        return 99;
+    }
+
+    uint8_t buf[bi.block_size];
+    memset(buf, 0, bi.block_size);
+    if (solo5_block_write(h, 0, buf, bi.block_size) == SOLO5_R_OK) {
+        puts("Write to read-only device succeeded\n");
+        return 1;
+    }
+
+    const uint8_t *map = NULL;
+    solo5_result_t rc = solo5_block_map(h, &map);
+    if (strcmp(si->cmdline, "map") == 0) {
+        if (rc != SOLO5_R_OK) {
+            puts("Could not map 'storage' block device\n");
+            return 2;
+        }
+    }
+    else if (rc != SOLO5_R_EUNSPEC) {
+        puts("Unexpected result from solo5_block_map()\n");
+        return 3;
+    }
+
+    /*
+     * Read the whole device, checking that it is not all zeroes and matches
+     * the mapping, if any.
+     */
+    bool nonzero = false;
+    for (solo5_off_t offset = 0; offset < bi.capacity;
+            offset += bi.block_size) {
+        if (solo5_block_read(h, offset, buf, bi.block_size) != SOLO5_R_OK) {
+            puts("Read failed\n");
+            return 4;
+        }
+        if (map != NULL && memcmp(buf, map + offset, bi.block_size) != 0) {
+            puts("Read does not match mapping\n");
+            return 5;
+        }
+        for (size_t i = 0; i != bi.block_size; i++)
+            nonzero |= (buf[i] != 0);
+    }
+    if (!nonzero) {
+        puts("Read all zeroes\n");
+        return 6;
+    }
+
+    puts("SUCCESS\n");
+
+    return SOLO5_EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+
+/*
+ * Guest memory bandwidth benchmark. Measures sequential write, read and copy
+ * throughput over buffers larger than the host's caches, so that the results
+ * reflect the placement of guest memory relative to the vCPU.
+ */
+#define PASSES 4
+#define MAX_BUFFER_SIZE (64UL << 20)
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+static void put_u64(uint64_t v)
+{
+    char buf[21];
+    char *p = buf + sizeof buf - 1;
+
+    *p = '\0';
+    do {
+        *--p = '0' + v % 10;
+        v /= 10;
+    } while (v != 0);
+    puts(p);
+}
+
+/*
+ * Report throughput of transferring (bytes) in (elapsed) ns.
+ */
+static void report(const char *what, uint64_t bytes, solo5_time_t elapsed)
+{
+    if (elapsed == 0)
+        elapsed = 1;
+    puts(what);
+    puts(": ");
+    put_u64(bytes * 1000 / elapsed);
+    puts(" MB/s\n");
+}
+
+static volatile uint64_t sink;
+
+int solo5_app_main(const struct solo5_start_info *si)
+{
+    puts("\n**** Solo5 standalone test_mem_bw ****\n\n");
+
+    /*
+     * Leave at least half of the heap for the stack, which grows down from
+     * its end.
+     */
+    size_t size = si->heap_size / 4;
+    if (size > MAX_BUFFER_SIZE)
+        size = MAX_BUFFER_SIZE;
+    size &= ~(size_t)(sizeof(uint64_t) - 1);
+    if (size == 0) {
+        puts("Not enough memory\n");
+        return 1;
+    }
+    uint64_t *src = (uint64_t *)si->heap_start;
+    uint64_t *dst = (uint64_t *)(si->heap_start + size);
+    size_t n = size / sizeof(uint64_t);
+
+    puts("buffer size: ");
+    put_u64(size >> 20);
+    puts(" MB\n");
+
+    solo5_time_t start = solo5_clock_monotonic();
+    for (unsigned pass = 0; pass != PASSES; pass++) {
+        for (size_t i = 0; i != n; i++)
+            src[i] = i + pass;
+    }
+    report("write", (uint64_t)PASSES * size, solo5_clock_monotonic() - start);
+
+    uint64_t sum = 0;
+    start = solo5_clock_monotonic();
+    for (unsigned pass = 0; pass != PASSES; pass++) {
+        for (size_t i = 0; i != n; i++)
+            sum += src[i];
+    }
+    report("read", (uint64_t)PASSES * size, solo5_clock_monotonic() - start);
+    sink = sum;
+
+    start = solo5_clock_monotonic();
+    for (unsigned pass = 0; pass != PASSES; pass++) {
+        for (size_t i = 0; i != n; i++)
+            dst[i] = src[i];
+    }
+    /* A copy reads and writes each byte. */
+    report("copy", (uint64_t)PASSES * size * 2,
+            solo5_clock_monotonic() - start);
+
+    for (size_t i = 0; i != n; i++) {
+        if (dst[i] != i + PASSES - 1) {
+            puts("Copy mismatch\n");
+            return 2;
+        }
+    }
+
+    puts("SUCCESS\n");
+
+    return SOLO5_EXIT_SUCCESS;
+}
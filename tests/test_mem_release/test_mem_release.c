@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+#define REGION_SIZE (256 * 1024)
+#define PAGE_SIZE 4096
+
+static int fill_and_check(uint8_t *p, size_t size, uint8_t seed)
+{
+    size_t i;
+
+    for (i = 0; i < size; i += PAGE_SIZE)
+        p[i] = (uint8_t)(seed + (i / PAGE_SIZE));
+    for (i = 0; i < size; i += PAGE_SIZE)
+        if (p[i] != (uint8_t)(seed + (i / PAGE_SIZE)))
+            return 1;
+    return 0;
+}
+
+int solo5_app_main(const struct solo5_start_info *si)
+{
+    puts("\n**** Solo5 standalone test_mem_release ****\n\n");
+
+    /*
+     * Use a page-aligned region at the bottom of the heap, well away from
+     * the stack at the top of the heap.
+     */
+    uintptr_t start = (si->heap_start + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+    uint8_t *p = (uint8_t *)start;
+
+    if (si->heap_size < 2 * REGION_SIZE) {
+        puts("Heap too small\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+
+    /* Ranges outside of the heap must be rejected. */
+    if (solo5_mem_release(si->heap_start - PAGE_SIZE, PAGE_SIZE)
+            != SOLO5_R_EINVAL) {
+        puts("Release below heap was not rejected\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+    if (solo5_mem_release(si->heap_start, si->heap_size + PAGE_SIZE)
+            != SOLO5_R_EINVAL) {
+        puts("Release past end of heap was not rejected\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+    /* A range not covering a whole page is a no-op. */
+    if (solo5_mem_release(start + 1, PAGE_SIZE - 2) != SOLO5_R_OK) {
+        puts("Release of partial page failed\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+
+    if (fill_and_check(p, REGION_SIZE, 1) != 0) {
+        puts("Initial fill failed\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+    if (solo5_mem_release(start, REGION_SIZE) != SOLO5_R_OK) {
+        puts("Release failed\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+    /*
+     * With "zero", the target is expected to actually drop released pages,
+     * which then read back as zero. Check every byte, as a release that
+     * dropped only some of the pages would leave stale data behind.
+     */
+    if (strcmp(si->cmdline, "zero") == 0) {
+        for (size_t i = 0; i < REGION_SIZE; i++) {
+            if (p[i] != 0) {
+                puts("Released memory did not read back as zero\n");
+                return SOLO5_EXIT_FAILURE;
+            }
+        }
+    }
+    if (solo5_mem_reuse(start, REGION_SIZE) != SOLO5_R_OK) {
+        puts("Reuse failed\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+    if (fill_and_check(p, REGION_SIZE, 2) != 0) {
+        puts("Fill after reuse failed\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+
+    puts("SUCCESS\n");
+    return SOLO5_EXIT_SUCCESS;
+}
@@ -0,0 +1,76 @@
+/* Generated by solo5-elftool version 8c3c4b0-dirty, do not edit */
+
+#define MFT_ENTRIES 64
+#include "mft_abi.h"
+
+MFT1_NOTE_DECLARE_BEGIN
+{
+  .version = MFT_VERSION, .entries = 64,
+  .e = {
+    { .name = "", .type = MFT_RESERVED_FIRST },
+    { .name = "storage0", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage1", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage2", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage3", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage4", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage5", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage6", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage7", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage8", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage9", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage10", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage11", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage12", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage13", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage14", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage15", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage16", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage17", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage18", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage19", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage20", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage21", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage22", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage23", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage24", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage25", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage26", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage27", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage28", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage29", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage30", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage31", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage32", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage33", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage34", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage35", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage36", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage37", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage38", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage39", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage40", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage41", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage42", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage43", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage44", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage45", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage46", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage47", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage48", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage49", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage50", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage51", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage52", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage53", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage54", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage55", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage56", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage57", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage58", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage59", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage60", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage61", .type = MFT_DEV_BLOCK_BASIC },
+    { .name = "storage62", .type = MFT_DEV_BLOCK_BASIC },
+  }
+}
+MFT1_NOTE_DECLARE_END
@@ -0,0 +1,14 @@
+/* Generated by solo5-elftool version 8c3c4b0-dirty, do not edit */
+
+#define MFT_ENTRIES 2
+#include "mft_abi.h"
+
+MFT1_NOTE_DECLARE_BEGIN
+{
+  .version = MFT_VERSION, .entries = 2,
+  .e = {
+    { .name = "", .type = MFT_RESERVED_FIRST },
+    { .name = "service0", .type = MFT_DEV_NET_BASIC },
+  }
+}
+MFT1_NOTE_DECLARE_END
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+
+/*
+ * Sends a UDP datagram to a closed port on the host (10.0.0.1), leaving the
+ * UDP checksum to be computed by the host, and waits for the resulting ICMP
+ * port unreachable error. The host silently drops UDP datagrams with an
+ * incorrect checksum, so receiving the error shows that the offload metadata
+ * was honoured.
+ */
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+#define ETHERTYPE_IP  0x0800
+#define ETHERTYPE_ARP 0x0806
+#define HLEN_ETHER  6
+#define PLEN_IPV4  4
+#define IPPROTO_ICMP 1
+#define IPPROTO_UDP 17
+
+struct ether {
+    uint8_t target[HLEN_ETHER];
+    uint8_t source[HLEN_ETHER];
+    uint16_t type;
+};
+
+struct arp {
+    uint16_t htype;
+    uint16_t ptype;
+    uint8_t hlen;
+    uint8_t plen;
+    uint16_t op;
+    uint8_t sha[HLEN_ETHER];
+    uint8_t spa[PLEN_IPV4];
+    uint8_t tha[HLEN_ETHER];
+    uint8_t tpa[PLEN_IPV4];
+};
+
+struct ip {
+    uint8_t version_ihl;
+    uint8_t type;
+    uint16_t length;
+    uint16_t id;
+    uint16_t flags_offset;
+    uint8_t ttl;
+    uint8_t proto;
+    uint16_t checksum;
+    uint8_t src_ip[PLEN_IPV4];
+    uint8_t dst_ip[PLEN_IPV4];
+};
+
+struct udp {
+    uint16_t src_port;
+    uint16_t dst_port;
+    uint16_t length;
+    uint16_t checksum;
+};
+
+struct icmp {
+    uint8_t type;
+    uint8_t code;
+    uint16_t checksum;
+    uint16_t unused[2];
+};
+
+struct arppkt {
+    struct ether ether;
+    struct arp arp;
+};
+
+#define UDP_DATA_LEN 32
+
+struct udppkt {
+    struct ether ether;
+    struct ip ip;
+    struct udp udp;
+    uint8_t data[UDP_DATA_LEN];
+};
+
+struct icmppkt {
+    struct ether ether;
+    struct ip ip;
+    struct icmp icmp;
+};
+
+static uint16_t htons(uint16_t x)
+{
+    return (x << 8) + (x >> 8);
+}
+
+/*
+ * Adds (buf, len) to the unfolded Internet checksum (sum).
+ */
+static uint32_t csum_add(uint32_t sum, const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+
+    for (; len > 1; p += 2, len -= 2)
+        sum += (p[0] << 8) | p[1];
+    if (len)
+        sum += p[0] << 8;
+    return sum;
+}
+
+static uint16_t csum_fold(uint32_t sum)
+{
+    while (sum >> 16)
+        sum = (sum & 0xffff) + (sum >> 16);
+    return sum;
+}
+
+static uint8_t ipaddr[PLEN_IPV4] = { 0x0a, 0x00, 0x00, 0x02 }; /* 10.0.0.2 */
+static uint8_t host_ipaddr[PLEN_IPV4] = { 0x0a, 0x00, 0x00, 0x01 };
+static uint8_t macaddr_brd[HLEN_ETHER] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+static uint8_t host_macaddr[HLEN_ETHER];
+static bool host_macaddr_known;
+
+static solo5_handle_t h;
+static struct solo5_net_info ni;
+
+static void send_arp(uint16_t op, const uint8_t *tha, const uint8_t *tpa)
+{
+    struct arppkt p;
+
+    memcpy(p.ether.source, ni.mac_address, HLEN_ETHER);
+    memcpy(p.ether.target, op == 1 ? macaddr_brd : tha, HLEN_ETHER);
+    p.ether.type = htons(ETHERTYPE_ARP);
+    p.arp.htype = htons(1);
+    p.arp.ptype = htons(ETHERTYPE_IP);
+    p.arp.hlen = HLEN_ETHER;
+    p.arp.plen = PLEN_IPV4;
+    p.arp.op = htons(op);
+    memcpy(p.arp.sha, ni.mac_address, HLEN_ETHER);
+    memcpy(p.arp.tha, tha, HLEN_ETHER);
+    memcpy(p.arp.spa, ipaddr, PLEN_IPV4);
+    memcpy(p.arp.tpa, tpa, PLEN_IPV4);
+
+    if (solo5_net_write(h, (uint8_t *)&p, sizeof p) != SOLO5_R_OK)
+        puts("Could not send ARP packet\n");
+}
+
+static bool send_udp(void)
+{
+    struct udppkt p;
+    struct solo5_net_offload offload = {
+        .flags = SOLO5_NET_OFFLOAD_F_NEEDS_CSUM,
+        .gso_type = SOLO5_NET_GSO_NONE,
+        .csum_start = sizeof (struct ether) + sizeof (struct ip),
+        .csum_offset = 6 /* offsetof(struct udp, checksum) */
+    };
+    uint16_t udp_len = sizeof (struct udp) + UDP_DATA_LEN;
+
+    memcpy(p.ether.source, ni.mac_address, HLEN_ETHER);
+    memcpy(p.ether.target, host_macaddr, HLEN_ETHER);
+    p.ether.type = htons(ETHERTYPE_IP);
+    p.ip.version_ihl = 0x45;
+    p.ip.type = 0;
+    p.ip.length = htons(sizeof (struct ip) + udp_len);
+    p.ip.id = 0;
+    p.ip.flags_offset = 0;
+    p.ip.ttl = 64;
+    p.ip.proto = IPPROTO_UDP;
+    p.ip.checksum = 0;
+    memcpy(p.ip.src_ip, ipaddr, PLEN_IPV4);
+    memcpy(p.ip.dst_ip, host_ipaddr, PLEN_IPV4);
+    p.ip.checksum = htons(~csum_fold(csum_add(0, &p.ip, sizeof p.ip)));
+
+    p.udp.src_port = htons(9);
+    p.udp.dst_port = htons(9); /* discard, assumed closed on the host */
+    p.udp.length = htons(udp_len);
+    memset(p.data, 'x', UDP_DATA_LEN);
+
+    /*
+     * Only the pseudo-header checksum, the host computes the rest.
+     */
+    uint32_t sum = csum_add(0, p.ip.src_ip, 2 * PLEN_IPV4);
+    sum += IPPROTO_UDP + udp_len;
+    p.udp.checksum = htons(csum_fold(sum));
+
+    return solo5_net_write_offload(h, &offload, (uint8_t *)&p,
+            sizeof p) == SOLO5_R_OK;
+}
+
+static uint8_t buf[SOLO5_NET_OFFLOAD_MAX_PACKET];
+
+/*
+ * Handles the received packet (buf, len). Returns true if it is the expected
+ * ICMP port unreachable error.
+ */
+static bool handle_packet(size_t len)
+{
+    struct ether *e = (struct ether *)buf;
+    if (memcmp(e->target, ni.mac_address, HLEN_ETHER) &&
+            memcmp(e->target, macaddr_brd, HLEN_ETHER))
+        return false;
+
+    if (htons(e->type) == ETHERTYPE_ARP && len >= sizeof (struct arppkt)) {
+        struct arppkt *p = (struct arppkt *)buf;
+        if (memcmp(p->arp.tpa, ipaddr, PLEN_IPV4))
+            return false;
+        if (p->arp.op == htons(1))
+            send_arp(2, p->arp.sha, p->arp.spa);
+        else if (p->arp.op == htons(2) &&
+                memcmp(p->arp.spa, host_ipaddr, PLEN_IPV4) == 0) {
+            memcpy(host_macaddr, p->arp.sha, HLEN_ETHER);
+            host_macaddr_known = true;
+        }
+        return false;
+    }
+
+    if (htons(e->type) == ETHERTYPE_IP && len >= sizeof (struct icmppkt)) {
+        struct icmppkt *p = (struct icmppkt *)buf;
+        return p->ip.version_ihl == 0x45 && p->ip.proto == IPPROTO_ICMP &&
+            memcmp(p->ip.src_ip, host_ipaddr, PLEN_IPV4) == 0 &&
+            p->icmp.type == 3 && p->icmp.code == 3;
+    }
+
+    return false;
+}
+
+/*
+ * Handles all pending packets. Returns true if the expected ICMP error has
+ * been received.
+ */
+static bool receive(void)
+{
+    struct solo5_net_offload offload;
+    size_t len;
+
+    while (solo5_net_read_offload(h, &offload, buf, sizeof buf, &len)
+            == SOLO5_R_OK) {
+        if (handle_packet(len))
+            return true;
+    }
+    return false;
+}
+
+static const solo5_time_t NSEC_PER_SEC = 1000000000ULL;
+
+int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
+{
+    puts("\n**** Solo5 standalone test_net_offload ****\n\n");
+
+    if (solo5_net_acquire("service0", &h, &ni) != SOLO5_R_OK) {
+        puts("Could not acquire 'service0' network\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+    if (!ni.offload) {
+        puts("Offload not enabled for 'service0'\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+
+    /*
+     * Resolve the host's MAC address, then send a datagram once per second
+     * until the error is received.
+     */
+    for (int i = 0; i < 30; i++) {
+        bool had_macaddr = host_macaddr_known;
+
+        if (!had_macaddr)
+            send_arp(1, macaddr_brd, host_ipaddr);
+        else if (!send_udp()) {
+            puts("Could not send UDP datagram\n");
+            return SOLO5_EXIT_FAILURE;
+        }
+
+        solo5_time_t deadline = solo5_clock_monotonic() + NSEC_PER_SEC;
+        while (solo5_clock_monotonic() < deadline &&
+                had_macaddr == host_macaddr_known) {
+            solo5_handle_set_t ready_set = 0;
+            solo5_yield(deadline, &ready_set);
+            if ((ready_set & (1ULL << h)) && receive()) {
+                puts("SUCCESS\n");
+                return SOLO5_EXIT_SUCCESS;
+            }
+        }
+    }
+
+    puts("No ICMP error received\n");
+    return SOLO5_EXIT_FAILURE;
+}
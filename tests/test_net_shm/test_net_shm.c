@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+/*
+ * Exchanges frames between two instances of this test connected by a shared
+ * memory network link. The "ping" side sends NFRAMES frames (or the number
+ * given as "ping N"), keeping up to WINDOW in flight, and checks that they
+ * are echoed back in order by the "pong" side. Finally, it sends a frame with
+ * the type TYPE_DONE, upon which both sides exit.
+ */
+#define NFRAMES 50000
+#define WINDOW  64
+
+#define TYPE_DATA 0x88b5        /* IEEE 802 local experimental */
+#define TYPE_DONE 0x88b6
+
+static const solo5_time_t NSEC_PER_SEC = 1000000000ULL;
+
+struct frame {
+    uint8_t target[6];
+    uint8_t source[6];
+    uint16_t type;
+    uint32_t seq;
+    uint8_t payload[1000];
+};
+
+static solo5_handle_t h;
+static struct solo5_net_info ni;
+
+static bool send_frame(uint16_t type, uint32_t seq)
+{
+    struct frame f;
+
+    memset(f.target, 0xff, sizeof f.target);
+    memcpy(f.source, ni.mac_address, sizeof f.source);
+    f.type = type;
+    f.seq = seq;
+    /*
+     * The payload contents do not matter, except for a check byte at the
+     * end.
+     */
+    f.payload[sizeof f.payload - 1] = (uint8_t)seq;
+    return solo5_net_write(h, (uint8_t *)&f, sizeof f) == SOLO5_R_OK;
+}
+
+/*
+ * Receive a frame into (*f), waiting for up to a second.
+ */
+static bool recv_frame(struct frame *f)
+{
+    solo5_time_t deadline = solo5_clock_monotonic() + NSEC_PER_SEC;
+    size_t len;
+
+    for (;;) {
+        solo5_result_t rc = solo5_net_read(h, (uint8_t *)f, sizeof *f, &len);
+        if (rc == SOLO5_R_OK)
+            break;
+        if (rc != SOLO5_R_AGAIN || solo5_clock_monotonic() >= deadline)
+            return false;
+        solo5_yield(deadline, NULL);
+    }
+    if (len != sizeof *f) {
+        puts("Received frame of unexpected size\n");
+        return false;
+    }
+    return true;
+}
+
+static bool ping(uint32_t nframes)
+{
+    struct frame f;
+    uint32_t sent = 0, received = 0;
+
+    while (received < nframes) {
+        while (sent < nframes && sent - received < WINDOW) {
+            if (!send_frame(TYPE_DATA, sent)) {
+                puts("Write error\n");
+                return false;
+            }
+            sent++;
+        }
+        if (!recv_frame(&f)) {
+            puts("Timed out waiting for echo\n");
+            return false;
+        }
+        if (f.type != TYPE_DATA || f.seq != received ||
+                f.payload[sizeof f.payload - 1] != (uint8_t)received) {
+            puts("Received unexpected frame\n");
+            return false;
+        }
+        received++;
+    }
+    return send_frame(TYPE_DONE, 0);
+}
+
+static bool pong(void)
+{
+    struct frame f;
+
+    for (;;) {
+        /*
+         * Wait for the first frame for longer, as our peer may start later.
+         */
+        solo5_handle_set_t ready_set = 0;
+        solo5_yield(solo5_clock_monotonic() + 10 * NSEC_PER_SEC, &ready_set);
+        if (!(ready_set & (1ULL << h))) {
+            puts("Timed out waiting for peer\n");
+            return false;
+        }
+
+        while (solo5_net_read(h, (uint8_t *)&f, sizeof f, &(size_t){ 0 })
+                == SOLO5_R_OK) {
+            if (f.type == TYPE_DONE)
+                return true;
+            memcpy(f.source, ni.mac_address, sizeof f.source);
+            if (solo5_net_write(h, (uint8_t *)&f, sizeof f) != SOLO5_R_OK) {
+                puts("Write error\n");
+                return false;
+            }
+        }
+    }
+}
+
+int solo5_app_main(const struct solo5_start_info *si)
+{
+    puts("\n**** Solo5 standalone test_net_shm ****\n\n");
+
+    if (solo5_net_acquire("service0", &h, &ni) != SOLO5_R_OK) {
+        puts("Could not acquire 'service0' network\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+
+    bool ok;
+    if (strcmp(si->cmdline, "ping") == 0)
+        ok = ping(NFRAMES);
+    else if (strncmp(si->cmdline, "ping ", 5) == 0 && si->cmdline[5] != 0) {
+        uint32_t nframes = 0;
+        for (const char *p = si->cmdline + 5; *p; p++) {
+            if (*p < '0' || *p > '9') {
+                puts("Invalid frame count\n");
+                return SOLO5_EXIT_FAILURE;
+            }
+            nframes = nframes * 10 + (*p - '0');
+        }
+        ok = ping(nframes);
+    }
+    else if (strcmp(si->cmdline, "pong") == 0)
+        ok = pong();
+    else {
+        puts("Usage: test_net_shm ping [ N ] | pong\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+
+    if (ok) {
+        puts("SUCCESS\n");
+        return SOLO5_EXIT_SUCCESS;
+    }
+    else {
+        puts("FAILURE\n");
+        return SOLO5_EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2015-2026 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a sandboxed execution environment.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../bindings/lib.c"
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+/*
+ * Burn CPU for a while in a known call chain, for use with the hvt tender's
+ * --x-profile option.
+ */
+#define SPIN_NSECS (500 * 1000000ULL)
+
+static volatile uint64_t counter;
+
+__attribute__((noinline)) static void spin_inner(void)
+{
+    for (int i = 0; i < 10000; i++)
+        counter++;
+}
+
+__attribute__((noinline)) static void spin_outer(solo5_time_t until)
+{
+    while (solo5_clock_monotonic() < until)
+        spin_inner();
+}
+
+int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
+{
+    puts("\n**** Solo5 standalone test_profile ****\n\n");
+
+    spin_outer(solo5_clock_monotonic() + SPIN_NSECS);
+
+    puts("SUCCESS\n");
+    return SOLO5_EXIT_SUCCESS;
+}
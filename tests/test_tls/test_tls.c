@@ -88,7 +88,51 @@ void __attribute__ ((noinline)) set_data(uint64_t data)
     _data = data;
 }
 
-int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
+static void put_u64(uint64_t v)
+{
+    char buf[21];
+    char *p = buf + sizeof buf - 1;
+
+    *p = '\0';
+    do {
+        *--p = '0' + v % 10;
+        v /= 10;
+    } while (v != 0);
+    puts(p);
+}
+
+/*
+ * Measure the rate at which the TLS base can be switched, as done by green
+ * thread runtimes on every context switch.
+ */
+#define BENCH_SWITCHES 200000
+
+static int bench(void)
+{
+    solo5_time_t start = solo5_clock_monotonic();
+    for (unsigned i = 0; i != BENCH_SWITCHES; i += 2) {
+        if (solo5_set_tls_base((uintptr_t)tcb1.tp) != SOLO5_R_OK)
+            return 7;
+        if (get_data() != 1)
+            return 8;
+        if (solo5_set_tls_base((uintptr_t)tcb2.tp) != SOLO5_R_OK)
+            return 7;
+        if (get_data() != 2)
+            return 8;
+    }
+    solo5_time_t elapsed = solo5_clock_monotonic() - start;
+    if (elapsed == 0)
+        elapsed = 1;
+
+    puts("TLS switches: ");
+    put_u64((uint64_t)BENCH_SWITCHES * 1000000000ULL / elapsed);
+    puts("/s (");
+    put_u64(elapsed / BENCH_SWITCHES);
+    puts(" ns each)\n");
+    return 0;
+}
+
+int solo5_app_main(const struct solo5_start_info *si)
 {
     puts("\n**** Solo5 standalone test_tls ****\n\n");
 
@@ -118,6 +162,12 @@ int solo5_app_main(const struct solo5_start_info *si __attribute__((unused)))
     if (get_data() != 2)
         return 6;
 
+    if (strcmp(si->cmdline, "bench") == 0) {
+        int rc = bench();
+        if (rc != 0)
+            return rc;
+    }
+
     puts("SUCCESS\n");
     return SOLO5_EXIT_SUCCESS;
 }
@@ -84,11 +84,15 @@ setup() {
   NET0_IP=10.0.0.2
   NET1=tap101
   NET1_IP=10.1.0.2
+  XDP0=xdp100
+  XDP0_NETNS=solo5-xdp100
+  BLKTOOL=../blktool/solo5-blktool
+  ELFTOOL=../elftool/solo5-elftool
 }
 
 teardown() {
   echo "${output}"
-  rm -f ${BATS_TMPDIR}/storage*.img
+  rm -f ${BATS_TMPDIR}/storage*.img ${BATS_TMPDIR}/*.pli ${BATS_TMPDIR}/bench.json
 }
 
 setup_block() {
@@ -96,6 +100,38 @@ setup_block() {
   dd if=/dev/zero of=${BLOCK} bs=4k count=1024 status=none
 }
 
+# Sets up a random base image, a copy of it with test_blk run on it as a
+# reference, and an empty overlay on top of the base image.
+setup_overlay() {
+  BLOCK=${BATS_TMPDIR}/storage.img
+  DELTA=${BATS_TMPDIR}/storage-delta.img
+  dd if=/dev/urandom of=${BLOCK} bs=4k count=1024 status=none
+  cp ${BLOCK} ${BATS_TMPDIR}/storage-base.img
+  cp ${BLOCK} ${BATS_TMPDIR}/storage-ref.img
+  run ${SPT_TENDER:-${HVT_TENDER}} --mem=2 \
+      --block:storage=${BATS_TMPDIR}/storage-ref.img -- \
+      test_blk/test_blk.${BATS_TEST_NAME##*_}
+  expect_success
+  ${BLKTOOL} create-overlay ${BLOCK} ${DELTA}
+}
+
+# Checks that the base image is unchanged, and that merging the overlay
+# produces the same result as running on the reference image.
+check_overlay() {
+  cmp ${BLOCK} ${BATS_TMPDIR}/storage-base.img
+  ${BLKTOOL} merge-overlay ${BLOCK} ${DELTA} ${BATS_TMPDIR}/storage-merged.img
+  cmp ${BATS_TMPDIR}/storage-merged.img ${BATS_TMPDIR}/storage-ref.img
+}
+
+# Sets up a partly compressible image, and a compressed copy of it.
+setup_compressed() {
+  BLOCK=${BATS_TMPDIR}/storage.img
+  BLOCK_CMP=${BATS_TMPDIR}/storage-cmp.img
+  { ${SEQ} 1 100000; head -c 1048576 /dev/urandom; } >${BLOCK}
+  truncate -s 4M ${BLOCK}
+  ${BLKTOOL} compress ${BLOCK} ${BLOCK_CMP} 4096
+}
+
 hvt_run() {
   run ${TIMEOUT} --foreground 60s ${HVT_TENDER} --mem=2 "$@"
 }
@@ -235,6 +271,36 @@ xen_expect_abort() {
   expect_success
 }
 
+@test "prelink hvt" {
+  ${ELFTOOL} prelink test_hello/test_hello.hvt ${BATS_TMPDIR}/test_hello.hvt.pli
+  run ${ELFTOOL} query-abi ${BATS_TMPDIR}/test_hello.hvt.pli
+  [ "$status" -eq 0 ]
+  [[ "$output" == *"\"target\": \"hvt\""* ]]
+  hvt_run ${BATS_TMPDIR}/test_hello.hvt.pli Hello_Solo5
+  expect_success
+}
+
+@test "prelink spt" {
+  ${ELFTOOL} prelink test_hello/test_hello.spt ${BATS_TMPDIR}/test_hello.spt.pli
+  spt_run ${BATS_TMPDIR}/test_hello.spt.pli Hello_Solo5
+  expect_success
+}
+
+# Smoke tests only, run bench/run-bench.sh by hand for the full suite.
+@test "bench hvt" {
+  skip_unless_host_is Linux
+
+  run ../bench/run-bench.sh -t hvt -b hypercall -B -o ${BATS_TMPDIR}/bench.json
+  [ "$status" -eq 0 ]
+  grep -q '"metric": "hypercall_ns"' ${BATS_TMPDIR}/bench.json
+}
+
+@test "bench spt" {
+  run ../bench/run-bench.sh -t spt -b hypercall -B -o ${BATS_TMPDIR}/bench.json
+  [ "$status" -eq 0 ]
+  grep -q '"metric": "hypercall_ns"' ${BATS_TMPDIR}/bench.json
+}
+
 @test "quiet hvt" {
   hvt_run -- test_quiet/test_quiet.hvt --solo5:quiet
   expect_success
@@ -282,6 +348,31 @@ xen_expect_abort() {
   expect_success
 }
 
+@test "mem_release hvt" {
+  # Only MADV_REMOVE, used on Linux, guarantees that released pages are zeroed.
+  if [ "${CONFIG_HOST}" = "Linux" ]; then
+    hvt_run -- test_mem_release/test_mem_release.hvt zero
+  else
+    hvt_run test_mem_release/test_mem_release.hvt
+  fi
+  expect_success
+}
+
+@test "mem_release virtio" {
+  virtio_run test_mem_release/test_mem_release.virtio
+  virtio_expect_success
+}
+
+@test "mem_release spt" {
+  spt_run -- test_mem_release/test_mem_release.spt zero
+  expect_success
+}
+
+@test "mem_release xen" {
+  xen_run test_mem_release/test_mem_release.xen
+  expect_success
+}
+
 @test "exception hvt" {
   hvt_run test_exception/test_exception.hvt
   expect_abort
@@ -390,6 +481,20 @@ xen_expect_abort() {
   virtio_expect_success
 }
 
+@test "tls_bench hvt" {
+  skip_unless_host_is Linux
+
+  hvt_run test_tls/test_tls.hvt bench
+  expect_success
+  [[ "$output" == *"TLS switches: "* ]]
+}
+
+@test "tls_bench spt" {
+  spt_run test_tls/test_tls.spt bench
+  expect_success
+  [[ "$output" == *"TLS switches: "* ]]
+}
+
 @test "tls spt" {
   spt_run test_tls/test_tls.spt
   expect_success
@@ -475,6 +580,24 @@ xen_expect_abort() {
   [ "$status" -eq 159 ] # SIGSYS
 }
 
+@test "placement hvt" {
+  skip_unless_host_is Linux
+  [ -d /sys/devices/system/node/node0 ] || skip "no NUMA support"
+  hvt_run --cpu=0 --numa-node=0 --mem-prefault -- test_hello/test_hello.hvt \
+      Hello_Solo5
+  expect_success
+  [[ "$output" == *"Placement: CPUs 0"* ]]
+  [[ "$output" == *"on NUMA node 0"* ]]
+}
+
+@test "mem_bw spt" {
+  [ -d /sys/devices/system/node/node0 ] || skip "no NUMA support"
+  spt_run --cpu=0 --numa-node=0 --mem-prefault -- test_mem_bw/test_mem_bw.spt
+  expect_success
+  [[ "$output" == *"Placement: CPUs 0"* ]]
+  [[ "$output" == *"on NUMA node 0"* ]]
+}
+
 @test "blk hvt" {
   setup_block
   hvt_run --block:storage=${BLOCK} -- test_blk/test_blk.hvt
@@ -487,12 +610,105 @@ xen_expect_abort() {
   virtio_expect_success
 }
 
+@test "blk_packed virtio" {
+  [ "${CONFIG_HOST}" = "Linux" ] || skip "QEMU only"
+  [ -n "${CONFIG_VIRTIO_MODERN}" ] || skip "requires --enable-virtio-modern"
+  setup_block
+  virtio_run -o disable-legacy=on,packed=on,event_idx=on -d ${BLOCK} \
+      -- test_blk_async/test_blk_async.virtio
+  virtio_expect_success
+}
+
+@test "blk_async virtio" {
+  setup_block
+  virtio_run -d ${BLOCK} -- test_blk_async/test_blk_async.virtio
+  virtio_expect_success
+}
+
 @test "blk spt" {
   setup_block
   spt_run --block:storage=${BLOCK} -- test_blk/test_blk.spt
   expect_success
 }
 
+@test "blk_overlay hvt" {
+  setup_overlay
+  hvt_run --block:storage=overlay:${BLOCK},${DELTA} -- test_blk/test_blk.hvt
+  expect_success
+  check_overlay
+}
+
+@test "blk_overlay spt" {
+  setup_overlay
+  spt_run --block:storage=overlay:${BLOCK},${DELTA} -- test_blk/test_blk.spt
+  expect_success
+  check_overlay
+}
+
+@test "blk_overlay_in_place hvt" {
+  setup_overlay
+  hvt_run --block:storage=overlay:${BLOCK},${DELTA} -- test_blk/test_blk.hvt
+  expect_success
+  run ${BLKTOOL} merge-overlay ${BLOCK} ${DELTA} ${BLOCK}
+  [ "$status" -eq 1 ]
+  cmp ${BLOCK} ${BATS_TMPDIR}/storage-base.img
+  ${BLKTOOL} merge-overlay --in-place ${BLOCK} ${DELTA}
+  cmp ${BLOCK} ${BATS_TMPDIR}/storage-ref.img
+}
+
+@test "blk_overlay_locked hvt" {
+  setup_overlay
+  # flock(1) holds a lock on the overlay while the tender tries to attach it.
+  run ${TIMEOUT} --foreground 60s flock ${DELTA} ${HVT_TENDER} --mem=2 \
+      --block:storage=overlay:${BLOCK},${DELTA} -- test_blk/test_blk.hvt
+  [ "$status" -eq 1 ]
+  [[ "$output" == *"Overlay is in use by another process"* ]]
+}
+
+@test "blk_ro hvt" {
+  BLOCK=${BATS_TMPDIR}/storage.img
+  dd if=/dev/urandom of=${BLOCK} bs=4k count=1024 status=none
+  hvt_run --block:storage=ro:${BLOCK} -- test_blk_ro/test_blk_ro.hvt
+  expect_success
+}
+
+@test "blk_ro spt" {
+  BLOCK=${BATS_TMPDIR}/storage.img
+  dd if=/dev/urandom of=${BLOCK} bs=4k count=1024 status=none
+  spt_run --block:storage=ro:${BLOCK} -- test_blk_ro/test_blk_ro.spt map
+  expect_success
+}
+
+@test "blk_compressed hvt" {
+  setup_compressed
+  hvt_run --block:storage=compressed:${BLOCK_CMP} --block:reference=${BLOCK} \
+      -- test_blk_bench/test_blk_bench.hvt
+  expect_success
+}
+
+@test "blk_compressed spt" {
+  setup_compressed
+  spt_run --block:storage=compressed:${BLOCK_CMP} --block:reference=${BLOCK} \
+      -- test_blk_bench/test_blk_bench.spt
+  expect_success
+}
+
+@test "blk_rate hvt" {
+  setup_block
+  hvt_run --block:storage=${BLOCK} --block-rate:storage=ops=100 -- \
+      test_blk_rate/test_blk_rate.hvt
+  expect_success
+  [[ "$output" == *"storage: throttled"* ]]
+}
+
+@test "blk_rate spt" {
+  setup_block
+  spt_run --block:storage=${BLOCK} --block-rate:storage=ops=100 -- \
+      test_blk_rate/test_blk_rate.spt
+  expect_success
+  [[ "$output" == *"storage: throttled"* ]]
+}
+
 @test "net hvt" {
   skip_unless_root
 
@@ -517,6 +733,164 @@ xen_expect_abort() {
   expect_success
 }
 
+@test "net_mtu hvt" {
+  skip_unless_root
+  skip_unless_host_is Linux
+
+  ip link set dev ${NET0} mtu 9000
+  ( sleep 1; ${TIMEOUT} 60s ping -fq -M do -s 8000 -c 100000 ${NET0_IP} ) &
+  hvt_run --net:service0=${NET0} --net-mtu:service0=9000 -- \
+      test_net/test_net.hvt limit
+  ip link set dev ${NET0} mtu 1500
+  expect_success
+}
+
+@test "net_mtu spt" {
+  skip_unless_root
+  skip_unless_host_is Linux
+
+  ip link set dev ${NET0} mtu 9000
+  ( sleep 1; ${TIMEOUT} 60s ping -fq -M do -s 8000 -c 100000 ${NET0_IP} ) &
+  spt_run --net:service0=${NET0} --net-mtu:service0=9000 -- \
+      test_net/test_net.spt limit
+  ip link set dev ${NET0} mtu 1500
+  expect_success
+}
+
+@test "net_filter hvt" {
+  skip_unless_root
+  skip_unless_host_is Linux
+
+  # Frames to 10.0.0.3 are addressed to a foreign MAC, and must be dropped.
+  ip neigh replace 10.0.0.3 lladdr 02:00:00:00:00:03 dev ${NET0} nud permanent
+  ( sleep 1; ${TIMEOUT} 60s ping -fq -c 100000 ${NET0_IP} ) &
+  ( sleep 1; ping -q -c 100 -i 0.01 10.0.0.3 >/dev/null || true ) &
+  hvt_run --net:service0=${NET0} --net-filter:service0 -- \
+      test_net/test_net.hvt limit
+  ip neigh del 10.0.0.3 dev ${NET0}
+  expect_success
+  dropped=$(echo "${output}" | \
+      sed -n 's/.*service0: \([0-9]*\) frames dropped by interface.*/\1/p')
+  [ "${dropped:-0}" -ge 100 ]
+}
+
+@test "net_filter spt" {
+  skip_unless_root
+  skip_unless_host_is Linux
+
+  # Frames to 10.0.0.3 are addressed to a foreign MAC, and must be dropped.
+  # The spt tender does not report at exit, so check the TAP statistics.
+  STATS=/sys/class/net/${NET0}/statistics/tx_dropped
+  before=$(cat ${STATS})
+  ip neigh replace 10.0.0.3 lladdr 02:00:00:00:00:03 dev ${NET0} nud permanent
+  ( sleep 1; ${TIMEOUT} 60s ping -fq -c 100000 ${NET0_IP} ) &
+  ( sleep 1; ping -q -c 100 -i 0.01 10.0.0.3 >/dev/null || true ) &
+  spt_run --net:service0=${NET0} --net-filter:service0 -- \
+      test_net/test_net.spt limit
+  ip neigh del 10.0.0.3 dev ${NET0}
+  expect_success
+  [ $(( $(cat ${STATS}) - before )) -ge 100 ]
+}
+
+@test "net_xdp hvt" {
+  skip_unless_root
+  skip_unless_host_is Linux
+
+  ( sleep 1; ${TIMEOUT} 60s ip netns exec ${XDP0_NETNS} \
+      ping -fq -c 100000 ${NET0_IP} ) &
+  hvt_run --net:service0=xdp:${XDP0} -- test_net/test_net.hvt limit
+  expect_success
+}
+
+@test "net_xdp spt" {
+  skip_unless_root
+  skip_unless_host_is Linux
+
+  ( sleep 1; ${TIMEOUT} 60s ip netns exec ${XDP0_NETNS} \
+      ping -fq -c 100000 ${NET0_IP} ) &
+  spt_run --net:service0=xdp:${XDP0} -- test_net/test_net.spt limit
+  expect_success
+}
+
+@test "net_shm hvt" {
+  skip_unless_host_is Linux
+
+  SHM=${BATS_TMPDIR}/net_shm.sock
+  rm -f ${SHM}
+  ${TIMEOUT} --foreground 60s ${HVT_TENDER} --mem=2 \
+      --net:service0=shm:${SHM} -- test_net_shm/test_net_shm.hvt pong &
+  PONG=$!
+  hvt_run --net:service0=shm:${SHM} -- test_net_shm/test_net_shm.hvt ping
+  expect_success
+  wait ${PONG}
+}
+
+@test "net_shm async_tx hvt" {
+  skip_unless_host_is Linux
+
+  SHM=${BATS_TMPDIR}/net_shm.sock
+  rm -f ${SHM}
+  ${TIMEOUT} --foreground 60s ${HVT_TENDER} --mem=2 \
+      --net:service0=shm:${SHM} --net-async-tx:service0 \
+      -- test_net_shm/test_net_shm.hvt pong &
+  PONG=$!
+  hvt_run --net:service0=shm:${SHM} --net-async-tx:service0 \
+      -- test_net_shm/test_net_shm.hvt ping 200
+  expect_success
+  wait ${PONG}
+}
+
+@test "net_shm spt" {
+  skip_unless_host_is Linux
+
+  SHM=${BATS_TMPDIR}/net_shm.sock
+  rm -f ${SHM}
+  ${TIMEOUT} --foreground 60s ${SPT_TENDER} --mem=2 \
+      --net:service0=shm:${SHM} -- test_net_shm/test_net_shm.spt pong &
+  PONG=$!
+  spt_run --net:service0=shm:${SHM} -- test_net_shm/test_net_shm.spt ping
+  expect_success
+  wait ${PONG}
+}
+
+@test "net_capture spt" {
+  skip_unless_host_is Linux
+
+  SHM=${BATS_TMPDIR}/net_shm.sock
+  CAPTURE=${BATS_TMPDIR}/capture.pcapng
+  rm -f ${SHM} ${CAPTURE}
+  ${TIMEOUT} --foreground 60s ${SPT_TENDER} --mem=2 \
+      --net:service0=shm:${SHM} -- test_net_shm/test_net_shm.spt pong &
+  PONG=$!
+  spt_run --net:service0=shm:${SHM} --net-capture:service0=${CAPTURE} -- \
+      test_net_shm/test_net_shm.spt ping
+  expect_success
+  wait ${PONG}
+  # The capture is written by a helper process, the guest itself is not
+  # permitted to write to the file.
+  [[ "$output" == *"service0: Captured "* ]]
+  [ "$(od -An -tx4 -N4 ${CAPTURE} | tr -d ' ')" = "0a0d0d0a" ]
+  [ "$(wc -c <${CAPTURE})" -gt 1000 ]
+  rm -f ${CAPTURE}
+}
+
+@test "net_offload hvt" {
+  skip_unless_root
+  skip_unless_host_is Linux
+
+  hvt_run --net:service0=${NET0} --net-offload:service0 -- \
+      test_net_offload/test_net_offload.hvt
+  expect_success
+}
+
+@test "net_offload spt" {
+  skip_unless_root
+
+  spt_run --net:service0=${NET0} --net-offload:service0 -- \
+      test_net_offload/test_net_offload.spt
+  expect_success
+}
+
 @test "net_2if hvt" {
   skip_unless_root
   [ "${CONFIG_HOST}" = "OpenBSD" ] && skip "breaks on OpenBSD due to #374"
@@ -538,6 +912,15 @@ xen_expect_abort() {
   expect_success
 }
 
+@test "net_2if virtio" {
+  skip_unless_root
+
+  ( sleep 3; ${TIMEOUT} 60s ping -fq -c 50000 ${NET0_IP} ) &
+  ( sleep 3; ${TIMEOUT} 60s ping -fq -c 50000 ${NET1_IP} ) &
+  virtio_run -n ${NET0} -n ${NET1} -- test_net_2if/test_net_2if.virtio limit
+  virtio_expect_success
+}
+
 @test "dumpcore hvt" {
   [ "${CONFIG_HOST_ARCH}" = "x86_64" ] || skip "not implemented for ${CONFIG_HOST_ARCH}"
   skip_unless_host_is Linux FreeBSD
@@ -549,6 +932,79 @@ xen_expect_abort() {
   [ -f "$BATS_TMPDIR"/"$CORE" ]
 }
 
+@test "dumpcore_fd hvt" {
+  [ "${CONFIG_HOST_ARCH}" = "x86_64" ] || skip "not implemented for ${CONFIG_HOST_ARCH}"
+  skip_unless_host_is Linux FreeBSD
+
+  ${TIMEOUT} --foreground 60s ${HVT_TENDER_DEBUG} --dumpcore-fd=3 \
+     test_dumpcore/test_dumpcore.hvt 3>&1 >/dev/null 2>&1 | \
+     cat >"$BATS_TMPDIR"/core.pipe
+  [ "$(head -c 4 "$BATS_TMPDIR"/core.pipe | tail -c 3)" = "ELF" ]
+  [ "$(wc -c <"$BATS_TMPDIR"/core.pipe)" -gt 4096 ]
+  rm -f "$BATS_TMPDIR"/core.pipe
+}
+
+@test "dumpcore_fd_file hvt" {
+  [ "${CONFIG_HOST_ARCH}" = "x86_64" ] || skip "not implemented for ${CONFIG_HOST_ARCH}"
+  skip_unless_host_is Linux FreeBSD
+
+  # Start with a larger file, and the fd at a non-zero offset.
+  CORE="$BATS_TMPDIR"/core.file
+  head -c 8388608 /dev/urandom >"$CORE"
+  { dd of=/dev/null bs=1 skip=100 count=0 status=none <&3
+    ${TIMEOUT} --foreground 60s ${HVT_TENDER_DEBUG} --mem=2 --dumpcore-fd=3 \
+      test_dumpcore/test_dumpcore.hvt >/dev/null 2>&1; } 3<>"$CORE" || true
+  [ "$(head -c 4 "$CORE" | tail -c 3)" = "ELF" ]
+  [ "$(wc -c <"$CORE")" -lt 4194304 ]
+  rm -f "$CORE"
+}
+
+@test "gdb_read hvt" {
+  [ "${CONFIG_HOST_ARCH}" = "x86_64" ] || skip "not implemented for ${CONFIG_HOST_ARCH}"
+  skip_unless_host_is Linux
+  [ -x "$(command -v gdb)" ] || skip "gdb not available"
+
+  ${TIMEOUT} --foreground 60s ${HVT_TENDER_DEBUG} --mem=80 --gdb \
+    --gdb-port=12345 test_hello/test_hello.hvt >/dev/null 2>&1 &
+  TENDER=$!
+  # Read 64 MiB of guest memory, and report the time taken.
+  TIMEFORMAT=%R
+  { time ${TIMEOUT} 60s gdb -nx -batch \
+    -ex "set tcp connect-timeout 30" \
+    -ex "target remote localhost:12345" \
+    -ex "dump binary memory $BATS_TMPDIR/mem.bin 0 0x4000000" \
+    -ex "kill" test_hello/test_hello.hvt >/dev/null 2>&1; } \
+    2>"$BATS_TMPDIR"/gdb_read.time
+  wait ${TENDER} || true
+  echo "# read 64 MiB in $(cat "$BATS_TMPDIR"/gdb_read.time)s" >&3
+  [ "$(wc -c <"$BATS_TMPDIR"/mem.bin)" -eq 67108864 ]
+  # This takes minutes with hex-encoded packets of a few kB.
+  [ "$(cut -d. -f1 "$BATS_TMPDIR"/gdb_read.time)" -lt 30 ]
+  rm -f "$BATS_TMPDIR"/mem.bin "$BATS_TMPDIR"/gdb_read.time
+}
+
+@test "profile hvt" {
+  [ "${CONFIG_HOST_ARCH}" = "x86_64" ] || skip "not implemented for ${CONFIG_HOST_ARCH}"
+  skip_unless_host_is Linux
+
+  hvt_run --x-profile="$BATS_TMPDIR"/profile.txt,999 \
+    -- test_profile/test_profile.hvt
+  expect_success
+  grep -q "solo5_app_main;.*spin_inner [0-9]*$" "$BATS_TMPDIR"/profile.txt
+}
+
+@test "perf_map spt" {
+  # Run the tender via exec, so that we know its PID.
+  run ${TIMEOUT} --foreground 60s sh -c \
+    'echo "PID=$$"; exec "$@"' sh ${SPT_TENDER} --mem=2 --x-perf-map \
+    -- test_hello/test_hello.spt Hello_Solo5
+  expect_success
+  PID=`echo "$output" | sed -n 's/^PID=//p'`
+  MAP=/tmp/perf-${PID}.map
+  grep -q " solo5_app_main$" ${MAP}
+  rm -f ${MAP}
+}
+
 @test "mft_maxdevices hvt" {
   for num in $(${SEQ} 0 62); do
       dd if=/dev/zero of=${BATS_TMPDIR}/storage${num}.img \